@@ -121,6 +121,25 @@ struct Host final : std::enable_shared_from_this<Host> {
     });
   }
 
+  /// Sends the same packet to multiple nodes, packet is encoded and compressed only once and each session only
+  /// encrypts it. on_done is called for each node the packet was sent to
+  void broadcast(std::vector<NodeID> node_ids, std::string capability_name, unsigned packet_type, bytes payload,
+                 std::function<void(NodeID const&)> on_done = {}) {
+    auto packet = std::make_shared<SharedPacket>(std::move(payload));
+    ba::post(strand_, [=, this, node_ids = std::move(node_ids), capability_name = std::move(capability_name),
+                       packet = std::move(packet), on_done = std::move(on_done)] {
+      for (auto const& node_id : node_ids) {
+        if (auto session = peerSession(node_id)) {
+          std::function<void()> session_on_done;
+          if (on_done) {
+            session_on_done = [on_done, node_id] { on_done(node_id); };
+          }
+          session->send(capability_name, packet_type, packet, std::move(session_on_done));
+        }
+      }
+    });
+  }
+
   /// Get the endpoint information.
   std::string enode() const {
     std::string address;
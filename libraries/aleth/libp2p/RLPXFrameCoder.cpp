@@ -167,7 +167,7 @@ void RLPXFrameCoder::writeFrame(uint16_t _seqId, bytesConstRef _payload, bytes&
   writeFrame(&header.out(), _payload, o_bytes);
 }
 
-void RLPXFrameCoder::LZ4compress(bytesConstRef payload, bytes& output) const {
+void RLPXFrameCoder::LZ4compress(bytesConstRef payload, bytes& output) {
   const uint32_t payload_size = LZ4_compressBound(payload.size());
   output = bytes(payload_size);
   const auto i = LZ4_compress_default(reinterpret_cast<const char*>(payload.data()),
@@ -178,12 +178,16 @@ void RLPXFrameCoder::LZ4compress(bytesConstRef payload, bytes& output) const {
 
 void RLPXFrameCoder::writeCompressedFrame(uint16_t _seqId, bytesConstRef _payload, bytes& o_bytes) {
   bytes data;
-  RLPStream header;
   LZ4compress(_payload, data);
-  uint32_t len = (uint32_t)data.size();
+  writePrecompressedFrame(_seqId, &data, o_bytes);
+}
+
+void RLPXFrameCoder::writePrecompressedFrame(uint16_t _seqId, bytesConstRef _compressed, bytes& o_bytes) {
+  RLPStream header;
+  uint32_t len = (uint32_t)_compressed.size();
   header.appendRaw(bytes({::byte((len >> 16) & 0xff), ::byte((len >> 8) & 0xff), ::byte(len & 0xff)}));
   header.appendList(2) << static_cast<uint16_t>(ProtocolIdType::Compressed) << _seqId;
-  writeFrame(&header.out(), &data, o_bytes);
+  writeFrame(&header.out(), _compressed, o_bytes);
 }
 
 void RLPXFrameCoder::writeCompressedFrame(uint16_t _seqId, uint32_t _totalSize, bytesConstRef _payload,
@@ -52,8 +52,11 @@ struct RLPXHandshake;
 
 class RLPXFrameCoder {
   static constexpr size_t MAX_PACKET_SIZE = 15 * 1024 * 1024;
+  /// Smaller packets are not compressed
+  static constexpr uint32_t MIN_COMPRESSION_SIZE = 500;
 
   friend struct Session;
+  friend class SharedPacket;
 
   enum class ProtocolIdType : uint16_t { Normal = 0, Compressed };
 
@@ -91,10 +94,13 @@ class RLPXFrameCoder {
   /// Compression
   uint32_t decompressFrame(bytesRef payload, bytes& output) const;
 
-  void LZ4compress(bytesConstRef payload, bytes& output) const;
+  static void LZ4compress(bytesConstRef payload, bytes& output);
 
   void writeCompressedFrame(uint16_t _seqId, bytesConstRef _payload, bytes& o_bytes);
 
+  /// Write single frame packet, which payload was already compressed by LZ4compress
+  void writePrecompressedFrame(uint16_t _seqId, bytesConstRef _compressed, bytes& o_bytes);
+
   void writeCompressedFrame(uint16_t _seqId, uint32_t _totalSize, bytesConstRef _payload, bytes& o_bytes);
   // Compression <--- end
 
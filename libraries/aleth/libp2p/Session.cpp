@@ -14,8 +14,6 @@
 
 using namespace dev::p2p;
 
-static constexpr uint32_t MIN_COMPRESSION_SIZE = 500;
-
 Session::Session(SessionCapabilities caps, std::unique_ptr<RLPXFrameCoder> _io, std::shared_ptr<RLPXSocket> _s,
                  std::shared_ptr<Peer> _n, PeerSessionInfo _info,
                  std::optional<DisconnectReason> immediate_disconnect_reason)
@@ -159,49 +157,57 @@ bool Session::checkPacket(bytesConstRef _msg) {
 }
 
 void Session::send_(bytes _msg, std::function<void()> on_done) {
-  LOG(m_netLoggerDetail) << capabilityPacketTypeToString(_msg[0]) << " to";
-  if (!checkPacket(&_msg)) {
-    clog(VerbosityError, "net") << "Invalid packet constructed. Size: " << _msg.size()
-                                << " bytes, message: " << toHex(_msg);
+  send_(SendRequest{std::move(_msg), nullptr, std::move(on_done)});
+}
+
+void Session::send_(SendRequest&& request) {
+  const auto& msg = request.msg();
+  LOG(m_netLoggerDetail) << capabilityPacketTypeToString(msg[0]) << " to";
+  if (!checkPacket(&msg)) {
+    clog(VerbosityError, "net") << "Invalid packet constructed. Size: " << msg.size()
+                                << " bytes, message: " << toHex(msg);
   }
   if (!isConnected()) {
     return;
   }
-  m_writeQueue.emplace_back(SendRequest{std::move(_msg), std::move(on_done)});
+  m_writeQueue.emplace_back(std::move(request));
   if (m_writeQueue.size() == 1) {
     write();
   }
 }
 
 void Session::splitAndPack(uint16_t& sequence_id, uint32_t& sent_size) {
+  const auto& msg = m_writeQueue[0].msg();
   if (sequence_id) [[unlikely]] {
     // Sending last chunk
-    if (m_writeQueue[0].payload.size() < sent_size + RLPXFrameCoder::MAX_PACKET_SIZE) {
-      bytesConstRef data(m_writeQueue[0].payload.data() + sent_size, m_writeQueue[0].payload.size() - sent_size);
-      if (data.size() < MIN_COMPRESSION_SIZE) {
+    if (msg.size() < sent_size + RLPXFrameCoder::MAX_PACKET_SIZE) {
+      bytesConstRef data(msg.data() + sent_size, msg.size() - sent_size);
+      if (data.size() < RLPXFrameCoder::MIN_COMPRESSION_SIZE) {
         m_io->writeFrame(sequence_id, data, m_out);
       } else {
         m_io->writeCompressedFrame(sequence_id, data, m_out);
       }
       sequence_id = 0;  // means we are finished
     } else {
-      m_io->writeCompressedFrame(
-          sequence_id, bytesConstRef(m_writeQueue[0].payload.data() + sent_size, RLPXFrameCoder::MAX_PACKET_SIZE),
-          m_out);
+      m_io->writeCompressedFrame(sequence_id, bytesConstRef(msg.data() + sent_size, RLPXFrameCoder::MAX_PACKET_SIZE),
+                                 m_out);
       sequence_id++;
       sent_size += RLPXFrameCoder::MAX_PACKET_SIZE;
     }
   } else [[likely]] {
     // Sending single chunk
-    if (m_writeQueue[0].payload.size() < RLPXFrameCoder::MAX_PACKET_SIZE) [[likely]] {
-      if (m_writeQueue[0].payload.size() < MIN_COMPRESSION_SIZE) [[likely]] {
-        m_io->writeSingleFramePacket(&m_writeQueue[0].payload, m_out);
+    if (msg.size() < RLPXFrameCoder::MAX_PACKET_SIZE) [[likely]] {
+      if (msg.size() < RLPXFrameCoder::MIN_COMPRESSION_SIZE) [[likely]] {
+        m_io->writeSingleFramePacket(&msg, m_out);
+      } else if (const auto& shared = m_writeQueue[0].shared; shared && !shared->compressed.empty()) {
+        // Compressed once for all peers, only encrypted here
+        m_io->writePrecompressedFrame(0, &shared->compressed, m_out);
       } else [[unlikely]] {
-        m_io->writeCompressedFrame(0, &m_writeQueue[0].payload, m_out);
+        m_io->writeCompressedFrame(0, &msg, m_out);
       }
     } else [[unlikely]] {
-      m_io->writeCompressedFrame(sequence_id, m_writeQueue[0].payload.size(),
-                                 bytesConstRef(m_writeQueue[0].payload.data(), RLPXFrameCoder::MAX_PACKET_SIZE), m_out);
+      m_io->writeCompressedFrame(sequence_id, msg.size(), bytesConstRef(msg.data(), RLPXFrameCoder::MAX_PACKET_SIZE),
+                                 m_out);
       sequence_id++;
       sent_size = RLPXFrameCoder::MAX_PACKET_SIZE;
     }
@@ -16,6 +16,7 @@
 #include "Common.h"
 #include "Peer.h"
 #include "RLPXSocket.h"
+#include "SharedPacket.h"
 #include "taraxa.hpp"
 
 namespace dev {
@@ -61,6 +62,20 @@ struct Session final : std::enable_shared_from_this<Session> {
              });
   }
 
+  /// Sends packet shared with other sessions, it is encoded and compressed only once
+  void send(std::string capability_name, unsigned packet_type, std::shared_ptr<SharedPacket> packet,
+            std::function<void()>&& on_done = {}) {
+    ba::post(m_socket->ref().get_executor(),
+             [=, this, _ = shared_from_this(), capability_name = std::move(capability_name),
+              packet = std::move(packet), on_done = std::move(on_done)]() mutable {
+               auto cap_itr = m_capabilities.find(capability_name);
+               assert(cap_itr != m_capabilities.end());
+               auto header = packet_type + cap_itr->second.offset;
+               assert(header <= std::numeric_limits<byte>::max());
+               send_(SendRequest{{}, packet->message(header), std::move(on_done)});
+             });
+  }
+
   void ping() {
     ba::post(m_socket->ref().get_executor(), [this, _ = shared_from_this()] { ping_(); });
   }
@@ -85,7 +100,16 @@ struct Session final : std::enable_shared_from_this<Session> {
 
   static RLPStream& prep(RLPStream& _s, P2pPacketType _t, unsigned _args = 0);
 
+  struct SendRequest {
+    bytes payload;
+    std::shared_ptr<const SharedPacket::Message> shared;
+    std::function<void()> on_done;
+
+    const bytes& msg() const { return shared ? shared->msg : payload; }
+  };
+
   void send_(bytes _msg, std::function<void()> on_done = {});
+  void send_(SendRequest&& request);
 
   /// Drop the connection for the reason @a _r.
   void drop(DisconnectReason _r);
@@ -126,10 +150,6 @@ struct Session final : std::enable_shared_from_this<Session> {
   SessionCapabilities m_capabilities;
   std::unique_ptr<RLPXFrameCoder> m_io;  ///< Transport over which packets are sent.
   std::shared_ptr<RLPXSocket> m_socket;  ///< Socket of peer's connection.
-  struct SendRequest {
-    bytes payload;
-    std::function<void()> on_done;
-  };
   std::deque<SendRequest> m_writeQueue;  ///< The write queue.
   std::vector<byte> m_data;              ///< Buffer for ingress packet data.
   std::vector<byte> m_multiData;         ///< Buffer for multipacket data.
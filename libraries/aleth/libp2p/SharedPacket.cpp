@@ -0,0 +1,25 @@
+#include "SharedPacket.h"
+
+#include "RLPXFrameCoder.h"
+
+namespace dev::p2p {
+
+std::shared_ptr<const SharedPacket::Message> SharedPacket::message(byte header) {
+  std::scoped_lock lock(mutex_);
+  if (auto it = messages_.find(header); it != messages_.end()) {
+    return it->second;
+  }
+
+  auto message = std::make_shared<Message>();
+  message->msg.resize(1 + payload_.size());
+  message->msg[0] = header;
+  std::copy(payload_.begin(), payload_.end(), message->msg.begin() + 1);
+  // Same condition as Session uses for sending the message as a single compressed frame
+  if (message->msg.size() >= RLPXFrameCoder::MIN_COMPRESSION_SIZE &&
+      message->msg.size() < RLPXFrameCoder::MAX_PACKET_SIZE) {
+    RLPXFrameCoder::LZ4compress(&message->msg, message->compressed);
+  }
+  return messages_.emplace(header, std::move(message)).first->second;
+}
+
+}  // namespace dev::p2p
@@ -0,0 +1,43 @@
+#pragma once
+
+#include <libdevcore/Common.h>
+
+#include <map>
+#include <memory>
+#include <mutex>
+
+namespace dev::p2p {
+
+/**
+ * @brief Capability packet sent to multiple peers. Message (packet type header + payload) and its compressed form are
+ *        built only once per packet type header, which depends on the capability offset negotiated with each peer.
+ *        Sessions then only encrypt and authenticate the shared message
+ *
+ * Thread Safety
+ * Shared objects: Safe.
+ */
+class SharedPacket {
+ public:
+  struct Message {
+    bytes msg;
+    // LZ4 compressed msg, empty if msg is not sent as a single compressed frame
+    bytes compressed;
+  };
+
+  explicit SharedPacket(bytes payload) : payload_(std::move(payload)) {}
+
+  size_t payloadSize() const { return payload_.size(); }
+
+  /**
+   * @param header packet type with capability offset
+   * @return message with the header, it is built and compressed by the first call for the header
+   */
+  std::shared_ptr<const Message> message(byte header);
+
+ private:
+  const bytes payload_;
+  std::map<byte, std::shared_ptr<const Message>> messages_;
+  std::mutex mutex_;
+};
+
+}  // namespace dev::p2p
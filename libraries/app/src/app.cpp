@@ -15,6 +15,7 @@
 #include "dag/dag_manager.hpp"
 #include "final_chain/final_chain.hpp"
 #include "key_manager/key_manager.hpp"
+#include "metrics/final_chain_metrics.hpp"
 #include "metrics/metrics_service.hpp"
 #include "metrics/network_metrics.hpp"
 #include "metrics/pbft_metrics.hpp"
@@ -88,13 +89,15 @@ void App::init(const cli::Config &cli_conf) {
     if (conf_.db_config.rebuild_db) {
       old_db_ = std::make_shared<DbStorage>(conf_.db_path, conf_.db_config.db_snapshot_each_n_pbft_block,
                                             conf_.db_config.db_max_open_files, conf_.db_config.db_max_snapshots,
-                                            conf_.db_config.db_revert_to_period, node_addr, true);
+                                            conf_.db_config.db_revert_to_period, node_addr, true,
+                                            conf_.db_config.block_cache_size_mb, conf_.db_config.column_profiles);
     }
     db_ = std::make_shared<DbStorage>(conf_.db_path,
                                       // Snapshots should be disabled while rebuilding
                                       conf_.db_config.rebuild_db ? 0 : conf_.db_config.db_snapshot_each_n_pbft_block,
                                       conf_.db_config.db_max_open_files, conf_.db_config.db_max_snapshots,
-                                      conf_.db_config.db_revert_to_period, node_addr, false);
+                                      conf_.db_config.db_revert_to_period, node_addr, false,
+                                      conf_.db_config.block_cache_size_mb, conf_.db_config.column_profiles);
 
     if (db_->hasMajorVersionChanged()) {
       LOG(log_si_) << "Major DB version has changed. Rebuilding Db";
@@ -102,14 +105,17 @@ void App::init(const cli::Config &cli_conf) {
       db_ = nullptr;
       old_db_ = std::make_shared<DbStorage>(conf_.db_path, conf_.db_config.db_snapshot_each_n_pbft_block,
                                             conf_.db_config.db_max_open_files, conf_.db_config.db_max_snapshots,
-                                            conf_.db_config.db_revert_to_period, node_addr, true);
+                                            conf_.db_config.db_revert_to_period, node_addr, true,
+                                            conf_.db_config.block_cache_size_mb, conf_.db_config.column_profiles);
       db_ = std::make_shared<DbStorage>(conf_.db_path,
                                         0,  // Snapshots should be disabled while rebuilding
                                         conf_.db_config.db_max_open_files, conf_.db_config.db_max_snapshots,
-                                        conf_.db_config.db_revert_to_period, node_addr);
+                                        conf_.db_config.db_revert_to_period, node_addr, false,
+                                        conf_.db_config.block_cache_size_mb, conf_.db_config.column_profiles);
     }
 
     db_->updateDbVersions();
+    db_->enableGroupCommit(conf_.db_config.group_commit_max_periods);
 
     auto migration_manager = storage::migration::Manager(db_);
     migration_manager.registerMigration(std::make_shared<storage::migration::BlockStats>(db_, conf_));
@@ -119,6 +125,8 @@ void App::init(const cli::Config &cli_conf) {
     if (conf_.db_config.migrate_receipts_by_period) {
       migration_manager.applyReceiptsByPeriod();
     }
+    // Logs index is built from receipts by period, so it goes after their migration
+    migration_manager.applyLogsIndex(conf_.db_config.logs_index);
     if (db_->getDagBlocksCount() == 0) {
       db_->setGenesisHash(conf_.genesis.genesisHash());
     }
@@ -282,6 +290,23 @@ void App::setupMetricsUpdaters() {
   pbft_metrics->setStepUpdater([pbft_mgr = pbft_mgr_]() { return pbft_mgr->getPbftStep(); });
   pbft_metrics->setVotesCountUpdater(
       [pbft_mgr = pbft_mgr_]() { return pbft_mgr->getCurrentNodeVotesCount().value_or(0); });
+  auto final_chain_metrics = metrics_->getMetrics<metrics::FinalChainMetrics>();
+  final_chain_metrics->setPrepareDurationUpdater(
+      [final_chain = final_chain_]() { return final_chain->stageTimings().prepare_us.load(); });
+  final_chain_metrics->setExecuteDurationUpdater(
+      [final_chain = final_chain_]() { return final_chain->stageTimings().execute_us.load(); });
+  final_chain_metrics->setSealDurationUpdater(
+      [final_chain = final_chain_]() { return final_chain->stageTimings().seal_us.load(); });
+  final_chain_metrics->setRewardsDurationUpdater(
+      [final_chain = final_chain_]() { return final_chain->stageTimings().rewards_us.load(); });
+  final_chain_metrics->setCommitDurationUpdater(
+      [final_chain = final_chain_]() { return final_chain->stageTimings().commit_us.load(); });
+  final_chain_metrics->setCacheHitsUpdater([final_chain = final_chain_]() { return final_chain->cacheStats().hits; });
+  final_chain_metrics->setCacheMissesUpdater(
+      [final_chain = final_chain_]() { return final_chain->cacheStats().misses; });
+  final_chain_metrics->setCacheEvictionsUpdater(
+      [final_chain = final_chain_]() { return final_chain->cacheStats().evictions; });
+
   final_chain_->block_finalized_.subscribe(
       [pbft_metrics](const std::shared_ptr<final_chain::FinalizationResult> &res) {
         pbft_metrics->setBlockNumber(res->final_chain_blk->number);
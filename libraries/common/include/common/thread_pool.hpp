@@ -44,5 +44,15 @@ class ThreadPool : std::enable_shared_from_this<ThreadPool> {
     uint64_t period_ms = 0, delay_ms = period_ms;
   };
   void post_loop(Periodicity const &periodicity, std::function<void()> action);
+
+  /**
+   * @brief Calls func for chunks of [0, count) range. If count is at least min_parallel_count, chunks are processed in
+   *        parallel by the caller thread and the pool, otherwise func is called once for the whole range by the caller
+   *
+   * @param count
+   * @param min_parallel_count
+   * @param func called with [start, end) of the chunk
+   */
+  void parallel_for(size_t count, size_t min_parallel_count, const std::function<void(size_t, size_t)> &func);
 };
 }  // namespace taraxa::util
\ No newline at end of file
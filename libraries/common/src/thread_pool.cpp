@@ -70,6 +70,44 @@ void ThreadPool::post_loop(Periodicity const &periodicity, std::function<void()>
   });
 }
 
+void ThreadPool::parallel_for(size_t count, size_t min_parallel_count,
+                              const std::function<void(size_t, size_t)> &func) {
+  const auto threads_count = capacity();
+  if (count < min_parallel_count || threads_count < 2) {
+    func(0, count);
+    return;
+  }
+
+  // Caller thread processes the first chunk while the pool processes the rest
+  const auto chunk_size = (count + threads_count) / (threads_count + 1);
+  std::vector<std::future<void>> futures;
+  futures.reserve(threads_count);
+  for (size_t start = chunk_size; start < count; start += chunk_size) {
+    const auto end = std::min(start + chunk_size, count);
+    futures.emplace_back(post([&func, start, end]() { func(start, end); }));
+  }
+
+  // Chunks in the pool reference func, so all of them must finish before an exception is propagated
+  std::exception_ptr exception;
+  try {
+    func(0, std::min(chunk_size, count));
+  } catch (...) {
+    exception = std::current_exception();
+  }
+  for (auto &future : futures) {
+    try {
+      future.get();
+    } catch (...) {
+      if (!exception) {
+        exception = std::current_exception();
+      }
+    }
+  }
+  if (exception) {
+    std::rethrow_exception(exception);
+  }
+}
+
 ThreadPool::~ThreadPool() { stop(); }
 
 }  // namespace taraxa::util
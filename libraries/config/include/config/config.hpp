@@ -7,6 +7,17 @@
 
 namespace taraxa {
 
+/**
+ * @brief Rocksdb tuning profile of a db column
+ *
+ * PointLookup - random reads of hash keys, bloom filters and partitioned index
+ * AppendOnly  - keys written in order and read in ranges, larger blocks
+ * SmallHot    - few small values read and rewritten all the time, small memtable and bloom filters
+ */
+enum class DbColumnProfile { Default, PointLookup, AppendOnly, SmallHot };
+DbColumnProfile dbColumnProfileFromString(const std::string &profile);
+std::string dbColumnProfileToString(DbColumnProfile profile);
+
 struct DBConfig {
   uint32_t db_snapshot_each_n_pbft_block = 0;
   uint32_t db_max_snapshots = 0;
@@ -16,6 +27,14 @@ struct DBConfig {
   bool migrate_only = false;
   PbftPeriod rebuild_db_period = 0;
   bool migrate_receipts_by_period = false;
+  // Max number of finalized periods committed without fsync during syncing, 0 - disabled
+  uint32_t group_commit_max_periods = 0;
+  // Index logs by address and topic for exact eth_getLogs lookups, meant for archive/rpc nodes
+  bool logs_index = false;
+  // Size of rocksdb block cache shared by all columns, 0 - each column uses its own default cache
+  uint32_t block_cache_size_mb = 512;
+  // Overrides of default column profiles, column name -> profile
+  std::map<std::string, DbColumnProfile> column_profiles;
 };
 void dec_json(Json::Value const &json, DBConfig &db_config);
 
@@ -77,6 +96,8 @@ struct FullNodeConfig {
   uint32_t dag_expiry_limit = kDagExpiryLevelLimit;      // For unit tests only
   uint32_t max_levels_per_period = kMaxLevelsPerPeriod;  // For unit tests only
   uint32_t final_chain_cache_in_blocks = 5;
+  // Memory budget for frequently accessed values of blocks older than final_chain_cache_in_blocks
+  uint32_t final_chain_cache_size_mb = 128;
   uint64_t propose_dag_gas_limit = 0x1E0A6E0;
   uint64_t propose_pbft_gas_limit = 0x12C684C0;
 
@@ -23,6 +23,20 @@ struct ConnectionConfig {
   // Number of threads dedicated to the rpc calls processing, default = 5
   uint16_t threads_num{2};
 
+  // Number of threads scanning block ranges of eth_getLogs queries, 0 scans on the rpc thread
+  uint16_t logs_query_threads{4};
+  // Max number of blocks eth_getLogs query can span, 0 means unlimited
+  uint64_t logs_query_max_blocks{0};
+  // Max number of logs eth_getLogs query can return, 0 means unlimited
+  uint64_t logs_query_max_results{0};
+
+  // Max number of calls in a single http batch request, 0 means unlimited
+  uint64_t batch_max_size{0};
+  // Max execution time of a single http batch request in ms, calls not started in time fail, 0 means unlimited
+  uint64_t batch_timeout_ms{0};
+  // Max size of streamed eth_getLogs and trace http responses buffered in memory per request, in bytes
+  uint64_t stream_buffer_size{1 << 20};
+
   void validate() const;
 };
 
@@ -75,6 +89,10 @@ struct NetworkConfig {
   uint16_t max_peer_count = 50;
   uint16_t transaction_interval_ms = 100;
   uint16_t sync_level_size = 10;
+  // Max number of peers that pbft blocks are synced from concurrently, each of them is requested sync_level_size blocks
+  uint16_t sync_max_peers = 4;
+  // Pbft sync request is requested from another peer if no block was received within the timeout
+  uint32_t sync_request_timeout_ms = 10000;
   uint16_t num_threads = std::max(uint(1), uint(std::thread::hardware_concurrency() / 2));
   uint16_t packets_processing_threads = 14;
   uint16_t peer_blacklist_timeout = kBlacklistTimeoutDefaultInSeconds;
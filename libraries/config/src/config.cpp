@@ -9,12 +9,43 @@
 
 namespace taraxa {
 
+DbColumnProfile dbColumnProfileFromString(const std::string &profile) {
+  if (profile == "default") return DbColumnProfile::Default;
+  if (profile == "point_lookup") return DbColumnProfile::PointLookup;
+  if (profile == "append_only") return DbColumnProfile::AppendOnly;
+  if (profile == "small_hot") return DbColumnProfile::SmallHot;
+  throw ConfigException("Unknown db column profile: " + profile);
+}
+
+std::string dbColumnProfileToString(DbColumnProfile profile) {
+  switch (profile) {
+    case DbColumnProfile::PointLookup:
+      return "point_lookup";
+    case DbColumnProfile::AppendOnly:
+      return "append_only";
+    case DbColumnProfile::SmallHot:
+      return "small_hot";
+    default:
+      return "default";
+  }
+}
+
 void dec_json(Json::Value const &json, DBConfig &db_config) {
   db_config.db_snapshot_each_n_pbft_block =
       getConfigDataAsUInt(json, {"db_snapshot_each_n_pbft_block"}, true, db_config.db_snapshot_each_n_pbft_block);
 
   db_config.db_max_snapshots = getConfigDataAsUInt(json, {"db_max_snapshots"}, true, db_config.db_max_snapshots);
   db_config.db_max_open_files = getConfigDataAsUInt(json, {"db_max_open_files"}, true, db_config.db_max_open_files);
+  db_config.group_commit_max_periods =
+      getConfigDataAsUInt(json, {"group_commit_max_periods"}, true, db_config.group_commit_max_periods);
+  db_config.logs_index = getConfigDataAsBoolean(json, {"logs_index"}, true, db_config.logs_index);
+  db_config.block_cache_size_mb =
+      getConfigDataAsUInt(json, {"block_cache_size_mb"}, true, db_config.block_cache_size_mb);
+  if (const auto profiles = getConfigData(json, {"column_profiles"}, true); !profiles.isNull()) {
+    for (const auto &column : profiles.getMemberNames()) {
+      db_config.column_profiles[column] = dbColumnProfileFromString(profiles[column].asString());
+    }
+  }
 }
 
 std::vector<logger::Config> FullNodeConfig::loadLoggingConfigs(const Json::Value &logging) {
@@ -72,6 +103,8 @@ void FullNodeConfig::overwriteConfigFromJson(const Json::Value &root) {
 
   final_chain_cache_in_blocks =
       getConfigDataAsUInt(root, {"final_chain_cache_in_blocks"}, true, final_chain_cache_in_blocks);
+  final_chain_cache_size_mb =
+      getConfigDataAsUInt(root, {"final_chain_cache_size_mb"}, true, final_chain_cache_size_mb);
 
   // config values that limits transactions and blocks memory pools
   transactions_pool_size = getConfigDataAsUInt(root, {"transactions_pool_size"}, true, kDefaultTransactionPoolSize);
@@ -183,6 +216,11 @@ void FullNodeConfig::validate() const {
     throw ConfigException("transactions_pool_size cannot be smaller than " + std::to_string(kMinTransactionPoolSize));
   }
 
+  // Light node prunes receipts history, so index would point to missing data
+  if (is_light_node && db_config.logs_index) {
+    throw ConfigException("db_config.logs_index can't be enabled on light node");
+  }
+
   // TODO: add validation of other config values
 }
 
@@ -217,6 +255,8 @@ std::ostream &operator<<(std::ostream &strm, const NetworkConfig &conf) {
   strm << "  ideal_peer_count: " << conf.ideal_peer_count << std::endl;
   strm << "  max_peer_count: " << conf.max_peer_count << std::endl;
   strm << "  sync_level_size: " << conf.sync_level_size << std::endl;
+  strm << "  sync_max_peers: " << conf.sync_max_peers << std::endl;
+  strm << "  sync_request_timeout_ms: " << conf.sync_request_timeout_ms << std::endl;
   strm << "  num_threads: " << conf.num_threads << std::endl;
   strm << "  packets_processing_threads: " << conf.packets_processing_threads << std::endl;
   strm << "  deep_syncing_threshold: " << conf.deep_syncing_threshold << std::endl;
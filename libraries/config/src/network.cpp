@@ -37,6 +37,13 @@ void dec_json(const Json::Value &json, ConnectionConfig &config) {
   if (auto threads_num = getConfigData(json, {"threads_num"}, true); !threads_num.isNull()) {
     config.threads_num = threads_num.asUInt();
   }
+
+  config.logs_query_threads = getConfigDataAsUInt(json, {"logs_query_threads"}, true, config.logs_query_threads);
+  config.logs_query_max_blocks = getConfigDataAsUInt(json, {"logs_query_max_blocks"}, true);
+  config.logs_query_max_results = getConfigDataAsUInt(json, {"logs_query_max_results"}, true);
+  config.batch_max_size = getConfigDataAsUInt(json, {"batch_max_size"}, true);
+  config.batch_timeout_ms = getConfigDataAsUInt(json, {"batch_timeout_ms"}, true);
+  config.stream_buffer_size = getConfigDataAsUInt(json, {"stream_buffer_size"}, true, config.stream_buffer_size);
 }
 
 void DdosProtectionConfig::validate(uint32_t delegation_delay) const {
@@ -91,6 +98,14 @@ void NetworkConfig::validate(uint32_t delegation_delay) const {
     throw ConfigException(std::string("network.sync_level_size cannot be 0"));
   }
 
+  if (sync_max_peers == 0) {
+    throw ConfigException(std::string("network.sync_max_peers cannot be 0"));
+  }
+
+  if (sync_request_timeout_ms == 0) {
+    throw ConfigException(std::string("network.sync_request_timeout_ms cannot be 0"));
+  }
+
   // Max enabled number of threads for processing rpc requests
   constexpr uint16_t MAX_PACKETS_PROCESSING_THREADS_NUM = 30;
   if (packets_processing_threads < 3 || packets_processing_threads > MAX_PACKETS_PROCESSING_THREADS_NUM) {
@@ -135,6 +150,9 @@ void dec_json(const Json::Value &json, NetworkConfig &network) {
   }
   network.max_peer_count = getConfigDataAsUInt(json, {"max_peer_count"});
   network.sync_level_size = getConfigDataAsUInt(json, {"sync_level_size"});
+  network.sync_max_peers = getConfigDataAsUInt(json, {"sync_max_peers"}, true, network.sync_max_peers);
+  network.sync_request_timeout_ms =
+      getConfigDataAsUInt(json, {"sync_request_timeout_ms"}, true, network.sync_request_timeout_ms);
   network.packets_processing_threads = getConfigDataAsUInt(json, {"packets_processing_threads"});
 
   // Packets processing threads performance is heart by too many threads processing same data from multiple peers, limit
@@ -1,17 +1,12 @@
 #pragma once
 
-#include <boost/function.hpp>
-#include <boost/graph/adjacency_list.hpp>
-#include <boost/graph/breadth_first_search.hpp>
-#include <boost/graph/depth_first_search.hpp>
-#include <boost/graph/graph_traits.hpp>
-#include <boost/graph/graphviz.hpp>
-#include <boost/graph/labeled_graph.hpp>
-#include <boost/graph/properties.hpp>
-#include <boost/property_map/property_map.hpp>
-#include <boost/thread.hpp>
 #include <iostream>
+#include <limits>
+#include <map>
 #include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
 
 #include "common/types.hpp"
 #include "logger/logger.hpp"
@@ -25,34 +20,15 @@ class DagManager;
 class Network;
 
 /**
- * @brief Thread safe. Labelled graph.
+ * @brief Not thread safe, protected by DagManager mutex. Compact graph of dag blocks.
+ *
+ * Vertices are identified by dense integer ids assigned in insertion order, hash of a vertex is resolved to its id
+ * only once through a side index. Children and parents of a vertex are stored as contiguous arrays of ids so that
+ * traversals do not chase hash map nodes.
  */
 class Dag {
  public:
-  // properties
-  using vertex_property_t =
-      boost::property<boost::vertex_index_t, blk_hash_t, boost::property<boost::vertex_index1_t, uint64_t>>;
-  using edge_property_t = boost::property<boost::edge_index_t, uint64_t>;
-
-  // graph def
-  using adj_list_t =
-      boost::adjacency_list<boost::setS, boost::hash_setS, boost::directedS, vertex_property_t, edge_property_t>;
-  using graph_t = boost::labeled_graph<adj_list_t, blk_hash_t, boost::hash_mapS>;
-  using vertex_t = boost::graph_traits<graph_t>::vertex_descriptor;
-  using edge_t = boost::graph_traits<graph_t>::edge_descriptor;
-  using vertex_iter_t = boost::graph_traits<graph_t>::vertex_iterator;
-  using edge_iter_t = boost::graph_traits<graph_t>::edge_iterator;
-  using vertex_adj_iter_t = boost::graph_traits<graph_t>::adjacency_iterator;
-
-  // property_map
-  using vertex_index_map_const_t = boost::property_map<graph_t, boost::vertex_index_t>::const_type;
-  using vertex_index_map_t = boost::property_map<graph_t, boost::vertex_index_t>::type;
-
-  using vertex_period_map_const_t = boost::property_map<graph_t, boost::vertex_index1_t>::const_type;
-  using vertex_period_map_t = boost::property_map<graph_t, boost::vertex_index1_t>::type;
-
-  using edge_index_map_const_t = boost::property_map<graph_t, boost::edge_index_t>::const_type;
-  using edge_index_map_t = boost::property_map<graph_t, boost::edge_index_t>::type;
+  using vertex_t = uint32_t;
 
   friend DagManager;
 
@@ -75,17 +51,41 @@ class Dag {
   bool computeOrder(const blk_hash_t &anchor, std::vector<blk_hash_t> &ordered_period_vertices,
                     const std::map<uint64_t, std::unordered_set<blk_hash_t>> &non_finalized_blks);
 
+  /**
+   * @brief Removes all vertices, allocated capacity is kept for the rebuild of the graph after period finalization
+   */
   void clear();
 
  protected:
   // Note: private functions does not lock
 
+  struct Vertex {
+    blk_hash_t hash;
+    // Edges are pointing from pivot/tips to the new vertex
+    std::vector<vertex_t> children;
+    std::vector<vertex_t> parents;
+    // Number of vertices in the subtree of the vertex including itself, maintained only by PivotTree
+    uint64_t weight = 1;
+  };
+
+  /**
+   * @param hash
+   * @return id of the vertex or kNullVertex if not in the graph
+   */
+  vertex_t getVertex(blk_hash_t const &hash) const;
+
+  virtual bool addEdge(vertex_t from, vertex_t to);
+
   // traverser API
   bool reachable(vertex_t const &from, vertex_t const &to) const;
 
   void collectLeafVertices(std::vector<vertex_t> &leaves) const;
 
-  graph_t graph_;
+  static constexpr vertex_t kNullVertex = std::numeric_limits<vertex_t>::max();
+
+  std::vector<Vertex> vertices_;
+  std::unordered_map<blk_hash_t, vertex_t> index_;
+  uint64_t edges_count_ = 0;
 
  protected:
   LOG_OBJECTS_DEFINE
@@ -108,45 +108,26 @@ class PivotTree : public Dag {
   PivotTree &operator=(const PivotTree &) = default;
   PivotTree &operator=(PivotTree &&) = default;
 
-  using Dag::vertex_adj_iter_t;
-  using Dag::vertex_index_map_const_t;
   using Dag::vertex_t;
 
+  /**
+   * @brief Subtree weights are maintained on insertion so GHOST path is collected by walking down from the vertex
+   * following the heaviest child, cost is proportional to the path length and not to the tree size
+   *
+   * @param vertex root of the path
+   * @return GHOST path
+   */
   std::vector<blk_hash_t> getGhostPath(const blk_hash_t &vertex) const;
+
+ protected:
+  /**
+   * @brief Adds edge and propagates weight of the subtree of the new child to all ancestors
+   */
+  bool addEdge(vertex_t from, vertex_t to) override;
 };
 class DagBuffer;
 class KeyManager;
 
-// for graphviz
-template <class Property1>
-class vertex_label_writer {
- public:
-  vertex_label_writer(Property1 name) : name(name) {}
-  template <class Vertex>
-  void operator()(std::ostream &out, const Vertex &v) const {
-    out << "[label=\"" << name[v].toString().substr(0, 8) << " " << "\"]";
-  }
-
- private:
-  Property1 name;
-};
-
-template <class Property>
-class edge_label_writer {
- public:
-  explicit edge_label_writer(Property weight) : weight(weight) {}
-  template <class Edge>
-  void operator()(std::ostream &out, const Edge &e) const {
-    if (weight[e] == 0) {
-      out << "[style=\"dashed\" dir=\"back\"]";
-    } else {
-      out << "[dir=\"back\"]";
-    }
-  }
-
- private:
-  Property weight;
-};
 /** @}*/
 
 }  // namespace taraxa
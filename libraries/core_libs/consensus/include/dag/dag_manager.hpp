@@ -73,6 +73,13 @@ class DagManager : public std::enable_shared_from_this<DagManager> {
    */
   std::shared_ptr<DagBlock> getDagBlock(const blk_hash_t &hash) const;
 
+  /**
+   * @brief Bulk version of getDagBlock, blocks missing in memory cache are read from db with batched lookups
+   * @param hashes Block hashes
+   * @return Blocks in the order of hashes, nullptr for blocks not found
+   */
+  std::vector<std::shared_ptr<DagBlock>> getDagBlocks(const std::vector<blk_hash_t> &hashes) const;
+
   /**
    * @brief Verifies new DAG block
    * @param blk Block to verify
@@ -1,7 +1,10 @@
 #pragma once
 
+#include <atomic>
 #include <functional>
+#include <list>
 #include <map>
+#include <memory>
 #include <mutex>
 #include <optional>
 #include <shared_mutex>
@@ -27,20 +30,197 @@ struct is_empty<std::vector<T>> {
 };
 }  // namespace
 
+/**
+ * @brief Cache counters, hits and misses count lookups in both cache levels
+ */
+struct CacheStats {
+  uint64_t hits = 0;
+  uint64_t misses = 0;
+  uint64_t evictions = 0;
+
+  CacheStats &operator+=(const CacheStats &other) {
+    hits += other.hits;
+    misses += other.misses;
+    evictions += other.evictions;
+    return *this;
+  }
+};
+
+/**
+ * @brief Byte budgeted cache with frequency based admission (TinyLFU) for values of blocks that are out of the recent
+ * blocks window of MapByBlockCache and ValueByBlockCache.
+ *
+ * Entries are split into shards by key hash, each shard has its own lock and keeps entries in LRU order. When the shard
+ * is full a new entry is admitted only if its key was accessed more often than the key of the LRU victim, so one-off
+ * scans of old blocks do not flush hot entries. Access frequencies are approximated by a count-min sketch of 4 bit
+ * counters which are halved periodically so old popularity fades out.
+ */
+template <class Key, class Value, class Hash = std::hash<Key>>
+class TinyLfuCache {
+ public:
+  using SizeFn = std::function<size_t(const Value &)>;
+
+  TinyLfuCache(const TinyLfuCache &) = delete;
+  TinyLfuCache(TinyLfuCache &&) = delete;
+  TinyLfuCache &operator=(const TinyLfuCache &) = delete;
+  TinyLfuCache &operator=(TinyLfuCache &&) = delete;
+
+  TinyLfuCache(size_t bytes_budget, SizeFn &&size_fn = {}, size_t shards_count = kDefaultShardsCount)
+      : shards_(std::max<size_t>(shards_count, 1)),
+        kShardBytesBudget(bytes_budget / shards_.size()),
+        size_fn_(std::move(size_fn)) {}
+
+  /**
+   * @brief Returns value if it is cached and records the access in frequency sketch
+   */
+  std::optional<Value> get(const Key &key) {
+    const auto hash = mix(Hash{}(key));
+    auto &shard = getShard(hash);
+    std::unique_lock lock(shard.mutex);
+    recordAccess(shard, hash);
+    auto entry = shard.entries.find(key);
+    if (entry == shard.entries.end()) {
+      return {};
+    }
+    shard.lru.splice(shard.lru.begin(), shard.lru, entry->second);
+    return entry->second->value;
+  }
+
+  /**
+   * @brief Inserts value if there is space in the shard or if the key is accessed more often than the LRU victim
+   */
+  void put(const Key &key, const Value &value) {
+    const auto bytes = kEntryOverhead + (size_fn_ ? size_fn_(value) : sizeof(Value));
+    if (bytes > kShardBytesBudget) {
+      return;
+    }
+
+    const auto hash = mix(Hash{}(key));
+    auto &shard = getShard(hash);
+    std::unique_lock lock(shard.mutex);
+    if (shard.entries.contains(key)) {
+      return;
+    }
+
+    if (shard.bytes + bytes > kShardBytesBudget) {
+      // Admission: candidate must be more popular than the entry it would replace
+      if (frequency(shard, hash) <= frequency(shard, mix(Hash{}(shard.lru.back().key)))) {
+        return;
+      }
+      while (shard.bytes + bytes > kShardBytesBudget) {
+        shard.bytes -= shard.lru.back().bytes;
+        shard.entries.erase(shard.lru.back().key);
+        shard.lru.pop_back();
+        evictions_++;
+      }
+    }
+
+    shard.lru.push_front({key, value, bytes});
+    shard.entries.emplace(key, shard.lru.begin());
+    shard.bytes += bytes;
+  }
+
+  uint64_t evictions() const { return evictions_; }
+
+  // Default number of shards
+  static constexpr size_t kDefaultShardsCount = 8;
+
+ protected:
+  struct Entry {
+    Key key;
+    Value value;
+    size_t bytes;
+  };
+
+  struct Shard {
+    std::mutex mutex;
+    std::list<Entry> lru;
+    std::unordered_map<Key, typename std::list<Entry>::iterator, Hash> entries;
+    size_t bytes = 0;
+    std::vector<uint8_t> sketch = std::vector<uint8_t>(kSketchDepth * kSketchWidth, 0);
+    size_t sketch_additions = 0;
+  };
+
+  static uint64_t mix(uint64_t h) {
+    // splitmix64 finalizer, spreads std::hash results which can be identity for integers
+    h = (h ^ (h >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    h = (h ^ (h >> 27)) * 0x94d049bb133111ebULL;
+    return h ^ (h >> 31);
+  }
+
+  static size_t sketchIndex(uint64_t hash, size_t row) {
+    return row * kSketchWidth + (mix(hash + row * 0x9e3779b97f4a7c15ULL) & (kSketchWidth - 1));
+  }
+
+  Shard &getShard(uint64_t hash) { return shards_[(hash >> 32) % shards_.size()]; }
+
+  void recordAccess(Shard &shard, uint64_t hash) {
+    for (size_t row = 0; row < kSketchDepth; ++row) {
+      auto &counter = shard.sketch[sketchIndex(hash, row)];
+      if (counter < kMaxFrequency) {
+        counter++;
+      }
+    }
+    // Aging
+    if (++shard.sketch_additions >= kSketchWidth * 10) {
+      for (auto &counter : shard.sketch) {
+        counter >>= 1;
+      }
+      shard.sketch_additions /= 2;
+    }
+  }
+
+  static uint8_t frequency(const Shard &shard, uint64_t hash) {
+    uint8_t freq = kMaxFrequency;
+    for (size_t row = 0; row < kSketchDepth; ++row) {
+      freq = std::min(freq, shard.sketch[sketchIndex(hash, row)]);
+    }
+    return freq;
+  }
+
+  static constexpr size_t kSketchDepth = 4;
+  static constexpr size_t kSketchWidth = 4096;
+  static constexpr uint8_t kMaxFrequency = 15;
+  // Approximate memory used by list and map nodes of an entry
+  static constexpr size_t kEntryOverhead = sizeof(Entry) + 64;
+
+  std::vector<Shard> shards_;
+  const size_t kShardBytesBudget;
+  SizeFn size_fn_;
+  std::atomic<uint64_t> evictions_ = 0;
+};
+
 template <class Key, class Value>
 class MapByBlockCache {
  public:
   using GetterFn = std::function<Value(uint64_t, const Key &)>;
   using ValueMap = std::unordered_map<Key, Value>;
   using DataMap = std::map<uint64_t, ValueMap>;
+  using BlockKey = std::pair<uint64_t, Key>;
+  struct BlockKeyHash {
+    size_t operator()(const BlockKey &k) const {
+      return std::hash<Key>{}(k.second) ^ (k.first * 0x9e3779b97f4a7c15ULL);
+    }
+  };
+  using HistoricalCache = TinyLfuCache<BlockKey, Value, BlockKeyHash>;
 
   MapByBlockCache(const MapByBlockCache &) = delete;
   MapByBlockCache(MapByBlockCache &&) = delete;
   MapByBlockCache &operator=(const MapByBlockCache &) = delete;
   MapByBlockCache &operator=(MapByBlockCache &&) = delete;
 
-  MapByBlockCache(uint64_t blocks_to_save, GetterFn &&getter_fn)
-      : kBlocksToKeep(blocks_to_save), getter_fn_(std::move(getter_fn)) {}
+  /**
+   * @param blocks_to_save number of recent blocks which values are all kept
+   * @param getter_fn
+   * @param historical_bytes byte budget for values of older blocks, 0 disables caching of older blocks
+   * @param size_fn approximate memory size of value
+   */
+  MapByBlockCache(uint64_t blocks_to_save, GetterFn &&getter_fn, size_t historical_bytes = 0,
+                  typename HistoricalCache::SizeFn &&size_fn = {})
+      : kBlocksToKeep(blocks_to_save),
+        getter_fn_(std::move(getter_fn)),
+        historical_(historical_bytes ? std::make_unique<HistoricalCache>(historical_bytes, std::move(size_fn))
+                                     : nullptr) {}
 
   void append(uint64_t block_num, const Key &key, const Value &value) const {
     std::unique_lock lock(mutex_);
@@ -64,23 +244,37 @@ class MapByBlockCache {
       if (blk_entry != data_by_block_.end()) {
         auto e = blk_entry->second.find(key);
         if (e != blk_entry->second.end()) {
+          hits_++;
           return e->second;
         }
       }
     }
 
+    // Old values are kept in historical cache only if they are accessed frequently
+    auto last_num = lastBlockNum();
+    const bool is_recent = last_num < kBlocksToKeep || blk_num >= last_num - kBlocksToKeep;
+    if (!is_recent && historical_) {
+      if (auto value = historical_->get({blk_num, key})) {
+        hits_++;
+        return std::move(*value);
+      }
+    }
+
+    misses_++;
     auto value = getter_fn_(blk_num, key);
     if (is_empty(value)) {
       return {};
     }
-    // Not save old values in cache
-    auto last_num = lastBlockNum();
-    if (last_num < kBlocksToKeep || blk_num >= last_num - kBlocksToKeep) {
+    if (is_recent) {
       append(blk_num, key, value);
+    } else if (historical_) {
+      historical_->put({blk_num, key}, value);
     }
     return value;
   }
 
+  CacheStats stats() const { return {hits_, misses_, historical_ ? historical_->evictions() : 0}; }
+
   uint64_t lastBlockNum() const {
     std::shared_lock lock(mutex_);
     if (data_by_block_.empty()) {
@@ -96,6 +290,9 @@ class MapByBlockCache {
   // cache is used from const methods in other class, so should be mutable
   mutable std::shared_mutex mutex_;
   mutable DataMap data_by_block_;
+  std::unique_ptr<HistoricalCache> historical_;
+  mutable std::atomic<uint64_t> hits_ = 0;
+  mutable std::atomic<uint64_t> misses_ = 0;
 };
 
 template <class Value>
@@ -103,14 +300,25 @@ class ValueByBlockCache {
  public:
   using GetterFn = std::function<Value(uint64_t)>;
   using DataMap = std::map<uint64_t, Value>;
+  using HistoricalCache = TinyLfuCache<uint64_t, Value>;
 
   ValueByBlockCache(const ValueByBlockCache &) = delete;
   ValueByBlockCache(ValueByBlockCache &&) = delete;
   ValueByBlockCache &operator=(const ValueByBlockCache &) = delete;
   ValueByBlockCache &operator=(ValueByBlockCache &&) = delete;
 
-  ValueByBlockCache(uint64_t blocks_to_save, GetterFn &&getter_fn)
-      : kBlocksToKeep(blocks_to_save), getter_fn_(std::move(getter_fn)) {}
+  /**
+   * @param blocks_to_save number of recent blocks which values are all kept
+   * @param getter_fn
+   * @param historical_bytes byte budget for values of older blocks, 0 disables caching of older blocks
+   * @param size_fn approximate memory size of value
+   */
+  ValueByBlockCache(uint64_t blocks_to_save, GetterFn &&getter_fn, size_t historical_bytes = 0,
+                    typename HistoricalCache::SizeFn &&size_fn = {})
+      : kBlocksToKeep(blocks_to_save),
+        getter_fn_(std::move(getter_fn)),
+        historical_(historical_bytes ? std::make_unique<HistoricalCache>(historical_bytes, std::move(size_fn))
+                                     : nullptr) {}
 
   void append(uint64_t block_num, Value value) const {
     std::unique_lock lock(mutex_);
@@ -123,10 +331,19 @@ class ValueByBlockCache {
   }
 
   std::optional<Value> getFromCache(uint64_t block_num) const {
-    std::shared_lock lock(mutex_);
-    auto blk_entry = data_by_block_.find(block_num);
-    if (blk_entry != data_by_block_.end()) {
-      return blk_entry->second;
+    {
+      std::shared_lock lock(mutex_);
+      auto blk_entry = data_by_block_.find(block_num);
+      if (blk_entry != data_by_block_.end()) {
+        hits_++;
+        return blk_entry->second;
+      }
+    }
+    if (historical_) {
+      if (auto value = historical_->get(block_num)) {
+        hits_++;
+        return value;
+      }
     }
     return {};
   }
@@ -137,18 +354,23 @@ class ValueByBlockCache {
       return *blk_entry;
     }
 
+    misses_++;
     auto value = getter_fn_(block_num);
     if (is_empty(value)) {
       return {};
     }
-    // Not save old values in cache
+    // Old values are kept in historical cache only if they are accessed frequently
     auto last_num = lastBlockNum();
     if (last_num < kBlocksToKeep || block_num >= last_num - kBlocksToKeep) {
       append(block_num, value);
+    } else if (historical_) {
+      historical_->put(block_num, value);
     }
     return value;
   }
 
+  CacheStats stats() const { return {hits_, misses_, historical_ ? historical_->evictions() : 0}; }
+
   Value last() const {
     std::shared_lock lock(mutex_);
     if (data_by_block_.empty()) {
@@ -172,6 +394,9 @@ class ValueByBlockCache {
   // cache is used from const methods in other class, so should be mutable
   mutable std::shared_mutex mutex_;
   mutable DataMap data_by_block_;
+  std::unique_ptr<HistoricalCache> historical_;
+  mutable std::atomic<uint64_t> hits_ = 0;
+  mutable std::atomic<uint64_t> misses_ = 0;
 };
 
 }  // namespace taraxa
\ No newline at end of file
@@ -18,6 +18,22 @@ namespace taraxa::final_chain {
  * @{
  */
 
+/**
+ * @brief Durations of the last finalized period split by finalization pipeline stages, in microseconds
+ */
+struct FinalizationStageTimings {
+  // Sender recovery and EVM transactions preparation, runs ahead of the execution of the previous period
+  std::atomic<uint64_t> prepare_us = 0;
+  // EVM execution of the period transactions
+  std::atomic<uint64_t> execute_us = 0;
+  // Receipts, blooms and tries construction, runs in parallel with rewards distribution
+  std::atomic<uint64_t> seal_us = 0;
+  // Rewards stats processing and distribution
+  std::atomic<uint64_t> rewards_us = 0;
+  // DB batch commit, state transition commit and rewards cleanup
+  std::atomic<uint64_t> commit_us = 0;
+};
+
 /**
  * @brief main responsibility is blocks execution in EVM, getting data from EVM state
  *
@@ -157,6 +173,47 @@ class FinalChain {
    */
   std::vector<EthBlockNumber> withBlockBloom(LogBloom const& b, EthBlockNumber from, EthBlockNumber to) const;
 
+  /**
+   * @brief Method used to search for contract logs matching any of bloom filters. The bloom index is walked level by
+   * level and chunks of each level are read with a single batched lookup
+   * @param blooms LogBloom possibilities
+   * @param from EthBlockNumber block to start search
+   * @param to EthBlockNumber block to end search
+   * @return sorted blocks that match at least one of specified bloom filters
+   */
+  std::vector<EthBlockNumber> withBlockBlooms(const std::vector<LogBloom>& blooms, EthBlockNumber from,
+                                              EthBlockNumber to) const;
+
+  /**
+   * @return true if logs are indexed by address and topic
+   */
+  bool hasLogsIndex() const { return kConfig.db_config.logs_index; }
+
+  /**
+   * @brief Methods to lookup logs index, locations are sorted
+   * @param from EthBlockNumber block to start search
+   * @param to EthBlockNumber block to end search
+   */
+  std::vector<LogLocation> logsByAddresses(const std::vector<Address>& addresses, EthBlockNumber from,
+                                           EthBlockNumber to) const;
+  std::vector<LogLocation> logsByTopics(const std::vector<h256>& topics, uint8_t topic_position, EthBlockNumber from,
+                                        EthBlockNumber to) const;
+
+  /**
+   * @brief Methods to get approximate number of logs index entries without reading them
+   */
+  uint64_t estimateLogsByAddresses(const std::vector<Address>& addresses, EthBlockNumber from,
+                                   EthBlockNumber to) const;
+  uint64_t estimateLogsByTopics(const std::vector<h256>& topics, uint8_t topic_position, EthBlockNumber from,
+                                EthBlockNumber to) const;
+
+  /**
+   * @param level level of bloom index
+   * @param index index of chunk on the level
+   * @return key of bloom index chunk
+   */
+  static h256 blockBloomsChunkId(EthBlockNumber level, EthBlockNumber index);
+
   /**
    * @brief Method to get account information
    * @see state_api::Account
@@ -243,6 +300,16 @@ class FinalChain {
    */
   void waitForFinalized();
 
+  /**
+   * @return durations of finalization pipeline stages for the last finalized period
+   */
+  const FinalizationStageTimings& stageTimings() const { return stage_timings_; }
+
+  /**
+   * @return hits, misses and evictions summed over all block caches
+   */
+  CacheStats cacheStats() const;
+
   std::vector<state_api::ValidatorStake> dposValidatorsTotalStakes(EthBlockNumber blk_num) const;
 
   uint256_t dposTotalAmountDelegated(EthBlockNumber blk_num) const;
@@ -281,9 +348,30 @@ class FinalChain {
   std::pair<val_t, bool> getBalance(addr_t const& addr) const;
   std::shared_ptr<const FinalizationResult> finalize_(PeriodData&& new_blk,
                                                       std::vector<h256>&& finalized_dag_blk_hashes,
-                                                      uint32_t blocks_per_year, std::shared_ptr<DagBlock>&& anchor);
+                                                      uint32_t blocks_per_year, std::shared_ptr<DagBlock>&& anchor,
+                                                      std::vector<state_api::EVMTransaction>&& prepared_evm_trxs = {});
 
   SharedTransactionReceipts blockReceipts(std::optional<EthBlockNumber> n = {}) const;
+  /**
+   * @brief Bulk version of blockReceipts. Blocks missing in cache are read with a single batched lookup and are not
+   * put into cache, so wide range scans don't evict recent blocks
+   * @param blocks block numbers
+   * @return receipts in the order of blocks
+   */
+  std::vector<SharedTransactionReceipts> blocksReceipts(const std::vector<EthBlockNumber>& blocks) const;
+  /**
+   * @brief Lazily decoded receipts of the block, read directly from the database and not cached. Preferable when only
+   * some of receipt fields are needed
+   * @param n block number, last block if absent
+   * @return receipts view or nullptr if block receipts are not stored by period
+   */
+  SharedBlockReceiptsView blockReceiptsView(std::optional<EthBlockNumber> n = {}) const;
+  /**
+   * @brief Bulk version of blockReceiptsView, blocks are read with a single batched lookup
+   * @param blocks block numbers
+   * @return receipts views in the order of blocks
+   */
+  std::vector<SharedBlockReceiptsView> blocksReceiptsViews(const std::vector<EthBlockNumber>& blocks) const;
 
  private:
   const SharedTransactions getTransactions(std::optional<EthBlockNumber> n = {}) const;
@@ -294,10 +382,9 @@ class FinalChain {
   EthBlockNumber lastIfAbsent(const std::optional<EthBlockNumber>& client_blk_n) const;
   static state_api::EVMTransaction toEvmTransaction(const SharedTransaction& trx);
   static void appendEvmTransactions(std::vector<state_api::EVMTransaction>& evm_trxs, const SharedTransactions& trxs);
+  std::vector<state_api::EVMTransaction> prepareEvmTransactions(const SharedTransactions& trxs);
   BlocksBlooms blockBlooms(const h256& chunk_id) const;
-  static h256 blockBloomsChunkId(EthBlockNumber level, EthBlockNumber index);
-  std::vector<EthBlockNumber> withBlockBloom(const LogBloom& b, EthBlockNumber from, EthBlockNumber to,
-                                             EthBlockNumber level, EthBlockNumber index) const;
+  std::vector<BlocksBlooms> blockBlooms(const std::vector<h256>& chunk_ids) const;
   bool isNeedToFinalize(EthBlockNumber blk_num) const;
 
   SharedTransaction makeBridgeFinalizationTransaction();
@@ -306,13 +393,28 @@ class FinalChain {
   std::shared_ptr<BlockHeader> makeGenesisHeader(std::string&& raw_header) const;
   std::shared_ptr<BlockHeader> makeGenesisHeader(const h256& state_root) const;
 
-  std::pair<h256, LogBloom> processReceipts(Batch& batch, EthBlockNumber blk_n, const TransactionReceipts& receipts);
+  /**
+   * @brief Part of the block data that depends only on transactions and receipts, so it could be built in parallel
+   * with rewards distribution
+   */
+  struct SealedBlockContent {
+    bytes receipts_rlp;
+    h256 receipts_root;
+    h256 transactions_root;
+    LogBloom log_bloom;
+    uint64_t gas_used = 0;
+  };
+  static SealedBlockContent sealBlockContent(const SharedTransactions& transactions,
+                                             const TransactionReceipts& receipts);
+
+  void processReceipts(Batch& batch, EthBlockNumber blk_n, const TransactionReceipts& receipts);
   std::shared_ptr<BlockHeader> appendBlock(Batch& batch, const PbftBlock& pbft_blk, const h256& state_root,
-                                           u256 total_reward, const SharedTransactions& transactions = {},
-                                           const TransactionReceipts& receipts = {});
+                                           u256 total_reward, SealedBlockContent&& content);
   std::shared_ptr<BlockHeader> appendBlock(Batch& batch, std::shared_ptr<BlockHeader> header,
                                            const SharedTransactions& transactions = {},
                                            const TransactionReceipts& receipts = {});
+  std::shared_ptr<BlockHeader> appendBlock(Batch& batch, std::shared_ptr<BlockHeader> header,
+                                           SealedBlockContent&& content);
 
  private:
   std::shared_ptr<DbStorage> db_;
@@ -321,8 +423,15 @@ class FinalChain {
   const uint32_t kMaxLevelsPerPeriod;
   rewards::Stats rewards_;
 
-  // It is not prepared to use more then 1 thread. Examine it if you want to change threads count
+  // Finalization pipeline: period N+1 is prepared on prepare_thread_ while period N is executed and committed on
+  // executor_thread_. Block content sealing runs on seal_thread_ in parallel with rewards distribution.
+  // It is not prepared to use more then 1 thread per stage. Examine it if you want to change threads count.
+  // Executor waits for seal tasks, so seal_thread_ is declared first to be destroyed last
+  boost::asio::thread_pool seal_thread_{1};
+  boost::asio::thread_pool prepare_thread_{1};
   boost::asio::thread_pool executor_thread_{1};
+  std::atomic_bool stopped_ = false;
+  FinalizationStageTimings stage_timings_;
 
   std::atomic<uint64_t> num_executed_dag_blk_ = 0;
   std::atomic<uint64_t> num_executed_trx_ = 0;
@@ -1,6 +1,8 @@
 #pragma once
 
+#include <future>
 #include <thread>
+#include <unordered_set>
 
 #include "common/types.hpp"
 #include "config/config.hpp"
@@ -575,15 +577,52 @@ class PbftManager {
    */
   std::optional<std::pair<PeriodData, std::vector<std::shared_ptr<PbftVote>>>> processPeriodData();
 
+  /**
+   * @brief Chain independent validation results of synced period data, see prevalidateSyncedPeriods
+   */
+  struct SyncedPeriodPrevalidation {
+    // Queued block the results belong to, compared by identity as refilled queue can bring the same block with
+    // different period data
+    std::shared_ptr<PbftBlock> pbft_block;
+    std::future<void> done;
+    // Previous block cert votes with already verified signature and vrf proof
+    std::unordered_set<std::shared_ptr<PbftVote>> verified_votes;
+    // Transactions included in dag blocks but not in period data, they must have been finalized before
+    std::vector<trx_hash_t> finalized_transactions_to_check;
+    bool invalid_transactions = false;
+  };
+
+  /**
+   * @brief Schedules validation of upcoming periods in the syncing queue on sync_thread_pool_. Signatures, vrf proofs
+   *        and transactions lists do not depend on execution of the previous periods, so they are validated ahead in
+   *        parallel while the chain dependent checks in processPeriodData stay sequential
+   */
+  void prevalidateSyncedPeriods();
+
+  /**
+   * @brief Waits until prevalidation of the period is done, period data must not be accessed before that
+   * @param period
+   * @return prevalidation results or nullptr if period was not prevalidated
+   */
+  std::shared_ptr<SyncedPeriodPrevalidation> waitSyncedPeriodPrevalidation(PbftPeriod period);
+
+  /**
+   * @param period_data
+   * @return transactions included in period data dag blocks, which are not part of period data transactions
+   */
+  static std::vector<trx_hash_t> getFinalizedTransactionsToCheck(const PeriodData &period_data);
+
   /**
    * @brief Validates PBFT block cert votes
    * @param pbft_block
    * @param cert_votes
+   * @param verified_votes cert votes with signature and vrf proof already verified ahead
    *
    * @return true if there is enough(2t+1) votes and all of them are valid, otherwise false
    */
   bool validatePbftBlockCertVotes(const std::shared_ptr<PbftBlock> pbft_block,
-                                  const std::vector<std::shared_ptr<PbftVote>> &cert_votes) const;
+                                  const std::vector<std::shared_ptr<PbftVote>> &cert_votes,
+                                  const std::unordered_set<std::shared_ptr<PbftVote>> *verified_votes = nullptr) const;
 
   /**
    @brief Validates PBFT block pillar votes
@@ -638,7 +677,14 @@ class PbftManager {
 
   const uint32_t kSyncingThreadPoolSize;
   std::shared_ptr<util::ThreadPool>
-      sync_thread_pool_;  // Thread pool used for transaction sender retrieval in syncing blocks
+      sync_thread_pool_;  // Thread pool used for prevalidation of syncing blocks
+
+  // Strict validation is done for all cert votes of every kFullVoteValidationInterval period
+  static constexpr uint32_t kFullVoteValidationInterval = 100;
+  // Max number of synced periods validated ahead of processing
+  const size_t kMaxPrevalidatedSyncedPeriods;
+  // Prevalidation of periods in sync_queue_, accessed only by the thread pushing synced blocks into chain
+  std::map<PbftPeriod, std::shared_ptr<SyncedPeriodPrevalidation>> synced_periods_prevalidations_;
 
   const std::chrono::milliseconds kMaxExponentialLambda{60000};  // [ms], max lambda is 1 minute
 
@@ -67,6 +67,14 @@ class PeriodDataQueue {
    */
   std::shared_ptr<PbftBlock> lastPbftBlock() const;
 
+  /**
+   * @brief Get copies of queued period data, e.g. to validate them ahead of processing
+   * @param from_period first period to be returned
+   * @param max_count max number of returned period data
+   * @return period data with peer node ID ordered by period
+   */
+  std::vector<std::pair<PeriodData, dev::p2p::NodeID>> getPeriodsData(uint64_t from_period, size_t max_count) const;
+
   /**
    * @brief Clean any old blocks below current period
    * @param period current period
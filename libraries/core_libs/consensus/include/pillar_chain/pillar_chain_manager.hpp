@@ -3,6 +3,7 @@
 #include <memory>
 
 #include "common/event.hpp"
+#include "common/thread_pool.hpp"
 #include "final_chain/data.hpp"
 #include "logger/logger.hpp"
 #include "pillar_chain/pillar_block.hpp"
@@ -90,6 +91,15 @@ class PillarChainManager {
    */
   bool validatePillarVote(const std::shared_ptr<PillarVote> vote) const;
 
+  /**
+   * @brief Validates batch of pillar votes, e.g. votes bundle received from a peer. Signers are recovered from
+   *        signatures in parallel before the uniqueness & eligibility checks, which need the signer
+   *
+   * @param votes
+   * @return validation result for each vote in the same order as votes, see validatePillarVote
+   */
+  std::vector<bool> validatePillarVotes(const std::vector<std::shared_ptr<PillarVote>>& votes) const;
+
   /**
    * @return true if block_hash is the latest finalized pillar block
    */
@@ -108,6 +118,14 @@ class PillarChainManager {
    */
   uint64_t addVerifiedPillarVote(const std::shared_ptr<PillarVote>& vote);
 
+  /**
+   * @brief Add multiple votes to the pillar votes map, see addVerifiedPillarVote
+   * @param votes votes
+   *
+   * @return weight of each vote in the same order as votes, 0 for votes that were not added
+   */
+  std::vector<uint64_t> addVerifiedPillarVotes(const std::vector<std::shared_ptr<PillarVote>>& votes);
+
   /**
    * @brief Finalize pillar block
    *
@@ -167,6 +185,22 @@ class PillarChainManager {
   void saveNewPillarBlock(const std::shared_ptr<PillarBlock>& pillar_block,
                           std::vector<state_api::ValidatorVoteCount>&& new_vote_counts);
 
+  /**
+   * @brief Validates pillar vote except of its signature - vote uniqueness and validator eligibility
+   *
+   * @param vote
+   * @return true if valid, otherwise false
+   */
+  bool validatePillarVoteVoter(const std::shared_ptr<PillarVote>& vote) const;
+
+  /**
+   * @brief Gets validator vote count for pillar vote and initializes vote period data if needed
+   *
+   * @param vote
+   * @return validator vote count, 0 if vote cannot be added
+   */
+  uint64_t getPillarVoteWeight(const std::shared_ptr<PillarVote>& vote);
+
  private:
   // Node config
   const FicusHardforkConfig& kFicusHfConfig;
@@ -192,6 +226,11 @@ class PillarChainManager {
   // Protects last_finalized_pillar_block_ & current_pillar_block_
   mutable std::shared_mutex mutex_;
 
+  // Recovers signers of pillar votes bundles in parallel
+  mutable util::ThreadPool votes_validation_thread_pool_;
+  // Smaller batches are verified in caller thread as it is faster than passing it to thread pool
+  const size_t kMinVotesForParallelValidation = 16;
+
   LOG_OBJECTS_DEFINE
 };
 
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <memory>
+#include <set>
 #include <shared_mutex>
 
 #include "vote/pillar_vote.hpp"
@@ -11,6 +12,8 @@ class PillarVotes {
  public:
   struct WeightVotes {
     std::unordered_map<vote_hash_t, std::pair<std::shared_ptr<PillarVote>, uint64_t /* vote weight */>> votes;
+    // Votes ordered by weight, so that above threshold votes are collected without sorting all of them
+    std::set<std::pair<uint64_t /* vote weight */, vote_hash_t>, std::greater<>> by_weight;
     uint64_t weight{0};  // votes accumulated weight
   };
 
@@ -64,6 +67,14 @@ class PillarVotes {
    */
   bool addVerifiedVote(const std::shared_ptr<PillarVote>& vote, uint64_t validator_vote_count);
 
+  /**
+   * @brief Add multiple votes to the votes map under single lock
+   * @param votes votes with their validators vote counts
+   *
+   * @return result of addVerifiedVote for each vote in the same order as votes
+   */
+  std::vector<bool> addVerifiedVotes(const std::vector<std::pair<std::shared_ptr<PillarVote>, uint64_t>>& votes);
+
   /**
    * @brief Get all pillar block votes for specified pillar block
    *
@@ -84,6 +95,9 @@ class PillarVotes {
    */
   void eraseVotes(PbftPeriod min_period);
 
+ private:
+  bool addVerifiedVoteUnsafe(const std::shared_ptr<PillarVote>& vote, uint64_t validator_vote_count);
+
  private:
   // Votes for latest_pillar_block_.period - 1, latest_pillar_block_.period and potential +1 future pillar
   // block period
@@ -0,0 +1,54 @@
+#pragma once
+
+#include <boost/circular_buffer.hpp>
+#include <optional>
+#include <shared_mutex>
+
+#include "transaction/transaction.hpp"
+
+namespace taraxa {
+
+/** @addtogroup Transaction
+ * @{
+ */
+
+/**
+ * @brief Bounded log of hashes of proposable transactions newly inserted into the pool. Every announcement gets a
+ * sequence number so that gossip can keep a cursor per peer and walk only the transactions inserted since the last
+ * round instead of the whole pool. Only hashes are kept so the log does not hold transactions already dropped from the
+ * pool. Oldest announcements are overwritten once the log is full
+ */
+class TransactionAnnouncementLog {
+ public:
+  explicit TransactionAnnouncementLog(size_t capacity);
+
+  /**
+   * @brief Appends newly inserted transaction to the log
+   * @param trx_hash transaction hash
+   */
+  void announce(const trx_hash_t &trx_hash);
+
+  /**
+   * @return sequence number of the next announcement, sequence numbers start at 1
+   */
+  uint64_t head() const;
+
+  /**
+   * @brief Gets announced transactions hashes starting at specified sequence number
+   * @param sequence sequence number of the first transaction to return
+   * @param max_count max number of transactions to return
+   * @return transactions hashes in announcement order, std::nullopt if the announcements at sequence were already
+   * overwritten
+   */
+  std::optional<std::vector<trx_hash_t>> since(uint64_t sequence, size_t max_count) const;
+
+ private:
+  mutable std::shared_mutex mutex_;
+  boost::circular_buffer<trx_hash_t> announcements_;
+  // Sequence number of the next announcement
+  uint64_t head_ = 1;
+};
+
+/** @}*/
+
+}  // namespace taraxa
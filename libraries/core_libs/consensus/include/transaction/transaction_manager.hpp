@@ -9,6 +9,7 @@
 #include "logger/logger.hpp"
 #include "storage/storage.hpp"
 #include "transaction/transaction.hpp"
+#include "transaction/transaction_announcement_log.hpp"
 #include "transaction_queue.hpp"
 
 namespace taraxa {
@@ -73,12 +74,16 @@ class TransactionManager : public std::enable_shared_from_this<TransactionManage
   state_api::ExecutionResult estimateTransactionGas(std::shared_ptr<Transaction> trx, PbftPeriod proposal_period);
 
   /**
-   * @brief Gets transactions from pool to include in the block with specified weight limit
+   * @brief Gets transactions from pool to include in the block with specified weight limit. Pool is iterated in
+   * priority order only until the weight limit is reached
    * @param proposal_period proposal period
    * @param weight_limit weight limit
+   * @param filter optional filter, only transactions for which it returns true are packed
    * @return transactions and weight estimations
    */
-  std::pair<SharedTransactions, std::vector<uint64_t>> packTrxs(PbftPeriod proposal_period, uint64_t weight_limit);
+  std::pair<SharedTransactions, std::vector<uint64_t>> packTrxs(
+      PbftPeriod proposal_period, uint64_t weight_limit,
+      const std::function<bool(const SharedTransaction &)> &filter = {});
 
   /**
    * @brief Gets all transactions from pool grouped per account
@@ -86,6 +91,18 @@ class TransactionManager : public std::enable_shared_from_this<TransactionManage
    */
   std::vector<SharedTransactions> getAllPoolTrxs();
 
+  /**
+   * @brief Gets log of transactions newly inserted into the pool, used to gossip only new transactions
+   * @return announcement log
+   */
+  const TransactionAnnouncementLog &getAnnouncementLog() const { return announcement_log_; }
+
+  /**
+   * @param trx_hash transaction hash
+   * @return transaction if it is still in transactions pool, nullptr otherwise
+   */
+  SharedTransaction getPooledTransaction(const trx_hash_t &trx_hash) const;
+
   /**
    * Saves transactions from dag block which was added to the DAG. Removes transactions from memory pool
    */
@@ -243,6 +260,9 @@ class TransactionManager : public std::enable_shared_from_this<TransactionManage
   val_t getMinGasPriceForBlockInclusion() const;
 
   std::shared_ptr<Transaction> getTransaction(const trx_hash_t &hash) const;
+  // Bulk version of getTransaction, transactions not in memory are read from db in a single batch, nullptr for
+  // transactions not found
+  SharedTransactions getTransactionsByHashes(const vec_trx_t &hashes) const;
   std::shared_ptr<Transaction> getNonFinalizedTransaction(const trx_hash_t &hash) const;
   unsigned long getTransactionCount() const;
   void recoverNonfinalizedTransactions();
@@ -258,6 +278,14 @@ class TransactionManager : public std::enable_shared_from_this<TransactionManage
    */
   std::pair<bool, std::string> verifyTransaction(const std::shared_ptr<Transaction> &trx) const;
 
+  /**
+   * @brief Recovers senders of transactions in parallel, so that signatures recovery is not done one by one by
+   * verifyTransaction or under transactions pool lock
+   *
+   * @param trxs transactions
+   */
+  void recoverSenders(const SharedTransactions &trxs);
+
  private:
   addr_t getFullNodeAddress() const;
 
@@ -268,6 +296,7 @@ class TransactionManager : public std::enable_shared_from_this<TransactionManage
   // 1. In transactions pool; 2. In non-finalized Dag block 3. Executed
   mutable std::shared_mutex transactions_mutex_;
   TransactionQueue transactions_pool_;
+  TransactionAnnouncementLog announcement_log_;
   std::unordered_map<trx_hash_t, std::shared_ptr<Transaction>> nonfinalized_transactions_in_dag_;
   std::unordered_map<trx_hash_t, std::shared_ptr<Transaction>> recently_finalized_transactions_;
   std::unordered_map<PbftPeriod, std::vector<trx_hash_t>> recently_finalized_transactions_per_period_;
@@ -277,11 +306,14 @@ class TransactionManager : public std::enable_shared_from_this<TransactionManage
   const uint64_t kDagBlockGasLimit;
   const uint64_t kEstimateGasLimit = 200000;
   const uint64_t kRecentlyFinalizedTransactionsMax = 50000;
+  // Senders of smaller batches are recovered in caller thread as it is faster than passing it to thread pool
+  const size_t kMinTransactionsForParallelRecovery = 16;
 
   std::shared_ptr<DbStorage> db_{nullptr};
   std::shared_ptr<final_chain::FinalChain> final_chain_{nullptr};
 
   util::ThreadPool estimation_thread_pool_;
+  util::ThreadPool senders_recovery_thread_pool_;
 
   LOG_OBJECTS_DEFINE
 
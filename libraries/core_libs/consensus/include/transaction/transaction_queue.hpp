@@ -1,5 +1,12 @@
 #pragma once
 
+#include <atomic>
+#include <functional>
+#include <mutex>
+#include <set>
+#include <shared_mutex>
+#include <unordered_map>
+
 #include "common/constants.hpp"
 #include "common/util.hpp"
 #include "transaction/transaction.hpp"
@@ -23,13 +30,26 @@ class FinalChain;
  * transactions. Non proposable transactions can expire if no DAG block that contains them is received within the
  * kNonProposableTransactionsPeriodExpiryLimit.
  *
- * This is NOT thread safe class. It is proteced only by transactions_mutex_
- * in the TransactionsManager !!!
+ * Transactions are sharded by sender account into kDefaultShardsCount shards, each protected by its own lock, so
+ * inserts of transactions from different accounts do not serialize on a single mutex. All transactions of an account
+ * live in the same shard which keeps nonce ordering and per account limits local to a single shard. Calls that need
+ * the whole pool (ordering, min gas price) lock all shards in a fixed order. Lookups by hash go through a separate
+ * index sharded by transaction hash, so contains and get take a single index shard lock.
+ *
+ * This class is thread safe. transactions_mutex_ in the TransactionsManager only synchronizes the pool with the
+ * non finalized and recently finalized transactions !!!
  *
  */
 class TransactionQueue {
  public:
-  TransactionQueue(std::shared_ptr<final_chain::FinalChain> final_chain, size_t max_size = kMinTransactionPoolSize);
+  // Default number of shards the pool is split into
+  static constexpr size_t kDefaultShardsCount = 16;
+
+  // Position of an ordered iteration: nonce of the next transaction of each account with consumed transactions
+  using OrderedIterationPosition = std::unordered_map<addr_t, val_t>;
+
+  TransactionQueue(std::shared_ptr<final_chain::FinalChain> final_chain, size_t max_size = kMinTransactionPoolSize,
+                   size_t shards_count = kDefaultShardsCount);
 
   /**
    * @brief insert a transaction into the queue, sorted by priority
@@ -66,6 +86,19 @@ class TransactionQueue {
    */
   std::vector<std::shared_ptr<Transaction>> getOrderedTransactions(uint64_t count) const;
 
+  /**
+   * @brief iterates over transactions in the same order as getOrderedTransactions. Accounts are kept ordered by the
+   * gas price of their lowest nonce transaction so only the transactions consumed by the callback are ordered, which
+   * allows the caller to stop early once it has enough transactions. All shards are locked for reading during the
+   * iteration so callback must not call back into the queue
+   *
+   * @param callback returns false to stop the iteration, transaction for which it returns false is not consumed
+   * @param position optional position, iteration resumes after the transactions consumed by previous iterations with
+   *        the same position and records the transactions consumed by this one
+   */
+  void forEachOrderedTransaction(const std::function<bool(const SharedTransaction&)>& callback,
+                                 OrderedIterationPosition* position = nullptr) const;
+
   /**
    * @brief returns all transactions grouped by transactions author
    *
@@ -123,7 +156,7 @@ class TransactionQueue {
    * @return Returns true if txs were dropped
    */
   bool transactionsDropped() const {
-    return std::chrono::system_clock::now() - transaction_overflow_time_ < kTransactionOverflowTimeLimit;
+    return std::chrono::system_clock::now() - transaction_overflow_time_.load() < kTransactionOverflowTimeLimit;
   }
 
   /**
@@ -142,51 +175,149 @@ class TransactionQueue {
   val_t getMinGasPriceForBlockInclusion(uint64_t limit) const;
 
  private:
+  using NonProposableTransactions = std::unordered_map<trx_hash_t, std::pair<uint64_t, SharedTransaction>>;
+  using AccountTransactions = std::map<val_t, SharedTransaction>;
+  // Accounts ordered by the gas price of their lowest nonce transaction
+  using AccountHeads = std::set<std::pair<val_t, addr_t>, std::greater<std::pair<val_t, addr_t>>>;
+
+  /**
+   * @brief Part of the pool holding transactions of the accounts that hash into it
+   */
+  struct Shard {
+    mutable std::shared_mutex mutex;
+
+    // Transactions in the shard per account ordered by nonce
+    std::unordered_map<addr_t, AccountTransactions> account_nonce_transactions;
+
+    // Accounts of the shard ordered by the gas price of their lowest nonce transaction
+    AccountHeads account_heads;
+
+    // Transactions in the shard per trx hash
+    std::unordered_map<trx_hash_t, SharedTransaction> queue_transactions;
+
+    // Amount of gas per gas prices in the shard
+    std::map<val_t, uint64_t, std::greater<val_t>> queue_transactions_gas_prices;
+
+    // Low nonce and insufficient balance transactions which should not be included in proposed dag blocks but it is
+    // possible because of dag reordering that some dag block might arrive requiring these transactions.
+    NonProposableTransactions non_proposable_transactions;
+  };
+
+  /**
+   * @brief Part of the hash index holding the pooled transactions whose hash falls into it
+   */
+  struct HashIndexShard {
+    mutable std::shared_mutex mutex;
+    std::unordered_map<trx_hash_t, SharedTransaction> transactions;
+  };
+
+  /**
+   * @param sender
+   * @return shard that keeps transactions of the sender
+   */
+  Shard& getShard(const addr_t& sender);
+
   /**
-   * @brief add transaction to queue
+   * @param hash
+   * @return hash index shard that keeps the transaction with the hash
+   */
+  HashIndexShard& getHashIndexShard(const trx_hash_t& hash) const;
+
+  /**
+   * @brief add transaction to hash index, called with the sender shard lock held so the index follows the shards
    *
    * @param transaction
+   */
+  void indexTransaction(const SharedTransaction& transaction);
+
+  /**
+   * @brief remove transaction from hash index, called with the sender shard lock held
+   *
+   * @param hash
+   */
+  void unindexTransaction(const trx_hash_t& hash);
+
+  /**
+   * @brief add transaction to shard, shard lock must be held
+   *
+   * @param shard
+   * @param transaction
    * @param proposable
    */
-  void addTransaction(const SharedTransaction& transaction, bool proposable, uint64_t last_block_number = 0);
+  void addTransaction(Shard& shard, const SharedTransaction& transaction, bool proposable,
+                      uint64_t last_block_number = 0);
 
   /**
-   * @brief remove transaction from queue
+   * @brief remove transaction from shard, shard lock must be held
    *
+   * @param shard
    * @param transaction
    * @return true if removed
    */
-  bool removeTransaction(const SharedTransaction& transaction, bool proposable);
+  bool removeTransaction(Shard& shard, const SharedTransaction& transaction, bool proposable);
 
   /**
-   * @brief remove transaction from non proposable transactions
+   * @brief remove transaction from non proposable transactions, shard lock must be held
    *
+   * @param shard
+   * @param transaction
+   * @return iterator following the removed transaction
+   */
+  NonProposableTransactions::iterator removeTransaction(Shard& shard, NonProposableTransactions::iterator transaction);
+
+  /**
+   * @brief remove transaction from shard including its account nonce entry, shard lock must be held
+   *
+   * @param shard
    * @param transaction
    * @return true if removed
    */
-  std::unordered_map<taraxa::trx_hash_t, std::pair<uint64_t, taraxa::SharedTransaction>>::iterator removeTransaction(
-      std::unordered_map<taraxa::trx_hash_t, std::pair<uint64_t, taraxa::SharedTransaction>>::iterator transaction);
+  bool eraseFromShard(Shard& shard, const SharedTransaction& transaction);
+
+  /**
+   * @brief remove account from account heads, must be called before the lowest nonce transaction of the account changes
+   *
+   * @param shard
+   * @param sender
+   * @param account_transactions
+   */
+  static void eraseAccountHead(Shard& shard, const addr_t& sender, const AccountTransactions& account_transactions);
+
+  /**
+   * @brief add account to account heads, must be called after the lowest nonce transaction of the account changes
+   *
+   * @param shard
+   * @param sender
+   * @param account_transactions
+   */
+  static void addAccountHead(Shard& shard, const addr_t& sender, const AccountTransactions& account_transactions);
+
+  /**
+   * @brief If queue is bigger than max size, 1% of the transactions with the lowest priority are dropped
+   */
+  void trimQueue();
+
+  std::vector<Shard> shards_;
 
-  // Transactions in the queue per account ordered by nonce
-  std::unordered_map<addr_t, std::map<val_t, std::shared_ptr<Transaction>>> account_nonce_transactions_;
+  // Index of all transactions in shards_ by hash, index shard lock is always taken after the sender shard lock
+  mutable std::vector<HashIndexShard> hash_index_;
 
-  // Transactions in the queue per trx hash
-  std::unordered_map<trx_hash_t, std::shared_ptr<Transaction>> queue_transactions_;
+  // Number of proposable transactions in all shards
+  std::atomic<size_t> size_ = 0;
 
-  // Amount of gas per gas prices in queue
-  std::map<val_t, uint64_t, std::greater<val_t>> queue_transactions_gas_prices_;
+  // Number of non proposable transactions in all shards
+  std::atomic<size_t> non_proposable_size_ = 0;
 
-  // Low nonce and insufficient balance transactions which should not be included in proposed dag blocks but it is
-  // possible because of dag reordering that some dag block might arrive requiring these transactions.
-  std::unordered_map<trx_hash_t, std::pair<uint64_t, std::shared_ptr<Transaction>>> non_proposable_transactions_;
+  // Serializes trimming of the queue when it reaches max size
+  std::mutex trim_mutex_;
 
   ExpirationCache<trx_hash_t> known_txs_;
 
   // Last time transactions were dropped due to queue reaching max size
-  std::chrono::system_clock::time_point transaction_overflow_time_;
+  std::atomic<std::chrono::system_clock::time_point> transaction_overflow_time_;
 
   // Size of data for transactions in pool
-  size_t data_size_ = 0;
+  std::atomic<size_t> data_size_ = 0;
 
   // If transactions are dropped within last kTransactionOverflowTimeLimit seconds, dag blocks with missing transactions
   // will not be treated as malicious
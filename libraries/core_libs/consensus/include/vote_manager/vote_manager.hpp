@@ -1,5 +1,6 @@
 #pragma once
 
+#include "common/thread_pool.hpp"
 #include "common/util.hpp"
 #include "common/vrf_wrapper.hpp"
 #include "final_chain/final_chain.hpp"
@@ -185,9 +186,43 @@ class VoteManager {
    *
    * @param vote to be validated
    * @param strict strict validation
+   * @param vrf_verified vrf proof was already verified by preverifyVote with the same strict flag
    * @return <true, ""> vote validation passed, otherwise <false, "err msg">
    */
-  std::pair<bool, std::string> validateVote(const std::shared_ptr<PbftVote>& vote, bool strict = true) const;
+  std::pair<bool, std::string> validateVote(const std::shared_ptr<PbftVote>& vote, bool strict = true,
+                                            bool vrf_verified = false) const;
+
+  /**
+   * @brief Verifies vote signature and vrf proof, which do not depend on the dpos state, so it can be done ahead of
+   *        validateVote, e.g. for synced votes still waiting in the queue. Vrf proof is verified only if vrf key of the
+   *        voter is cached or can be read from the dpos state, which is not available for periods not executed yet
+   *
+   * @param vote to be verified
+   * @param strict strict validation
+   * @return true if both signature and vrf proof were verified, otherwise validateVote needs to do full validation
+   */
+  bool preverifyVote(const std::shared_ptr<PbftVote>& vote, bool strict = true) const;
+
+  /**
+   * @brief Validates batch of votes, e.g. votes bundle received from a peer. Voters are recovered from signatures in
+   *        parallel first, then dpos values are fetched only once per period and voter and vrf proofs are verified in
+   *        parallel
+   *
+   * @param votes to be validated
+   * @param strict strict validation
+   * @return validation result for each vote in the same order as votes, see validateVote. Empty optional for votes
+   *         that were already validated before or are duplicated in votes
+   */
+  std::vector<std::optional<std::pair<bool, std::string>>> validateVotes(
+      const std::vector<std::shared_ptr<PbftVote>>& votes, bool strict = true) const;
+
+  /**
+   * @brief Recovers voters of votes from their signatures in parallel, so later getVoter/getVoterAddr calls only read
+   *        the cached voter
+   *
+   * @param votes
+   */
+  void recoverVoters(const std::vector<std::shared_ptr<PbftVote>>& votes) const;
 
   /**
    * @brief Get 2t+1. 2t+1 is 2/3 of PBFT sortition threshold and plus 1 for a specific period
@@ -315,6 +350,11 @@ class VoteManager {
   // It is used as protection against ddos attack so we do no validate/process vote more than once
   mutable ExpirationCache<vote_hash_t> already_validated_votes_;
 
+  // Recovers voters & verifies vrf proofs of votes bundles in parallel
+  mutable util::ThreadPool votes_validation_thread_pool_;
+  // Smaller batches are verified in caller thread as it is faster than passing it to thread pool
+  const size_t kMinVotesForParallelValidation = 16;
+
   LOG_OBJECTS_DEFINE
 };
 
@@ -10,8 +10,6 @@
 #include <utility>
 #include <vector>
 
-#include "dag/dag.hpp"
-
 namespace taraxa {
 
 Dag::Dag(blk_hash_t const &dag_genesis_block_hash, addr_t node_addr) {
@@ -21,39 +19,55 @@ Dag::Dag(blk_hash_t const &dag_genesis_block_hash, addr_t node_addr) {
   addVEEs(dag_genesis_block_hash, {}, tips);
 }
 
-uint64_t Dag::getNumVertices() const { return boost::num_vertices(graph_); }
-uint64_t Dag::getNumEdges() const { return boost::num_edges(graph_); }
+uint64_t Dag::getNumVertices() const { return vertices_.size(); }
+uint64_t Dag::getNumEdges() const { return edges_count_; }
+
+bool Dag::hasVertex(blk_hash_t const &v) const { return index_.contains(v); }
 
-bool Dag::hasVertex(blk_hash_t const &v) const { return graph_.vertex(v) != graph_.null_vertex(); }
+Dag::vertex_t Dag::getVertex(blk_hash_t const &hash) const {
+  if (const auto it = index_.find(hash); it != index_.end()) {
+    return it->second;
+  }
+  return kNullVertex;
+}
 
 void Dag::getLeaves(std::vector<blk_hash_t> &tips) const {
-  vertex_index_map_const_t index_map = boost::get(boost::vertex_index, graph_);
   std::vector<vertex_t> leaves;
   collectLeafVertices(leaves);
   std::transform(leaves.begin(), leaves.end(), std::back_inserter(tips),
-                 [index_map](const vertex_t &leaf) { return index_map[leaf]; });
+                 [this](const vertex_t &leaf) { return vertices_[leaf].hash; });
+}
+
+bool Dag::addEdge(vertex_t from, vertex_t to) {
+  auto &children = vertices_[from].children;
+  // No multiple edges between the same vertices
+  if (std::find(children.begin(), children.end(), to) != children.end()) {
+    return false;
+  }
+  children.push_back(to);
+  vertices_[to].parents.push_back(from);
+  edges_count_++;
+  return true;
 }
 
 bool Dag::addVEEs(blk_hash_t const &new_vertex, blk_hash_t const &pivot, std::vector<blk_hash_t> const &tips) {
   assert(!new_vertex.isZero());
 
   // add vertex
-  vertex_t ret = add_vertex(new_vertex, graph_);
-  boost::get(boost::vertex_index, graph_)[ret] = new_vertex;
-  // TODO do we need this?
-  // edge_index_map_t weight_map = boost::get(boost::edge_index, graph_);
+  const auto [it, inserted] = index_.emplace(new_vertex, vertices_.size());
+  const vertex_t ret = it->second;
+  if (inserted) {
+    vertices_.push_back({new_vertex, {}, {}});
+  }
 
-  edge_t edge;
   bool res = true;
 
   // Note: add edges,
   // *** important
   // Add a new block, edges are pointing from pivot to new_vertex
   if (!pivot.isZero()) {
-    if (hasVertex(pivot)) {
-      std::tie(edge, res) = boost::add_edge_by_label(pivot, new_vertex, graph_);
-      // TODO do we need this?
-      // weight_map[edge] = 1;
+    if (const auto pivot_vertex = getVertex(pivot); pivot_vertex != kNullVertex) {
+      res = addEdge(pivot_vertex, ret);
       if (!res) {
         LOG(log_wr_) << "Creating pivot edge \n" << pivot << "\n-->\n" << new_vertex << " \nunsuccessful!" << std::endl;
       }
@@ -61,10 +75,8 @@ bool Dag::addVEEs(blk_hash_t const &new_vertex, blk_hash_t const &pivot, std::ve
   }
   bool res2 = true;
   for (auto const &e : tips) {
-    if (hasVertex(e)) {
-      std::tie(edge, res2) = boost::add_edge_by_label(e, new_vertex, graph_);
-      // TODO do we need this?
-      // weight_map[edge] = 0;
+    if (const auto tip_vertex = getVertex(e); tip_vertex != kNullVertex) {
+      res2 = addEdge(tip_vertex, ret);
       if (!res2) {
         LOG(log_wr_) << "Creating tip edge \n" << e << "\n-->\n" << new_vertex << " \nunsuccessful!" << std::endl;
       }
@@ -76,24 +88,33 @@ bool Dag::addVEEs(blk_hash_t const &new_vertex, blk_hash_t const &pivot, std::ve
 
 void Dag::drawGraph(std::string const &filename) const {
   std::ofstream outfile(filename.c_str());
-  auto index_map = boost::get(boost::vertex_index, graph_);
-  auto weight_map = boost::get(boost::edge_index, graph_);
-
-  boost::write_graphviz(outfile, graph_, vertex_label_writer(index_map), edge_label_writer(weight_map));
+  outfile << "digraph G {" << std::endl;
+  for (vertex_t v = 0; v < vertices_.size(); ++v) {
+    outfile << v << "[label=\"" << vertices_[v].hash.toString().substr(0, 8) << " " << "\"];" << std::endl;
+  }
+  for (vertex_t v = 0; v < vertices_.size(); ++v) {
+    for (const auto child : vertices_[v].children) {
+      outfile << v << "->" << child << " [style=\"dashed\" dir=\"back\"];" << std::endl;
+    }
+  }
+  outfile << "}" << std::endl;
   std::cout << "Dot file " << filename << " generated!" << std::endl;
   std::cout << "Use \"dot -Tpdf <dot file> -o <pdf file>\" to generate pdf file" << std::endl;
 }
 
-void Dag::clear() { graph_ = graph_t(); }
+void Dag::clear() {
+  vertices_.clear();
+  index_.clear();
+  edges_count_ = 0;
+}
 
 void Dag::collectLeafVertices(std::vector<vertex_t> &leaves) const {
   leaves.clear();
-  vertex_iter_t s, e;
   // iterator all vertex
-  for (std::tie(s, e) = boost::vertices(graph_); s != e; ++s) {
+  for (vertex_t v = 0; v < vertices_.size(); ++v) {
     // if out-degree zero, leaf node
-    if (boost::out_degree(*s, graph_) == 0) {
-      leaves.emplace_back(*s);
+    if (vertices_[v].children.empty()) {
+      leaves.emplace_back(v);
     }
   }
   assert(leaves.size());
@@ -102,61 +123,78 @@ void Dag::collectLeafVertices(std::vector<vertex_t> &leaves) const {
 // only iterate through non finalized blocks
 bool Dag::computeOrder(const blk_hash_t &anchor, std::vector<blk_hash_t> &ordered_period_vertices,
                        const std::map<uint64_t, std::unordered_set<blk_hash_t>> &non_finalized_blks) {
-  vertex_t target = graph_.vertex(anchor);
+  const vertex_t target = getVertex(anchor);
 
-  if (target == graph_.null_vertex()) {
+  if (target == kNullVertex) {
     LOG(log_wr_) << "Dag::ComputeOrder cannot find vertex (anchor) " << anchor << "\n";
     return false;
   }
   ordered_period_vertices.clear();
 
-  vertex_iter_t s, e;
-  vertex_index_map_t index_map = boost::get(boost::vertex_index, graph_);  // from vertex_descriptor to hash
-  std::map<blk_hash_t, vertex_t> epfriend;                                 // this is unordered epoch
-  epfriend[index_map[target]] = target;
-
   // Step 1: collect all epoch blks that can reach anchor
-  // Erase from recent_added_blks after mark epoch number if finalized
+  // All vertices that can reach anchor are found in a single traversal of parent edges from the anchor
+  std::vector<bool> reaches_target(vertices_.size(), false);
+  std::stack<vertex_t> st;
+  st.push(target);
+  reaches_target[target] = true;
+  while (!st.empty()) {
+    const auto v = st.top();
+    st.pop();
+    for (const auto parent : vertices_[v].parents) {
+      if (!reaches_target[parent]) {
+        reaches_target[parent] = true;
+        st.push(parent);
+      }
+    }
+  }
 
+  std::vector<bool> in_epoch(vertices_.size(), false);
+  std::vector<std::pair<blk_hash_t, vertex_t>> epfriend;  // this is unordered epoch
+  epfriend.emplace_back(anchor, target);
+  in_epoch[target] = true;
   for (auto &l : non_finalized_blks) {
     for (auto &blk : l.second) {
-      auto v = graph_.vertex(blk);
-      if (reachable(v, target)) {
-        epfriend[index_map[v]] = v;
+      const auto v = getVertex(blk);
+      if (v != kNullVertex && reaches_target[v] && !in_epoch[v]) {
+        in_epoch[v] = true;
+        epfriend.emplace_back(blk, v);
       }
     }
   }
+  // Epoch is traversed ordered by hash to keep the order deterministic
+  std::sort(epfriend.begin(), epfriend.end());
+
   // Step2: compute topological order of epfriend
-  std::unordered_set<vertex_t> visited;
+  std::vector<bool> visited(vertices_.size(), false);
   std::stack<std::pair<vertex_t, bool>> dfs;
-  vertex_adj_iter_t adj_s, adj_e;
+  std::vector<std::pair<blk_hash_t, vertex_t>> neighbors;
 
   for (auto const &vp : epfriend) {
     auto const &v = vp.second;
-    if (visited.count(v)) {
+    if (visited[v]) {
       continue;
     }
     dfs.push({v, false});
-    visited.insert(v);
+    visited[v] = true;
     while (!dfs.empty()) {
       auto cur = dfs.top();
       dfs.pop();
       if (cur.second) {
-        ordered_period_vertices.emplace_back(index_map[cur.first]);
+        ordered_period_vertices.emplace_back(vertices_[cur.first].hash);
         continue;
       }
       dfs.push({cur.first, true});
-      std::vector<std::pair<blk_hash_t, vertex_t>> neighbors;
+      neighbors.clear();
       // iterate through neighbors
-      for (std::tie(adj_s, adj_e) = boost::adjacent_vertices(cur.first, graph_); adj_s != adj_e; adj_s++) {
-        if (epfriend.find(index_map[*adj_s]) == epfriend.end()) {  // not in this epoch
+      for (const auto child : vertices_[cur.first].children) {
+        if (!in_epoch[child]) {  // not in this epoch
           continue;
         }
-        if (visited.count(*adj_s)) {
+        if (visited[child]) {
           continue;
         }
-        neighbors.emplace_back(std::make_pair(index_map[*adj_s], *adj_s));
-        visited.insert(*adj_s);
+        neighbors.emplace_back(vertices_[child].hash, child);
+        visited[child] = true;
       }
       // make sure iterated nodes have deterministic order
       std::sort(neighbors.begin(), neighbors.end());
@@ -172,92 +210,66 @@ bool Dag::computeOrder(const blk_hash_t &anchor, std::vector<blk_hash_t> &ordere
 // dfs
 bool Dag::reachable(vertex_t const &from, vertex_t const &to) const {
   if (from == to) return true;
-  vertex_t current = from;
-  vertex_t target = to;
   std::stack<vertex_t> st;
-  std::set<vertex_t> visited;
-  st.push(current);
-  visited.insert(current);
+  std::vector<bool> visited(vertices_.size(), false);
+  st.push(from);
+  visited[from] = true;
 
   while (!st.empty()) {
     vertex_t t = st.top();
     st.pop();
-    vertex_adj_iter_t s, e;
-    for (std::tie(s, e) = boost::adjacent_vertices(t, graph_); s != e; ++s) {
-      if (visited.count(*s)) continue;
-      if (*s == target) return true;
-      visited.insert(*s);
-      st.push(*s);
+    for (const auto child : vertices_[t].children) {
+      if (visited[child]) continue;
+      if (child == to) return true;
+      visited[child] = true;
+      st.push(child);
     }
   }
   return false;
 }
 
-/**
- * Iterative version
- * Steps rounds
- * 1. post order traversal
- * 2. from leave, count weight and propagate up
- * 3. collect path
- */
+bool PivotTree::addEdge(vertex_t from, vertex_t to) {
+  if (!Dag::addEdge(from, to)) {
+    return false;
+  }
+
+  // Every vertex has only pivot as parent so ancestors form a single chain up to the root
+  assert(vertices_[to].parents.size() == 1);
+  const auto weight = vertices_[to].weight;
+  for (auto v = from;; v = vertices_[v].parents.front()) {
+    vertices_[v].weight += weight;
+    if (vertices_[v].parents.empty()) {
+      break;
+    }
+  }
+  return true;
+}
 
 std::vector<blk_hash_t> PivotTree::getGhostPath(const blk_hash_t &vertex) const {
-  vertex_t root = graph_.vertex(vertex);
+  vertex_t root = getVertex(vertex);
 
-  if (root == graph_.null_vertex()) {
+  if (root == kNullVertex) {
     LOG(log_wr_) << "Cannot find vertex (getGhostPath) " << vertex << std::endl;
     return {};
   }
 
   std::vector<blk_hash_t> pivot_chain;
-  std::vector<vertex_t> post_order;
-
-  // first step: post order traversal
-  std::stack<vertex_t> st;
-  st.emplace(root);
-  vertex_t cur;
-  vertex_adj_iter_t s, e;
-  while (!st.empty()) {
-    cur = st.top();
-    st.pop();
-    post_order.emplace_back(cur);
-    for (std::tie(s, e) = boost::adjacent_vertices(cur, graph_); s != e; s++) {
-      st.emplace(*s);
-    }
-  }
-  std::reverse(post_order.begin(), post_order.end());
-
-  // second step: compute weight based on step one
-  std::unordered_map<vertex_t, size_t> weight_map;
-  for (auto const &n : post_order) {
-    auto total_w = 0;
-    // get childrens
-    for (std::tie(s, e) = boost::adjacent_vertices(n, graph_); s != e; s++) {
-      if (weight_map.count(*s)) {  // bigger timestamp
-        total_w += weight_map[*s];
-      }
-    }
-    weight_map[n] = total_w + 1;
-  }
-
-  vertex_index_map_const_t index_map = boost::get(boost::vertex_index, graph_);
 
-  // third step: collect path
+  // collect path following the heaviest subtree
   while (1) {
-    pivot_chain.emplace_back(index_map[root]);
-    size_t heavist = 0;
+    pivot_chain.emplace_back(vertices_[root].hash);
+    uint64_t heavist = 0;
     vertex_t next = root;
 
-    for (std::tie(s, e) = boost::adjacent_vertices(root, graph_); s != e; s++) {
-      if (!weight_map.count(*s)) continue;  // bigger timestamp
-      size_t w = weight_map[*s];
+    for (const auto child : vertices_[root].children) {
+      const auto w = vertices_[child].weight;
       assert(w > 0);
       if (w > heavist) {
         heavist = w;
-        next = *s;
+        next = child;
       } else if (w == heavist) {
-        if (index_map[*s] < index_map[next]) {
-          next = *s;
+        if (vertices_[child].hash < vertices_[next].hash) {
+          next = child;
         }
       }
     }
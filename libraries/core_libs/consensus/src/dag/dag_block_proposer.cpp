@@ -256,27 +256,19 @@ std::pair<SharedTransactions, std::vector<uint64_t>> DagBlockProposer::getSharde
 
   if (total_trx_shards_ == 1) return trx_mgr_->packTrxs(proposal_period, weight_limit);
 
-  auto [transactions, estimations] = trx_mgr_->packTrxs(proposal_period, weight_limit);
-
-  if (transactions.empty()) {
-    LOG(log_tr_) << "Skip block proposer, zero unpacked transactions ..." << std::endl;
-    return {};
-  }
-  SharedTransactions sharded_trxs;
-  std::vector<uint64_t> sharded_estimations;
-  for (uint32_t i = 0; i < transactions.size(); i++) {
-    auto shard = std::stoull(transactions[i]->getSender().toString().substr(0, 10), NULL, 16) +
-                 proposal_period / kShardProposePeriodInterval;
-    if (shard % total_trx_shards_ == node_trx_shard) {
-      sharded_trxs.emplace_back(transactions[i]);
-      sharded_estimations.emplace_back(estimations[i]);
-    }
-  }
+  // Shard is checked while iterating the pool so that only transactions of this node shard are estimated and fill the
+  // weight limit
+  auto [sharded_trxs, sharded_estimations] =
+      trx_mgr_->packTrxs(proposal_period, weight_limit, [&](const SharedTransaction& trx) {
+        auto shard = std::stoull(trx->getSender().toString().substr(0, 10), NULL, 16) +
+                     proposal_period / kShardProposePeriodInterval;
+        return shard % total_trx_shards_ == node_trx_shard;
+      });
   if (sharded_trxs.empty()) {
     LOG(log_tr_) << "Skip block proposer, zero sharded transactions ..." << std::endl;
     return {};
   }
-  return {sharded_trxs, sharded_estimations};
+  return {std::move(sharded_trxs), std::move(sharded_estimations)};
 }
 
 level_t DagBlockProposer::getProposeLevel(blk_hash_t const& pivot, vec_blk_t const& tips) const {
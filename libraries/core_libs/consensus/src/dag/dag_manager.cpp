@@ -529,18 +529,24 @@ DagManager::getNonFinalizedBlocksWithTransactions(const std::unordered_set<blk_h
   std::vector<std::shared_ptr<DagBlock>> dag_blocks;
   std::unordered_set<trx_hash_t> unique_trxs;
   std::vector<trx_hash_t> trx_to_query;
+  std::vector<blk_hash_t> blocks_to_query;
   for (const auto &level_blocks : non_finalized_blks_) {
     for (const auto &hash : level_blocks.second) {
       if (known_hashes.count(hash) == 0) {
-        if (auto blk = getDagBlock(hash); blk) {
-          dag_blocks.emplace_back(blk);
-        } else {
-          LOG(log_er_) << "NonFinalizedBlock " << hash << " not in DB";
-          assert(false);
-        }
+        blocks_to_query.push_back(hash);
       }
     }
   }
+  auto blocks = getDagBlocks(blocks_to_query);
+  dag_blocks.reserve(blocks.size());
+  for (size_t i = 0; i < blocks.size(); ++i) {
+    if (blocks[i]) {
+      dag_blocks.emplace_back(std::move(blocks[i]));
+    } else {
+      LOG(log_er_) << "NonFinalizedBlock " << blocks_to_query[i] << " not in DB";
+      assert(false);
+    }
+  }
   for (const auto &block : dag_blocks) {
     for (auto trx : block->getTrxs()) {
       if (unique_trxs.emplace(trx).second) {
@@ -735,6 +741,29 @@ std::shared_ptr<DagBlock> DagManager::getDagBlock(const blk_hash_t &hash) const
   return db_->getDagBlock(hash);
 }
 
+std::vector<std::shared_ptr<DagBlock>> DagManager::getDagBlocks(const std::vector<blk_hash_t> &hashes) const {
+  std::vector<std::shared_ptr<DagBlock>> ret(hashes.size());
+  std::vector<blk_hash_t> to_load;
+  std::vector<size_t> to_load_pos;
+  for (size_t i = 0; i < hashes.size(); ++i) {
+    if (auto blk = seen_blocks_.get(hashes[i]); blk.second) {
+      ret[i] = std::move(blk.first);
+    } else if (hashes[i] == genesis_block_->getHash()) {
+      ret[i] = genesis_block_;
+    } else {
+      to_load.push_back(hashes[i]);
+      to_load_pos.push_back(i);
+    }
+  }
+  if (!to_load.empty()) {
+    auto loaded = db_->getDagBlocks(to_load);
+    for (size_t i = 0; i < loaded.size(); ++i) {
+      ret[to_load_pos[i]] = std::move(loaded[i]);
+    }
+  }
+  return ret;
+}
+
 dev::bytes DagManager::getVdfMessage(blk_hash_t const &hash, SharedTransactions const &trxs) {
   dev::RLPStream s;
   s << hash;
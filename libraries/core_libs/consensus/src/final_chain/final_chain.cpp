@@ -1,7 +1,9 @@
 #include "final_chain/final_chain.hpp"
 
+#include <libdevcore/Common.h>
 #include <libdevcore/RLP.h>
 
+#include <chrono>
 #include <utility>
 
 #include "common/encoding_solidity.hpp"
@@ -14,6 +16,46 @@
 #include "transaction/system_transaction.hpp"
 
 namespace taraxa::final_chain {
+
+namespace {
+uint64_t elapsedUs(const std::chrono::steady_clock::time_point& since) {
+  return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - since).count();
+}
+
+// Historical cache budget shares in percents of final_chain_cache_size_mb
+constexpr size_t kHeadersCacheShare = 10;
+constexpr size_t kTransactionsCacheShare = 35;
+constexpr size_t kReceiptsCacheShare = 35;
+constexpr size_t kAccountsCacheShare = 20;
+
+size_t cacheBudget(const FullNodeConfig& config, size_t share) {
+  return size_t(config.final_chain_cache_size_mb) * 1024 * 1024 * share / 100;
+}
+
+size_t headerSize(const std::shared_ptr<const BlockHeader>& header) {
+  return sizeof(BlockHeader) + header->extra_data.size();
+}
+
+size_t transactionsSize(const SharedTransactions& trxs) {
+  size_t size = sizeof(SharedTransactions);
+  for (const auto& trx : trxs) {
+    size += sizeof(Transaction) + trx->getData().size();
+  }
+  return size;
+}
+
+size_t receiptsSize(const SharedTransactionReceipts& receipts) {
+  size_t size = sizeof(TransactionReceipts);
+  for (const auto& receipt : *receipts) {
+    size += sizeof(TransactionReceipt);
+    for (const auto& log : receipt.logs) {
+      size += sizeof(LogEntry) + log.topics.size() * sizeof(h256) + log.data.size();
+    }
+  }
+  return size;
+}
+}  // namespace
+
 FinalChain::FinalChain(const std::shared_ptr<DbStorage>& db, const taraxa::FullNodeConfig& config,
                        const addr_t& node_addr)
     : db_(db),
@@ -28,13 +70,19 @@ FinalChain::FinalChain(const std::shared_ptr<DbStorage>& db, const taraxa::FullN
           config.genesis.pbft.committee_size, config.genesis.state.hardforks, db_,
           [this](EthBlockNumber n) { return dposEligibleTotalVoteCount(n); },
           state_api_.get_last_committed_state_descriptor().blk_num),
-      block_headers_cache_(config.final_chain_cache_in_blocks, [this](uint64_t blk) { return getBlockHeader(blk); }),
+      block_headers_cache_(
+          config.final_chain_cache_in_blocks, [this](uint64_t blk) { return getBlockHeader(blk); },
+          cacheBudget(config, kHeadersCacheShare), headerSize),
       block_hashes_cache_(config.final_chain_cache_in_blocks, [this](uint64_t blk) { return getBlockHash(blk); }),
-      transactions_cache_(config.final_chain_cache_in_blocks, [this](uint64_t blk) { return getTransactions(blk); }),
+      transactions_cache_(
+          config.final_chain_cache_in_blocks, [this](uint64_t blk) { return getTransactions(blk); },
+          cacheBudget(config, kTransactionsCacheShare), transactionsSize),
       transaction_hashes_cache_(config.final_chain_cache_in_blocks,
                                 [this](uint64_t blk) { return getTransactionHashes(blk); }),
-      accounts_cache_(config.final_chain_cache_in_blocks,
-                      [this](uint64_t blk, const addr_t& addr) { return state_api_.get_account(blk, addr); }),
+      accounts_cache_(
+          config.final_chain_cache_in_blocks,
+          [this](uint64_t blk, const addr_t& addr) { return state_api_.get_account(blk, addr); },
+          cacheBudget(config, kAccountsCacheShare)),
       total_vote_count_cache_(config.final_chain_cache_in_blocks,
                               [this](uint64_t blk) { return state_api_.dpos_eligible_total_vote_count(blk); }),
       dpos_vote_count_cache_(
@@ -43,7 +91,9 @@ FinalChain::FinalChain(const std::shared_ptr<DbStorage>& db, const taraxa::FullN
       dpos_is_eligible_cache_(
           config.final_chain_cache_in_blocks,
           [this](uint64_t blk, const addr_t& addr) { return state_api_.dpos_is_eligible(blk, addr); }),
-      block_receipts_cache_(config.final_chain_cache_in_blocks, [this](uint64_t blk) { return getBlockReceipts(blk); }),
+      block_receipts_cache_(
+          config.final_chain_cache_in_blocks, [this](uint64_t blk) { return getBlockReceipts(blk); },
+          cacheBudget(config, kReceiptsCacheShare), receiptsSize),
       kConfig(config) {
   LOG_OBJECTS_CREATE("EXECUTOR");
   num_executed_dag_blk_ = db_->getStatusField(taraxa::StatusDbField::ExecutedBlkCount);
@@ -60,6 +110,13 @@ FinalChain::FinalChain(const std::shared_ptr<DbStorage>& db, const taraxa::FullN
     last_block_number_ = header->number;
     db_->commitWriteBatch(batch);
   } else {
+    // Period batches are synced before the state commit, so state db can be ahead only if the db was damaged. It could
+    // be restored only from the snapshot
+    if (*last_blk_num < state_db_descriptor.blk_num) [[unlikely]] {
+      throw std::runtime_error("State db period " + std::to_string(state_db_descriptor.blk_num) +
+                               " is ahead of final chain period " + std::to_string(*last_blk_num) +
+                               ". Revert to the latest snapshot before this period with --revert-to-period");
+    }
     // We need to recover latest changes as there was shutdown inside finalize function
     if (*last_blk_num != state_db_descriptor.blk_num) [[unlikely]] {
       auto batch = db_->createWriteBatch();
@@ -94,24 +151,70 @@ FinalChain::FinalChain(const std::shared_ptr<DbStorage>& db, const taraxa::FullN
   delegation_delay_ = config.genesis.state.dpos.delegation_delay;
 }
 
-void FinalChain::stop() { executor_thread_.join(); }
+void FinalChain::stop() {
+  // Periods executed after stop was requested seal their content inline, so they never wait for joined seal_thread_
+  stopped_ = true;
+  // Prepare stage posts into executor, so it should be stopped first
+  prepare_thread_.join();
+  executor_thread_.join();
+  seal_thread_.join();
+}
 
 std::future<std::shared_ptr<const FinalizationResult>> FinalChain::finalize(
     PeriodData&& new_blk, std::vector<h256>&& finalized_dag_blk_hashes, uint32_t blocks_per_year,
     std::shared_ptr<DagBlock>&& anchor) {
   auto p = std::make_shared<std::promise<std::shared_ptr<const FinalizationResult>>>();
-  boost::asio::post(executor_thread_,
-                    [this, new_blk = std::move(new_blk), finalized_dag_blk_hashes = std::move(finalized_dag_blk_hashes),
-                     anchor_block = std::move(anchor), blocks_per_year, p]() mutable {
-                      p->set_value(finalize_(std::move(new_blk), std::move(finalized_dag_blk_hashes), blocks_per_year,
-                                             std::move(anchor_block)));
-                      finalized_cv_.notify_one();
-                    });
+  // Prepare stage does not depend on the state, so it runs ahead while previous period is being executed. Both stages
+  // are single threaded, so periods order is preserved
+  boost::asio::post(prepare_thread_, [this, new_blk = std::move(new_blk),
+                                      finalized_dag_blk_hashes = std::move(finalized_dag_blk_hashes),
+                                      anchor_block = std::move(anchor), blocks_per_year, p]() mutable {
+    const auto prepare_start = std::chrono::steady_clock::now();
+    auto evm_trxs = prepareEvmTransactions(new_blk.transactions);
+    const auto prepare_us = elapsedUs(prepare_start);
+    boost::asio::post(executor_thread_, [this, new_blk = std::move(new_blk),
+                                         finalized_dag_blk_hashes = std::move(finalized_dag_blk_hashes),
+                                         anchor_block = std::move(anchor_block), evm_trxs = std::move(evm_trxs),
+                                         blocks_per_year, prepare_us, p]() mutable {
+      // Next period could be already prepared, so the timing is set together with the other stages of this period
+      stage_timings_.prepare_us = prepare_us;
+      p->set_value(finalize_(std::move(new_blk), std::move(finalized_dag_blk_hashes), blocks_per_year,
+                             std::move(anchor_block), std::move(evm_trxs)));
+      finalized_cv_.notify_one();
+    });
+  });
   return p->get_future();
 }
 
+std::vector<state_api::EVMTransaction> FinalChain::prepareEvmTransactions(const SharedTransactions& trxs) {
+  std::vector<state_api::EVMTransaction> evm_trxs;
+  evm_trxs.reserve(trxs.size());
+  try {
+    appendEvmTransactions(evm_trxs, trxs);
+  } catch (const Transaction::InvalidSignature& e) {
+    // Leave it to the execution stage, it is handled there the same way as without pipelining
+    LOG(log_er_) << "Failed to prepare transactions for execution: " << e.what();
+    evm_trxs.clear();
+  }
+  return evm_trxs;
+}
+
 EthBlockNumber FinalChain::delegationDelay() const { return delegation_delay_; }
 
+CacheStats FinalChain::cacheStats() const {
+  CacheStats stats;
+  stats += block_headers_cache_.stats();
+  stats += block_hashes_cache_.stats();
+  stats += transactions_cache_.stats();
+  stats += transaction_hashes_cache_.stats();
+  stats += accounts_cache_.stats();
+  stats += total_vote_count_cache_.stats();
+  stats += dpos_vote_count_cache_.stats();
+  stats += dpos_is_eligible_cache_.stats();
+  stats += block_receipts_cache_.stats();
+  return stats;
+}
+
 SharedTransaction FinalChain::makeBridgeFinalizationTransaction() {
   const static auto finalize_method = util::EncodingSolidity::packFunctionCall("finalizeEpoch()");
   auto account = getAccount(kTaraxaSystemAccount).value_or(state_api::ZeroAccount);
@@ -149,10 +252,9 @@ std::vector<SharedTransaction> FinalChain::makeSystemTransactions(PbftPeriod blk
   return system_transactions;
 }
 
-std::shared_ptr<const FinalizationResult> FinalChain::finalize_(PeriodData&& new_blk,
-                                                                std::vector<h256>&& finalized_dag_blk_hashes,
-                                                                uint32_t blocks_per_year,
-                                                                std::shared_ptr<DagBlock>&& anchor) {
+std::shared_ptr<const FinalizationResult> FinalChain::finalize_(
+    PeriodData&& new_blk, std::vector<h256>&& finalized_dag_blk_hashes, uint32_t blocks_per_year,
+    std::shared_ptr<DagBlock>&& anchor, std::vector<state_api::EVMTransaction>&& prepared_evm_trxs) {
   auto batch = db_->createWriteBatch();
 
   block_applying_emitter_.emit(blockHeader()->number + 1);
@@ -178,9 +280,14 @@ std::shared_ptr<const FinalizationResult> FinalChain::finalize_(PeriodData&& new
 
   auto all_transactions = new_blk.transactions;
   all_transactions.insert(all_transactions.end(), system_transactions.begin(), system_transactions.end());
-  std::vector<state_api::EVMTransaction> evm_trxs;
-  appendEvmTransactions(evm_trxs, all_transactions);
+  auto evm_trxs = std::move(prepared_evm_trxs);
+  if (evm_trxs.size() != new_blk.transactions.size()) {
+    evm_trxs.clear();
+    appendEvmTransactions(evm_trxs, new_blk.transactions);
+  }
+  appendEvmTransactions(evm_trxs, system_transactions);
 
+  auto stage_start = std::chrono::steady_clock::now();
   const auto& [exec_results] = state_api_.execute_transactions(
       {new_blk.pbft_blk->getBeneficiary(), kBlockGasLimit, new_blk.pbft_blk->getTimestamp(), BlockHeader::difficulty()},
       evm_trxs);
@@ -205,10 +312,36 @@ std::shared_ptr<const FinalizationResult> FinalChain::finalize_(PeriodData&& new
     });
   }
 
+  stage_timings_.execute_us = elapsedUs(stage_start);
+
+  // Receipts and transactions tries do not depend on the rewards distribution, so they are built in parallel with it
+  std::packaged_task<SealedBlockContent()> seal_task([this, &all_transactions, &receipts] {
+    const auto seal_start = std::chrono::steady_clock::now();
+    auto content = sealBlockContent(all_transactions, receipts);
+    stage_timings_.seal_us = elapsedUs(seal_start);
+    return content;
+  });
+  auto sealed_content = seal_task.get_future();
+  // Seal task references locals of this frame, so it must finish before the frame unwinds, e.g. when rewards
+  // distribution throws
+  dev::ScopeGuard wait_for_seal([&sealed_content] {
+    if (sealed_content.valid()) {
+      sealed_content.wait();
+    }
+  });
+  if (stopped_) {
+    seal_task();
+  } else {
+    boost::asio::post(seal_thread_, [&seal_task] { seal_task(); });
+  }
+
+  stage_start = std::chrono::steady_clock::now();
   auto rewards_stats = rewards_.processStats(new_blk, blocks_per_year, transactions_gas_used, batch);
   const auto& [state_root, total_reward] = state_api_.distribute_rewards(rewards_stats);
+  stage_timings_.rewards_us = elapsedUs(stage_start);
 
-  auto blk_header = appendBlock(batch, *new_blk.pbft_blk, state_root, total_reward, all_transactions, receipts);
+  auto blk_header = appendBlock(batch, *new_blk.pbft_blk, state_root, total_reward, sealed_content.get());
+  processReceipts(batch, blk_header->number, receipts);
 
   // Update number of executed DAG blocks and transactions
   auto num_executed_dag_blk = num_executed_dag_blk_ + finalized_dag_blk_hashes.size();
@@ -252,10 +385,16 @@ std::shared_ptr<const FinalizationResult> FinalChain::finalize_(PeriodData&& new
       std::move(receipts),
   });
 
-  // Please do not change order of these three lines :)
-  db_->commitWriteBatch(batch, db_->sync_write_);
+  // Please do not change order of these lines :)
+  // Execution of the next period depends on the state transition commit, which can't be done before the batch is
+  // durable, otherwise recovery in the constructor would not be able to restore consistency after a crash. Periods
+  // committed without fsync by group commit are synced before the state commit for the same reason
+  stage_start = std::chrono::steady_clock::now();
+  db_->commitPeriodWriteBatch(batch);
+  db_->flushGroupCommit();
   state_api_.transition_state_commit();
   rewards_.clear(new_blk.pbft_blk->getPeriod());
+  stage_timings_.commit_us = elapsedUs(stage_start);
 
   num_executed_dag_blk_ = num_executed_dag_blk;
   num_executed_trx_ = num_executed_trx;
@@ -313,8 +452,7 @@ void FinalChain::prune(EthBlockNumber blk_n) {
 }
 
 std::shared_ptr<BlockHeader> FinalChain::appendBlock(Batch& batch, const PbftBlock& pbft_blk, const h256& state_root,
-                                                     u256 total_reward, const SharedTransactions& transactions,
-                                                     const TransactionReceipts& receipts) {
+                                                     u256 total_reward, SealedBlockContent&& content) {
   auto header = std::make_shared<BlockHeader>();
   header->setFromPbft(pbft_blk);
 
@@ -322,42 +460,57 @@ std::shared_ptr<BlockHeader> FinalChain::appendBlock(Batch& batch, const PbftBlo
     header->number = last_block->number + 1;
     header->parent_hash = last_block->hash;
   }
-  if (!receipts.empty()) {
-    header->gas_used = receipts.back().cumulative_gas_used;
-  }
   header->state_root = state_root;
   header->total_reward = total_reward;
   header->gas_limit = kBlockGasLimit;
 
-  return appendBlock(batch, std::move(header), transactions, receipts);
+  return appendBlock(batch, std::move(header), std::move(content));
+}
+
+FinalChain::SealedBlockContent FinalChain::sealBlockContent(const SharedTransactions& transactions,
+                                                            const TransactionReceipts& receipts) {
+  SealedBlockContent content;
+  dev::BytesMap trxs_trie;
+  dev::BytesMap receipts_trie;
+  dev::RLPStream receipts_stream;
+  receipts_stream.appendList(receipts.size());
+  for (size_t trx_idx = 0; trx_idx < transactions.size(); ++trx_idx) {
+    const auto& trx = transactions[trx_idx];
+    auto i_rlp = util::rlp_enc(trx_idx);
+    trxs_trie[i_rlp] = trx->rlp();
+
+    const auto& receipt = receipts[trx_idx];
+    content.log_bloom |= receipt.bloom();
+
+    auto rlp = util::rlp_enc(receipt);
+    receipts_stream.appendRaw(rlp);
+    receipts_trie[i_rlp] = rlp;
+  }
+  if (!receipts.empty()) {
+    content.gas_used = receipts.back().cumulative_gas_used;
+  }
+  content.receipts_rlp = receipts_stream.invalidate();
+  content.receipts_root = hash256(receipts_trie);
+  content.transactions_root = hash256(trxs_trie);
+  return content;
 }
 
 std::shared_ptr<BlockHeader> FinalChain::appendBlock(Batch& batch, std::shared_ptr<BlockHeader> header,
                                                      const SharedTransactions& transactions,
                                                      const TransactionReceipts& receipts) {
-  {
-    dev::BytesMap trxs_trie;
-    dev::BytesMap receipts_trie;
-    dev::RLPStream receipts_stream;
-    receipts_stream.appendList(receipts.size());
-    for (size_t trx_idx = 0; trx_idx < transactions.size(); ++trx_idx) {
-      const auto& trx = transactions[trx_idx];
-      auto i_rlp = util::rlp_enc(trx_idx);
-      trxs_trie[i_rlp] = trx->rlp();
-
-      const auto& receipt = receipts[trx_idx];
-      header->log_bloom |= receipt.bloom();
-
-      auto rlp = util::rlp_enc(receipt);
-      receipts_stream.appendRaw(rlp);
-      receipts_trie[i_rlp] = rlp;
-    }
-    db_->insert(batch, DbStorage::Columns::final_chain_receipt_by_period, header->number, receipts_stream.invalidate());
+  return appendBlock(batch, std::move(header), sealBlockContent(transactions, receipts));
+}
 
-    header->receipts_root = hash256(receipts_trie);
-    header->transactions_root = hash256(trxs_trie);
-    header->hash = dev::sha3(header->ethereumRlp());
+std::shared_ptr<BlockHeader> FinalChain::appendBlock(Batch& batch, std::shared_ptr<BlockHeader> header,
+                                                     SealedBlockContent&& content) {
+  if (content.gas_used) {
+    header->gas_used = content.gas_used;
   }
+  header->log_bloom |= content.log_bloom;
+  header->receipts_root = content.receipts_root;
+  header->transactions_root = content.transactions_root;
+  header->hash = dev::sha3(header->ethereumRlp());
+  db_->insert(batch, DbStorage::Columns::final_chain_receipt_by_period, header->number, content.receipts_rlp);
 
   auto data = header->serializeForDB();
   db_->insert(batch, DbStorage::Columns::final_chain_blk_by_number, header->number, data);
@@ -377,6 +530,12 @@ std::shared_ptr<BlockHeader> FinalChain::appendBlock(Batch& batch, std::shared_p
   return header;
 }
 
+void FinalChain::processReceipts(Batch& batch, EthBlockNumber blk_n, const TransactionReceipts& receipts) {
+  if (kConfig.db_config.logs_index) {
+    db_->addLogsIndexToBatch(batch, blk_n, receipts);
+  }
+}
+
 EthBlockNumber FinalChain::lastBlockNumber() const { return last_block_number_; }
 
 std::optional<EthBlockNumber> FinalChain::blockNumber(const h256& h) const {
@@ -423,6 +582,35 @@ SharedTransactionReceipts FinalChain::blockReceipts(std::optional<EthBlockNumber
   return block_receipts_cache_.get(*n);
 }
 
+std::vector<SharedTransactionReceipts> FinalChain::blocksReceipts(const std::vector<EthBlockNumber>& blocks) const {
+  std::vector<SharedTransactionReceipts> ret(blocks.size());
+  std::vector<EthBlockNumber> to_load;
+  std::vector<size_t> to_load_pos;
+  for (size_t i = 0; i < blocks.size(); ++i) {
+    if (auto receipts = block_receipts_cache_.getFromCache(blocks[i])) {
+      ret[i] = std::move(*receipts);
+      continue;
+    }
+    to_load.push_back(blocks[i]);
+    to_load_pos.push_back(i);
+  }
+  if (!to_load.empty()) {
+    auto loaded = db_->getBlocksReceipts(to_load);
+    for (size_t i = 0; i < loaded.size(); ++i) {
+      ret[to_load_pos[i]] = std::move(loaded[i]);
+    }
+  }
+  return ret;
+}
+
+SharedBlockReceiptsView FinalChain::blockReceiptsView(std::optional<EthBlockNumber> n) const {
+  return db_->getBlockReceiptsView(lastIfAbsent(n));
+}
+
+std::vector<SharedBlockReceiptsView> FinalChain::blocksReceiptsViews(const std::vector<EthBlockNumber>& blocks) const {
+  return db_->getBlocksReceiptsViews(blocks);
+}
+
 SharedTransactionReceipts FinalChain::getBlockReceipts(std::optional<EthBlockNumber> n) const {
   return db_->getBlockReceipts(lastIfAbsent(n));
 }
@@ -441,14 +629,43 @@ const SharedTransactions FinalChain::transactions(std::optional<EthBlockNumber>
 
 std::vector<EthBlockNumber> FinalChain::withBlockBloom(const LogBloom& b, EthBlockNumber from,
                                                        EthBlockNumber to) const {
-  std::vector<EthBlockNumber> ret;
-  // start from the top-level
-  auto u = int_pow(c_bloomIndexSize, c_bloomIndexLevels);
-  // run through each of the top-level blocks
-  for (EthBlockNumber index = from / u; index <= (to + u - 1) / u; ++index) {
-    dev::operator+=(ret, withBlockBloom(b, from, to, c_bloomIndexLevels - 1, index));
+  return withBlockBlooms({b}, from, to);
+}
+
+std::vector<EthBlockNumber> FinalChain::withBlockBlooms(const std::vector<LogBloom>& blooms, EthBlockNumber from,
+                                                        EthBlockNumber to) const {
+  if (blooms.empty() || from > to) {
+    return {};
   }
-  return ret;
+  // start from the top-level chunks covering the range
+  const auto u = int_pow(c_bloomIndexSize, c_bloomIndexLevels);
+  std::vector<EthBlockNumber> indices;
+  for (EthBlockNumber index = from / u; index <= to / u; ++index) {
+    indices.push_back(index);
+  }
+  // descend only into entries that match any of blooms, at the lowest level entries are block numbers
+  for (EthBlockNumber level = c_bloomIndexLevels; level-- > 0;) {
+    std::vector<h256> chunk_ids;
+    chunk_ids.reserve(indices.size());
+    std::transform(indices.cbegin(), indices.cend(), std::back_inserter(chunk_ids),
+                   [level](auto index) { return blockBloomsChunkId(level, index); });
+    const auto chunks = blockBlooms(chunk_ids);
+    const auto entry_size = int_pow(c_bloomIndexSize, level);
+    std::vector<EthBlockNumber> next_indices;
+    for (size_t i = 0; i < indices.size(); ++i) {
+      for (EthBlockNumber o = 0; o < c_bloomIndexSize; ++o) {
+        const auto entry = indices[i] * c_bloomIndexSize + o;
+        if ((entry + 1) * entry_size <= from || entry * entry_size > to) {
+          continue;
+        }
+        if (std::any_of(blooms.cbegin(), blooms.cend(), [&](const auto& b) { return chunks[i][o].contains(b); })) {
+          next_indices.push_back(entry);
+        }
+      }
+    }
+    indices = std::move(next_indices);
+  }
+  return indices;
 }
 
 std::optional<state_api::Account> FinalChain::getAccount(const addr_t& addr,
@@ -664,30 +881,35 @@ BlocksBlooms FinalChain::blockBlooms(const h256& chunk_id) const {
   return {};
 }
 
-h256 FinalChain::blockBloomsChunkId(EthBlockNumber level, EthBlockNumber index) { return h256(index * 0xff + level); }
+std::vector<LogLocation> FinalChain::logsByAddresses(const std::vector<Address>& addresses, EthBlockNumber from,
+                                                     EthBlockNumber to) const {
+  return db_->getLogLocationsByAddresses(addresses, from, to);
+}
 
-std::vector<EthBlockNumber> FinalChain::withBlockBloom(const LogBloom& b, EthBlockNumber from, EthBlockNumber to,
-                                                       EthBlockNumber level, EthBlockNumber index) const {
-  std::vector<EthBlockNumber> ret;
-  auto uCourse = int_pow(c_bloomIndexSize, level + 1);
-  auto uFine = int_pow(c_bloomIndexSize, level);
-  auto obegin = index == from / uCourse ? from / uFine % c_bloomIndexSize : 0;
-  auto oend = index == to / uCourse ? (to / uFine) % c_bloomIndexSize + 1 : c_bloomIndexSize;
-  auto bb = blockBlooms(blockBloomsChunkId(level, index));
-  for (auto o = obegin; o < oend; ++o) {
-    if (bb[o].contains(b)) {
-      // This level has something like what we want.
-      if (level > 0) {
-        dev::operator+=(ret, withBlockBloom(b, from, to, level - 1, o + index * c_bloomIndexSize));
-      } else {
-        EthBlockNumber blockNumber = o + index * c_bloomIndexSize;
-        if (blockNumber >= from && blockNumber <= to) {
-          ret.push_back(blockNumber);
-        }
-      }
-    }
+std::vector<LogLocation> FinalChain::logsByTopics(const std::vector<h256>& topics, uint8_t topic_position,
+                                                  EthBlockNumber from, EthBlockNumber to) const {
+  return db_->getLogLocationsByTopics(topics, topic_position, from, to);
+}
+
+uint64_t FinalChain::estimateLogsByAddresses(const std::vector<Address>& addresses, EthBlockNumber from,
+                                             EthBlockNumber to) const {
+  return db_->estimateLogLocationsByAddresses(addresses, from, to);
+}
+
+uint64_t FinalChain::estimateLogsByTopics(const std::vector<h256>& topics, uint8_t topic_position,
+                                          EthBlockNumber from, EthBlockNumber to) const {
+  return db_->estimateLogLocationsByTopics(topics, topic_position, from, to);
+}
+
+std::vector<BlocksBlooms> FinalChain::blockBlooms(const std::vector<h256>& chunk_ids) const {
+  std::vector<BlocksBlooms> ret;
+  ret.reserve(chunk_ids.size());
+  for (const auto& raw : db_->multiLookup(chunk_ids, DbStorage::Columns::final_chain_log_blooms_index)) {
+    ret.emplace_back(raw.empty() ? BlocksBlooms{} : dev::RLP(raw).toArray<LogBloom, c_bloomIndexSize>());
   }
   return ret;
 }
 
+h256 FinalChain::blockBloomsChunkId(EthBlockNumber level, EthBlockNumber index) { return h256(index * 0xff + level); }
+
 }  // namespace taraxa::final_chain
\ No newline at end of file
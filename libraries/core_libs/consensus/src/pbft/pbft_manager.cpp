@@ -32,8 +32,9 @@ PbftManager::PbftManager(const FullNodeConfig &conf, std::shared_ptr<DbStorage>
       trx_mgr_(std::move(trx_mgr)),
       final_chain_(std::move(final_chain)),
       pillar_chain_mgr_(std::move(pillar_chain_mgr)),
-      kSyncingThreadPoolSize(std::thread::hardware_concurrency() / 2),
+      kSyncingThreadPoolSize(std::max(1u, std::thread::hardware_concurrency() / 2)),
       sync_thread_pool_(std::make_shared<util::ThreadPool>(kSyncingThreadPoolSize)),
+      kMaxPrevalidatedSyncedPeriods(2 * kSyncingThreadPoolSize),
       rounds_count_dynamic_lambda_(0),
       dynamic_lambda_(conf.genesis.state.hardforks.cacti_hf.lambda_max),
       dag_genesis_block_hash_(conf.genesis.dag_genesis_block.getHash()),
@@ -1893,7 +1894,10 @@ void PbftManager::pushSyncedPbftBlocksIntoChain() {
   }
 
   sync_queue_.cleanOldData(getPbftPeriod());
+  // Node is far behind the network while syncing, so finalized periods could be synced to disk in groups
+  db_->setGroupCommitActive(net->pbft_syncing());
   while (periodDataQueueSize() > 0) {
+    prevalidateSyncedPeriods();
     auto period_data_opt = processPeriodData();
     if (!period_data_opt) continue;
 
@@ -2161,11 +2165,105 @@ PbftPeriod PbftManager::pbftSyncingPeriod() const {
   return std::max(sync_queue_.getPeriod(), pbft_chain_->getPbftChainSize());
 }
 
+void PbftManager::prevalidateSyncedPeriods() {
+  const auto chain_size = pbft_chain_->getPbftChainSize();
+  auto periods_data = sync_queue_.getPeriodsData(chain_size + 1, kMaxPrevalidatedSyncedPeriods);
+
+  // Drop results of processed periods and of period data that are not in the queue anymore
+  for (auto it = synced_periods_prevalidations_.begin(); it != synced_periods_prevalidations_.end();) {
+    const auto period = it->first;
+    if (period > chain_size && std::any_of(periods_data.begin(), periods_data.end(), [&](const auto &period_data) {
+          return period_data.first.pbft_blk == it->second->pbft_block;
+        })) {
+      ++it;
+      continue;
+    }
+    waitSyncedPeriodPrevalidation(period);
+    it = synced_periods_prevalidations_.erase(it);
+  }
+
+  for (auto &period_data : periods_data) {
+    const auto period = period_data.first.pbft_blk->getPeriod();
+    if (synced_periods_prevalidations_.contains(period)) {
+      continue;
+    }
+
+    auto prevalidation = std::make_shared<SyncedPeriodPrevalidation>();
+    prevalidation->pbft_block = period_data.first.pbft_blk;
+    prevalidation->done = sync_thread_pool_->post([prevalidation, vote_mgr = vote_mgr_,
+                                                   period_data = std::move(period_data.first)]() {
+      for (const auto &trx : period_data.transactions) {
+        if (!trx->recoverSender()) {
+          prevalidation->invalid_transactions = true;
+        }
+      }
+      for (const auto &dag_block : period_data.dag_blocks) {
+        dag_block->getSender();
+      }
+      prevalidation->finalized_transactions_to_check = getFinalizedTransactionsToCheck(period_data);
+
+      for (const auto &vote : period_data.previous_block_cert_votes) {
+        // Votes with weight were already validated before pushing into the queue
+        if (vote->getWeight().has_value()) {
+          continue;
+        }
+        if (vote_mgr->preverifyVote(vote, vote->getPeriod() % kFullVoteValidationInterval == 0)) {
+          prevalidation->verified_votes.insert(vote);
+        }
+      }
+
+      if (period_data.pillar_votes_.has_value()) {
+        for (const auto &vote : *period_data.pillar_votes_) {
+          vote->getVoterAddr();
+        }
+      }
+    });
+    synced_periods_prevalidations_.emplace(period, std::move(prevalidation));
+  }
+}
+
+std::shared_ptr<PbftManager::SyncedPeriodPrevalidation> PbftManager::waitSyncedPeriodPrevalidation(PbftPeriod period) {
+  const auto it = synced_periods_prevalidations_.find(period);
+  if (it == synced_periods_prevalidations_.end()) {
+    return nullptr;
+  }
+  if (it->second->done.valid()) {
+    it->second->done.get();
+  }
+  return it->second;
+}
+
+std::vector<trx_hash_t> PbftManager::getFinalizedTransactionsToCheck(const PeriodData &period_data) {
+  std::unordered_set<trx_hash_t> trx_set_period_data;
+  for (auto const &transaction : period_data.transactions) {
+    trx_set_period_data.emplace(transaction->getHash());
+  }
+
+  std::unordered_set<trx_hash_t> trx_set;
+  std::vector<trx_hash_t> finalized_transactions_to_check;
+  for (auto const &dag_block : period_data.dag_blocks) {
+    for (auto const &trx_hash : dag_block->getTrxs()) {
+      if (trx_set.insert(trx_hash).second && !trx_set_period_data.contains(trx_hash)) {
+        finalized_transactions_to_check.emplace_back(trx_hash);
+      }
+    }
+  }
+  return finalized_transactions_to_check;
+}
+
 std::optional<std::pair<PeriodData, std::vector<std::shared_ptr<PbftVote>>>> PbftManager::processPeriodData() {
   auto [period_data, cert_votes, node_id] = sync_queue_.pop();
   auto pbft_block_hash = period_data.pbft_blk->getBlockHash();
-  LOG(log_dg_) << "Pop pbft block " << pbft_block_hash << " with period " << period_data.pbft_blk->getPeriod()
-               << " from synced queue";
+  const auto block_period = period_data.pbft_blk->getPeriod();
+  LOG(log_dg_) << "Pop pbft block " << pbft_block_hash << " with period " << block_period << " from synced queue";
+
+  // Cert votes are part of the next period data, none of them can be accessed while they are being prevalidated
+  auto prevalidation = waitSyncedPeriodPrevalidation(block_period);
+  const auto next_prevalidation = waitSyncedPeriodPrevalidation(block_period + 1);
+  if (prevalidation && prevalidation->pbft_block != period_data.pbft_blk) {
+    // Queue was refilled with different period data after prevalidation was scheduled
+    prevalidation = nullptr;
+  }
 
   if (pbft_chain_->findPbftBlockInChain(pbft_block_hash)) {
     LOG(log_dg_) << "PBFT block " << pbft_block_hash << " already present in chain.";
@@ -2236,7 +2334,8 @@ std::optional<std::pair<PeriodData, std::vector<std::shared_ptr<PbftVote>>>> Pbf
   }
 
   // Validate cert votes
-  if (!validatePbftBlockCertVotes(period_data.pbft_blk, cert_votes)) {
+  if (!validatePbftBlockCertVotes(period_data.pbft_blk, cert_votes,
+                                  next_prevalidation ? &next_prevalidation->verified_votes : nullptr)) {
     LOG(log_er_) << "Synced PBFT block " << pbft_block_hash
                  << " doesn't have enough valid cert votes. Clear synced PBFT blocks!";
     sync_queue_.clear();
@@ -2244,20 +2343,20 @@ std::optional<std::pair<PeriodData, std::vector<std::shared_ptr<PbftVote>>>> Pbf
     return std::nullopt;
   }
 
-  std::unordered_set<trx_hash_t> trx_set_period_data;
-  for (auto const &transaction : period_data.transactions) {
-    trx_set_period_data.emplace(transaction->getHash());
+  const bool invalid_transactions =
+      prevalidation ? prevalidation->invalid_transactions
+                    : std::any_of(period_data.transactions.begin(), period_data.transactions.end(),
+                                  [](const auto &trx) { return !trx->recoverSender(); });
+  if (invalid_transactions) {
+    LOG(log_er_) << "Synced PBFT block " << pbft_block_hash << " has transaction with invalid signature";
+    sync_queue_.clear();
+    net->handleMaliciousSyncPeer(node_id);
+    return std::nullopt;
   }
 
-  std::unordered_set<trx_hash_t> trx_set;
-  std::vector<trx_hash_t> finalized_transactions_to_check;
-  for (auto const &dag_block : period_data.dag_blocks) {
-    for (auto const &trx_hash : dag_block->getTrxs()) {
-      if (trx_set.insert(trx_hash).second && !trx_set_period_data.contains(trx_hash)) {
-        finalized_transactions_to_check.emplace_back(trx_hash);
-      }
-    }
-  }
+  const auto finalized_transactions_to_check = prevalidation
+                                                   ? std::move(prevalidation->finalized_transactions_to_check)
+                                                   : getFinalizedTransactionsToCheck(period_data);
 
   // Verify period data is not missing any transaction
   auto non_finalized_transactions = trx_mgr_->excludeFinalizedTransactions(finalized_transactions_to_check);
@@ -2278,7 +2377,6 @@ std::optional<std::pair<PeriodData, std::vector<std::shared_ptr<PbftVote>>>> Pbf
     return std::nullopt;
   }
 
-  const auto block_period = period_data.pbft_blk->getPeriod();
   // Validate pillar votes
   if (kGenesisConfig.state.hardforks.ficus_hf.isPbftWithPillarBlockPeriod(block_period) &&
       !validatePbftBlockPillarVotes(period_data)) {
@@ -2293,13 +2391,13 @@ std::optional<std::pair<PeriodData, std::vector<std::shared_ptr<PbftVote>>>> Pbf
       {std::move(period_data), std::move(cert_votes)});
 }
 
-bool PbftManager::validatePbftBlockCertVotes(const std::shared_ptr<PbftBlock> pbft_block,
-                                             const std::vector<std::shared_ptr<PbftVote>> &cert_votes) const {
+bool PbftManager::validatePbftBlockCertVotes(
+    const std::shared_ptr<PbftBlock> pbft_block, const std::vector<std::shared_ptr<PbftVote>> &cert_votes,
+    const std::unordered_set<std::shared_ptr<PbftVote>> *verified_votes) const {
   // To speed up syncing/rebuilding full strict vote verification is done for all votes on every
-  // full_vote_validation_interval and for a random vote for each block
-  const uint32_t full_vote_validation_interval = 100;
+  // kFullVoteValidationInterval and for a random vote for each block
   const uint32_t vote_to_validate = std::rand() % cert_votes.size();
-  const bool strict_validation = (pbft_block->getPeriod() % full_vote_validation_interval == 0);
+  const bool strict_validation = (pbft_block->getPeriod() % kFullVoteValidationInterval == 0);
 
   if (cert_votes.empty()) {
     LOG(log_er_) << "No cert votes provided! The synced PBFT block comes from a malicious player";
@@ -2349,8 +2447,10 @@ bool PbftManager::validatePbftBlockCertVotes(const std::shared_ptr<PbftBlock> pb
     }
 
     bool strict = strict_validation || (vote_counter == vote_to_validate);
+    // Vrf proof verified ahead can be reused only if it was verified with the same strictness
+    const bool vrf_verified = (strict == strict_validation) && verified_votes && verified_votes->contains(v);
 
-    if (const auto ret = vote_mgr_->validateVote(v, strict); !ret.first) {
+    if (const auto ret = vote_mgr_->validateVote(v, strict, vrf_verified); !ret.first) {
       LOG(log_er_) << "Cert vote " << v->getHash() << " validation failed. Err: " << ret.second << ", pbft block "
                    << pbft_block->getBlockHash();
       return false;
@@ -2393,8 +2493,7 @@ bool PbftManager::validatePbftBlockPillarVotes(const PeriodData &period_data) co
     return false;
   }
 
-  uint64_t votes_weight = 0;
-  for (auto &vote : *period_data.pillar_votes_) {
+  for (const auto &vote : *period_data.pillar_votes_) {
     // Any info is wrong that can determine the synced PBFT block comes from a malicious player
     if (vote->getPeriod() != required_votes_period) {
       LOG(log_er_) << "Invalid sync pillar vote " << vote->getHash() << " period " << vote->getPeriod()
@@ -2410,18 +2509,25 @@ bool PbftManager::validatePbftBlockPillarVotes(const PeriodData &period_data) co
                    << ", full data: " << current_pillar_block->getJson();
       return false;
     }
+  }
 
-    if (!pillar_chain_mgr_->validatePillarVote(vote)) {
-      LOG(log_er_) << "Invalid sync pillar vote " << vote->getHash();
+  // Signatures of all votes are verified in parallel
+  const auto votes_valid = pillar_chain_mgr_->validatePillarVotes(*period_data.pillar_votes_);
+  for (size_t i = 0; i < votes_valid.size(); ++i) {
+    if (!votes_valid[i]) {
+      LOG(log_er_) << "Invalid sync pillar vote " << (*period_data.pillar_votes_)[i]->getHash();
       return false;
     }
+  }
 
-    if (const auto vote_weight = pillar_chain_mgr_->addVerifiedPillarVote(vote); vote_weight) {
-      votes_weight += vote_weight;
-    } else {
-      LOG(log_er_) << "Unable to add sync pillar vote " << vote->getHash();
+  uint64_t votes_weight = 0;
+  const auto votes_weights = pillar_chain_mgr_->addVerifiedPillarVotes(*period_data.pillar_votes_);
+  for (size_t i = 0; i < votes_weights.size(); ++i) {
+    if (!votes_weights[i]) {
+      LOG(log_er_) << "Unable to add sync pillar vote " << (*period_data.pillar_votes_)[i]->getHash();
       return false;
     }
+    votes_weight += votes_weights[i];
   }
 
   const auto pillar_consensus_threshold = pillar_chain_mgr_->getPillarConsensusThreshold(required_votes_period - 1);
@@ -2470,26 +2576,7 @@ void PbftManager::periodDataQueuePush(PeriodData &&period_data, dev::p2p::NodeID
                                       std::vector<std::shared_ptr<PbftVote>> &&current_block_cert_votes) {
   const auto period = period_data.pbft_blk->getPeriod();
 
-  // Only do parallel transactions retrieve for blocks bigger than 100 transactions
-  auto trx_size = period_data.transactions.size();
-  if (trx_size > 100) {
-    auto chunk_size = trx_size / kSyncingThreadPoolSize;
-
-    std::vector<std::future<void>> futures;
-    futures.reserve(kSyncingThreadPoolSize);
-    // Launch tasks in parallel
-    for (uint32_t i = 0; i < kSyncingThreadPoolSize; ++i) {
-      futures.push_back(sync_thread_pool_->post([&period_data, i, chunk_size, trx_size]() {
-        const uint32_t start = i * chunk_size;
-        const uint32_t end = std::min((i + 1) * chunk_size, trx_size);
-        for (uint32_t j = start; j < end; j++) period_data.transactions[j]->getSender();
-      }));
-    }
-    for (uint32_t i = 0; i < kSyncingThreadPoolSize; ++i) {
-      futures[i].get();
-    }
-  }
-
+  // Transactions senders are recovered by prevalidateSyncedPeriods ahead of processing
   if (!sync_queue_.push(std::move(period_data), node_id, pbft_chain_->getPbftChainSize(),
                         std::move(current_block_cert_votes))) {
     LOG(log_er_) << "Trying to push period data with " << period << " period, but current period is "
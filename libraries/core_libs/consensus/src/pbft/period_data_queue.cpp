@@ -73,6 +73,23 @@ std::shared_ptr<PbftBlock> PeriodDataQueue::lastPbftBlock() const {
   return nullptr;
 }
 
+std::vector<std::pair<PeriodData, dev::p2p::NodeID>> PeriodDataQueue::getPeriodsData(uint64_t from_period,
+                                                                                    size_t max_count) const {
+  std::vector<std::pair<PeriodData, dev::p2p::NodeID>> periods_data;
+  std::shared_lock lock(queue_access_);
+  if (queue_.empty()) {
+    return periods_data;
+  }
+
+  // Periods in the queue are continuous
+  const auto front_period = queue_.front().first.pbft_blk->getPeriod();
+  const auto first_idx = from_period > front_period ? from_period - front_period : 0;
+  for (auto idx = first_idx; idx < queue_.size() && periods_data.size() < max_count; idx++) {
+    periods_data.push_back(queue_[idx]);
+  }
+  return periods_data;
+}
+
 void PeriodDataQueue::cleanOldData(uint64_t period) {
   std::unique_lock lock(queue_access_);
   while (queue_.size() > 0 && queue_.front().first.pbft_blk->getPeriod() < period) {
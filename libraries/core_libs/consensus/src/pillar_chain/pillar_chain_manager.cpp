@@ -2,6 +2,9 @@
 
 #include <libff/common/profiling.hpp>
 
+#include <algorithm>
+#include <future>
+
 #include "config/hardfork.hpp"
 #include "final_chain/final_chain.hpp"
 #include "key_manager/key_manager.hpp"
@@ -24,7 +27,8 @@ PillarChainManager::PillarChainManager(const FicusHardforkConfig& ficus_hf_confi
       current_pillar_block_{},
       current_pillar_block_vote_counts_{},
       pillar_votes_{},
-      mutex_{} {
+      mutex_{},
+      votes_validation_thread_pool_(std::clamp(std::thread::hardware_concurrency() / 2, 1u, 4u)) {
   LOG_OBJECTS_CREATE("PILLAR_CHAIN");
 
   if (const auto vote = db_->getOwnPillarBlockVote(); vote) {
@@ -244,7 +248,7 @@ bool PillarChainManager::isRelevantPillarVote(const std::shared_ptr<PillarVote>
   return true;
 }
 
-bool PillarChainManager::validatePillarVote(const std::shared_ptr<PillarVote> vote) const {
+bool PillarChainManager::validatePillarVoteVoter(const std::shared_ptr<PillarVote>& vote) const {
   const auto period = vote->getPeriod();
   const auto validator = vote->getVoterAddr();
 
@@ -266,6 +270,14 @@ bool PillarChainManager::validatePillarVote(const std::shared_ptr<PillarVote> vo
     return false;
   }
 
+  return true;
+}
+
+bool PillarChainManager::validatePillarVote(const std::shared_ptr<PillarVote> vote) const {
+  if (!validatePillarVoteVoter(vote)) {
+    return false;
+  }
+
   if (!vote->verifyVote()) {
     LOG(log_er_) << "Invalid pillar vote " << vote->getHash();
     return false;
@@ -274,7 +286,31 @@ bool PillarChainManager::validatePillarVote(const std::shared_ptr<PillarVote> vo
   return true;
 }
 
-uint64_t PillarChainManager::addVerifiedPillarVote(const std::shared_ptr<PillarVote>& vote) {
+std::vector<bool> PillarChainManager::validatePillarVotes(const std::vector<std::shared_ptr<PillarVote>>& votes) const {
+  // Voter recovery from signature is the expensive part of validation and voter checks need the voter, so signatures
+  // are verified first. Each vote is verified by exactly one thread. std::vector<bool> packs bits, so it cannot be
+  // written concurrently
+  std::vector<uint8_t> signature_valid(votes.size(), false);
+  votes_validation_thread_pool_.parallel_for(
+      votes.size(), kMinVotesForParallelValidation, [&](size_t start, size_t end) {
+        for (size_t i = start; i < end; ++i) {
+          signature_valid[i] = votes[i]->verifyVote();
+        }
+      });
+
+  // Voters are already recovered, uniqueness and eligibility checks only read them
+  std::vector<bool> valid(votes.size(), false);
+  for (size_t i = 0; i < votes.size(); ++i) {
+    if (!signature_valid[i]) {
+      LOG(log_er_) << "Invalid pillar vote " << votes[i]->getHash();
+      continue;
+    }
+    valid[i] = validatePillarVoteVoter(votes[i]);
+  }
+  return valid;
+}
+
+uint64_t PillarChainManager::getPillarVoteWeight(const std::shared_ptr<PillarVote>& vote) {
   uint64_t validator_vote_count = 0;
   try {
     validator_vote_count = final_chain_->dposEligibleVoteCount(vote->getPeriod() - 1, vote->getVoterAddr());
@@ -299,6 +335,15 @@ uint64_t PillarChainManager::addVerifiedPillarVote(const std::shared_ptr<PillarV
     pillar_votes_.initializePeriodData(vote->getPeriod(), *threshold);
   }
 
+  return validator_vote_count;
+}
+
+uint64_t PillarChainManager::addVerifiedPillarVote(const std::shared_ptr<PillarVote>& vote) {
+  const auto validator_vote_count = getPillarVoteWeight(vote);
+  if (!validator_vote_count) {
+    return 0;
+  }
+
   if (!pillar_votes_.addVerifiedVote(vote, validator_vote_count)) {
     LOG(log_er_) << "Non-unique pillar vote " << vote->getHash() << ", period " << vote->getPeriod() << ", validator "
                  << vote->getVoterAddr();
@@ -311,6 +356,36 @@ uint64_t PillarChainManager::addVerifiedPillarVote(const std::shared_ptr<PillarV
   return validator_vote_count;
 }
 
+std::vector<uint64_t> PillarChainManager::addVerifiedPillarVotes(
+    const std::vector<std::shared_ptr<PillarVote>>& votes) {
+  std::vector<uint64_t> weights(votes.size(), 0);
+  std::vector<std::pair<std::shared_ptr<PillarVote>, uint64_t>> votes_to_add;
+  std::vector<size_t> votes_to_add_pos;
+  votes_to_add.reserve(votes.size());
+  votes_to_add_pos.reserve(votes.size());
+  for (size_t i = 0; i < votes.size(); ++i) {
+    if (const auto validator_vote_count = getPillarVoteWeight(votes[i]); validator_vote_count) {
+      votes_to_add.emplace_back(votes[i], validator_vote_count);
+      votes_to_add_pos.push_back(i);
+    }
+  }
+
+  const auto added = pillar_votes_.addVerifiedVotes(votes_to_add);
+  for (size_t i = 0; i < votes_to_add.size(); ++i) {
+    const auto& [vote, validator_vote_count] = votes_to_add[i];
+    if (!added[i]) {
+      LOG(log_er_) << "Non-unique pillar vote " << vote->getHash() << ", period " << vote->getPeriod()
+                   << ", validator " << vote->getVoterAddr();
+      continue;
+    }
+    weights[votes_to_add_pos[i]] = validator_vote_count;
+    LOG(log_nf_) << "Added pillar vote " << vote->getHash() << ", period " << vote->getPeriod()
+                 << ", pillar block hash " << vote->getBlockHash();
+  }
+
+  return weights;
+}
+
 std::vector<std::shared_ptr<PillarVote>> PillarChainManager::getVerifiedPillarVotes(PbftPeriod period,
                                                                                     const blk_hash_t pillar_block_hash,
                                                                                     bool above_threshold) const {
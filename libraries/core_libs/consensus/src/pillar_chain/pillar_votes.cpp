@@ -55,28 +55,17 @@ std::vector<std::shared_ptr<PillarVote>> PillarVotes::getVerifiedVotes(PbftPerio
   // Return minimum amount of >threshold sorted votes based on their weight
   if (above_threshold) {
     const auto threshold = found_period_votes->second.threshold;
-    if (found_pillar_block_votes->second.weight < threshold) {
+    const auto& weight_votes = found_pillar_block_votes->second;
+    if (weight_votes.weight < threshold) {
       return {};
     }
 
-    // Sort votes using multiset
-    auto customComparator = [](const std::pair<std::shared_ptr<PillarVote>, uint64_t>& a,
-                               const std::pair<std::shared_ptr<PillarVote>, uint64_t>& b) {
-      return a.second > b.second;
-    };
-    std::multiset<std::pair<std::shared_ptr<PillarVote>, uint64_t>, decltype(customComparator)> votes_set(
-        customComparator);
-    std::transform(found_pillar_block_votes->second.votes.begin(), found_pillar_block_votes->second.votes.end(),
-                   std::inserter(votes_set, votes_set.end()), [](const auto& el) { return el.second; });
-
-    // Move minimum amount of > threshold votes with the highest vote counts
+    // Take votes with the highest vote counts until threshold is reached
     std::vector<std::shared_ptr<PillarVote>> sorted_votes;
-    sorted_votes.reserve(votes_set.size());
     uint64_t tmp_votes_count = 0;
-    for (auto it = votes_set.begin(); it != votes_set.end();) {
-      auto&& vote_pair = votes_set.extract(it++);
-      tmp_votes_count += vote_pair.value().second;
-      sorted_votes.push_back(std::move(vote_pair.value().first));
+    for (const auto& [vote_weight, vote_hash] : weight_votes.by_weight) {
+      tmp_votes_count += vote_weight;
+      sorted_votes.push_back(weight_votes.votes.at(vote_hash).first);
 
       if (tmp_votes_count >= threshold) {
         break;
@@ -103,7 +92,22 @@ bool PillarVotes::periodDataInitialized(PbftPeriod period) const {
 
 bool PillarVotes::addVerifiedVote(const std::shared_ptr<PillarVote>& vote, uint64_t validator_vote_count) {
   std::scoped_lock<std::shared_mutex> lock(mutex_);
+  return addVerifiedVoteUnsafe(vote, validator_vote_count);
+}
+
+std::vector<bool> PillarVotes::addVerifiedVotes(
+    const std::vector<std::pair<std::shared_ptr<PillarVote>, uint64_t>>& votes) {
+  std::vector<bool> added;
+  added.reserve(votes.size());
+
+  std::scoped_lock<std::shared_mutex> lock(mutex_);
+  for (const auto& [vote, validator_vote_count] : votes) {
+    added.push_back(addVerifiedVoteUnsafe(vote, validator_vote_count));
+  }
+  return added;
+}
 
+bool PillarVotes::addVerifiedVoteUnsafe(const std::shared_ptr<PillarVote>& vote, uint64_t validator_vote_count) {
   auto found_period_votes = votes_.find(vote->getPeriod());
   if (found_period_votes == votes_.end()) {
     // Period must be initialized explicitly providing also threshold weight before adding any vote
@@ -124,6 +128,7 @@ bool PillarVotes::addVerifiedVote(const std::shared_ptr<PillarVote>& vote, uint6
 
   // Add validator vote count only if the vote is new
   if (pillar_block_votes->second.votes.emplace(vote->getHash(), std::make_pair(vote, validator_vote_count)).second) {
+    pillar_block_votes->second.by_weight.emplace(validator_vote_count, vote->getHash());
     pillar_block_votes->second.weight += validator_vote_count;
   }
 
@@ -0,0 +1,37 @@
+#include "transaction/transaction_announcement_log.hpp"
+
+namespace taraxa {
+
+TransactionAnnouncementLog::TransactionAnnouncementLog(size_t capacity)
+    : announcements_(std::max<size_t>(capacity, 1)) {}
+
+void TransactionAnnouncementLog::announce(const trx_hash_t &trx_hash) {
+  std::unique_lock lock(mutex_);
+  announcements_.push_back(trx_hash);
+  head_++;
+}
+
+uint64_t TransactionAnnouncementLog::head() const {
+  std::shared_lock lock(mutex_);
+  return head_;
+}
+
+std::optional<std::vector<trx_hash_t>> TransactionAnnouncementLog::since(uint64_t sequence, size_t max_count) const {
+  std::shared_lock lock(mutex_);
+  const auto tail = head_ - announcements_.size();
+  if (sequence < tail) {
+    return std::nullopt;
+  }
+
+  std::vector<trx_hash_t> result;
+  if (sequence >= head_) {
+    return result;
+  }
+  const auto count = std::min<uint64_t>(head_ - sequence, max_count);
+  result.reserve(count);
+  const auto begin = announcements_.begin() + (sequence - tail);
+  result.insert(result.end(), begin, begin + count);
+  return result;
+}
+
+}  // namespace taraxa
@@ -16,11 +16,13 @@ TransactionManager::TransactionManager(const FullNodeConfig &conf, std::shared_p
                                        std::shared_ptr<final_chain::FinalChain> final_chain, addr_t node_addr)
     : kConf(conf),
       transactions_pool_(final_chain, kConf.transactions_pool_size),
+      announcement_log_(kConf.transactions_pool_size),
       estimations_cache_(kConf.transactions_pool_size / 10, kConf.transactions_pool_size / 100),
       kDagBlockGasLimit(kConf.genesis.dag.gas_limit),
       db_(std::move(db)),
       final_chain_(std::move(final_chain)),
-      estimation_thread_pool_(std::thread::hardware_concurrency() / 2) {
+      estimation_thread_pool_(std::thread::hardware_concurrency() / 2),
+      senders_recovery_thread_pool_(std::max(1u, std::thread::hardware_concurrency() / 2)) {
   LOG_OBJECTS_CREATE("TRXMGR");
   {
     std::unique_lock transactions_lock(transactions_mutex_);
@@ -112,6 +114,31 @@ std::pair<bool, std::string> TransactionManager::verifyTransaction(const std::sh
   return {true, ""};
 }
 
+void TransactionManager::recoverSenders(const SharedTransactions &trxs) {
+  const auto threads_count = senders_recovery_thread_pool_.capacity();
+  if (trxs.size() < kMinTransactionsForParallelRecovery || threads_count < 2) {
+    for (const auto &trx : trxs) {
+      trx->recoverSender();
+    }
+    return;
+  }
+
+  const auto chunk_size = (trxs.size() + threads_count - 1) / threads_count;
+  std::vector<std::future<void>> futures;
+  futures.reserve(threads_count);
+  for (size_t start = 0; start < trxs.size(); start += chunk_size) {
+    const auto end = std::min(start + chunk_size, trxs.size());
+    futures.emplace_back(senders_recovery_thread_pool_.post([&trxs, start, end]() {
+      for (size_t i = start; i < end; ++i) {
+        trxs[i]->recoverSender();
+      }
+    }));
+  }
+  for (auto &future : futures) {
+    future.get();
+  }
+}
+
 bool TransactionManager::isTransactionKnown(const trx_hash_t &trx_hash) {
   return transactions_pool_.isTransactionKnown(trx_hash);
 }
@@ -146,8 +173,9 @@ TransactionStatus TransactionManager::insertValidatedTransaction(std::shared_ptr
 
   // This lock synchronizes inserting and removing transactions from transactions memory pool.
   // It is very important to lock transaction pool checking to be
-  // protected from new DAG block and Period data transactions insertions.
-  std::unique_lock transactions_lock(transactions_mutex_);
+  // protected from new DAG block and Period data transactions insertions which take this lock exclusively.
+  // Shared lock is enough here since transactions_pool_ is sharded and synchronizes concurrent inserts on its own
+  std::shared_lock transactions_lock(transactions_mutex_);
 
   if (nonfinalized_transactions_in_dag_.contains(trx_hash)) {
     return TransactionStatus::Known;
@@ -157,6 +185,7 @@ TransactionStatus TransactionManager::insertValidatedTransaction(std::shared_ptr
     return TransactionStatus::Known;
   }
 
+  // Account is read under the lock, so no period could be finalized between the nonce and balance checks and insertion
   const auto account = final_chain_->getAccount(tx->getSender());
   bool proposable = true;
 
@@ -196,7 +225,13 @@ TransactionStatus TransactionManager::insertValidatedTransaction(std::shared_ptr
   if (proposable) {
     transaction_added_.emit(trx_hash);
   }
-  return transactions_pool_.insert(std::move(tx), proposable, last_block_number);
+  const auto status = transactions_pool_.insert(std::move(tx), proposable, last_block_number);
+  // Announce outside of transactions_mutex_ to keep it short, only proposable transactions are gossiped
+  transactions_lock.unlock();
+  if (status == TransactionStatus::Inserted) {
+    announcement_log_.announce(trx_hash);
+  }
+  return status;
 }
 
 unsigned long TransactionManager::getTransactionCount() const {
@@ -228,6 +263,40 @@ std::shared_ptr<Transaction> TransactionManager::getTransaction(trx_hash_t const
   return db_->getTransaction(hash);
 }
 
+SharedTransactions TransactionManager::getTransactionsByHashes(const vec_trx_t &hashes) const {
+  SharedTransactions transactions(hashes.size());
+  vec_trx_t db_hashes;
+  std::vector<size_t> db_positions;
+  {
+    // Transactions which are moved from the dag to the finalized data while db is read are still found in memory
+    std::shared_lock transactions_lock(transactions_mutex_);
+    for (size_t i = 0; i < hashes.size(); ++i) {
+      if (auto trx = transactions_pool_.get(hashes[i])) {
+        transactions[i] = std::move(trx);
+      } else if (auto trx_it = nonfinalized_transactions_in_dag_.find(hashes[i]);
+                 trx_it != nonfinalized_transactions_in_dag_.end()) {
+        transactions[i] = trx_it->second;
+      } else if (trx_it = recently_finalized_transactions_.find(hashes[i]);
+                 trx_it != recently_finalized_transactions_.end()) {
+        transactions[i] = trx_it->second;
+      } else {
+        db_hashes.push_back(hashes[i]);
+        db_positions.push_back(i);
+      }
+    }
+  }
+  if (db_hashes.empty()) {
+    return transactions;
+  }
+
+  // Batched db lookup is done without transactions_mutex_ so it does not block transactions insertion
+  auto db_transactions = db_->getTransactions(db_hashes);
+  for (size_t i = 0; i < db_positions.size(); ++i) {
+    transactions[db_positions[i]] = std::move(db_transactions[i]);
+  }
+  return transactions;
+}
+
 void TransactionManager::saveTransactionsFromDagBlock(SharedTransactions const &trxs) {
   auto write_batch = db_->createWriteBatch();
   vec_trx_t trx_hashes;
@@ -372,41 +441,68 @@ bool TransactionManager::verifyTransactionsNotFinalized(const SharedTransactions
 /**
  * Retrieve transactions to be included in proposed block
  */
-std::pair<SharedTransactions, std::vector<uint64_t>> TransactionManager::packTrxs(PbftPeriod proposal_period,
-                                                                                  uint64_t weight_limit) {
-  SharedTransactions trxs;
+std::pair<SharedTransactions, std::vector<uint64_t>> TransactionManager::packTrxs(
+    PbftPeriod proposal_period, uint64_t weight_limit, const std::function<bool(const SharedTransaction &)> &filter) {
   const uint64_t max_transactions_in_block = weight_limit / kMinTxGas;
 
-  {
-    std::shared_lock transactions_lock(transactions_mutex_);
-    trxs = transactions_pool_.getOrderedTransactions(max_transactions_in_block);
-  }
-
   std::vector<uint64_t> estimations;
   SharedTransactions trxs_to_propose;
   uint64_t total_weight = 0;
-  for (uint64_t i = 0; i < trxs.size(); i++) {
-    // trx too big to fit, skip it
-    if (total_weight + trxs[i]->getGas() > weight_limit) {
-      continue;
+  TransactionQueue::OrderedIterationPosition position;
+  bool pool_exhausted = false;
+  // Candidates are taken from the pool only until their gas limit fills the block, estimations can only be lower than
+  // gas limit so pool is iterated again, from the last consumed position, only if estimations left some space
+  while (!pool_exhausted && weight_limit - total_weight > kMinTxGas) {
+    SharedTransactions trxs;
+    uint64_t trxs_gas = 0;
+    pool_exhausted = true;
+    {
+      std::shared_lock transactions_lock(transactions_mutex_);
+      transactions_pool_.forEachOrderedTransaction(
+          [&](const SharedTransaction &trx) {
+            if (total_weight + trxs_gas >= weight_limit ||
+                trxs_to_propose.size() + trxs.size() >= max_transactions_in_block) {
+              pool_exhausted = false;
+              return false;
+            }
+            if (filter && !filter(trx)) {
+              return true;
+            }
+            if (total_weight + trxs_gas + trx->getGas() <= weight_limit) {
+              trxs_gas += trx->getGas();
+            }
+            trxs.push_back(trx);
+            return true;
+          },
+          &position);
     }
-
-    auto estimate = estimateTransactionGas(trxs[i], proposal_period);
-    if (estimate.gas_used < kMinTxGas) {
-      LOG(log_er_) << "Transaction " << trxs[i]->getHash() << " has invalid estimation: " << estimate.gas_used;
-      std::unique_lock transactions_lock(transactions_mutex_);
-      auto trx = trxs[i];
-      transactions_pool_.erase(trx);
-      transactions_pool_.insert(std::move(trx), false, final_chain_->lastBlockNumber());
-      continue;
+    if (trxs.empty()) {
+      break;
     }
 
-    total_weight += estimate.gas_used;
-    trxs_to_propose.push_back(trxs[i]);
-    estimations.push_back(estimate.gas_used);
-    // stop if there is no space for even the smallest transaction
-    if (weight_limit - total_weight <= kMinTxGas) {
-      break;
+    for (uint64_t i = 0; i < trxs.size(); i++) {
+      // trx too big to fit, skip it
+      if (total_weight + trxs[i]->getGas() > weight_limit) {
+        continue;
+      }
+
+      auto estimate = estimateTransactionGas(trxs[i], proposal_period);
+      if (estimate.gas_used < kMinTxGas) {
+        LOG(log_er_) << "Transaction " << trxs[i]->getHash() << " has invalid estimation: " << estimate.gas_used;
+        std::unique_lock transactions_lock(transactions_mutex_);
+        auto trx = trxs[i];
+        transactions_pool_.erase(trx);
+        transactions_pool_.insert(std::move(trx), false, final_chain_->lastBlockNumber());
+        continue;
+      }
+
+      total_weight += estimate.gas_used;
+      trxs_to_propose.push_back(trxs[i]);
+      estimations.push_back(estimate.gas_used);
+      // stop if there is no space for even the smallest transaction
+      if (weight_limit - total_weight <= kMinTxGas) {
+        break;
+      }
     }
   }
   return {trxs_to_propose, estimations};
@@ -417,6 +513,11 @@ std::vector<SharedTransactions> TransactionManager::getAllPoolTrxs() {
   return transactions_pool_.getAllTransactions();
 }
 
+SharedTransaction TransactionManager::getPooledTransaction(const trx_hash_t &trx_hash) const {
+  std::shared_lock transactions_lock(transactions_mutex_);
+  return transactions_pool_.get(trx_hash);
+}
+
 void TransactionManager::initializeRecentlyFinalizedTransactions(const PeriodData &period_data) {
   std::unique_lock transactions_lock(transactions_mutex_);
   for (auto const &trx : period_data.transactions) {
@@ -490,27 +591,30 @@ SharedTransactions TransactionManager::getTransactions(const vec_trx_t &trxs_has
   vec_trx_t finalized_trx_hashes;
   SharedTransactions transactions;
   transactions.reserve(trxs_hashes.size());
-  for (auto const &tx_hash : trxs_hashes) {
+  {
     std::shared_lock transactions_lock(transactions_mutex_);
-    auto trx = transactions_pool_.get(tx_hash);
-    if (trx != nullptr) {
-      transactions.emplace_back(std::move(trx));
-    } else {
-      auto trx_it = nonfinalized_transactions_in_dag_.find(tx_hash);
-      if (trx_it != nonfinalized_transactions_in_dag_.end()) {
-        transactions.emplace_back(trx_it->second);
+    for (auto const &tx_hash : trxs_hashes) {
+      auto trx = transactions_pool_.get(tx_hash);
+      if (trx != nullptr) {
+        transactions.emplace_back(std::move(trx));
       } else {
-        trx_it = recently_finalized_transactions_.find(tx_hash);
-        if (trx_it != recently_finalized_transactions_.end()) {
+        auto trx_it = nonfinalized_transactions_in_dag_.find(tx_hash);
+        if (trx_it != nonfinalized_transactions_in_dag_.end()) {
           transactions.emplace_back(trx_it->second);
         } else {
-          finalized_trx_hashes.emplace_back(tx_hash);
+          trx_it = recently_finalized_transactions_.find(tx_hash);
+          if (trx_it != recently_finalized_transactions_.end()) {
+            transactions.emplace_back(trx_it->second);
+          } else {
+            finalized_trx_hashes.emplace_back(tx_hash);
+          }
         }
       }
     }
   }
 
-  // This should be an extremely rare case since transactions should be found in the caches
+  // This should be an extremely rare case since transactions should be found in the caches, they are read from db
+  // with batched lookups
   auto finalizedTransactions = db_->getFinalizedTransactions(finalized_trx_hashes);
 
   for (auto trx : finalizedTransactions) {
@@ -526,7 +630,7 @@ SharedTransactions TransactionManager::getTransactions(const vec_trx_t &trxs_has
 }
 
 void TransactionManager::blockFinalized(EthBlockNumber block_number) {
-  std::unique_lock transactions_lock(transactions_mutex_);
+  std::shared_lock transactions_lock(transactions_mutex_);
   transactions_pool_.blockFinalized(block_number);
 }
 
@@ -1,173 +1,292 @@
 #include "transaction/transaction_queue.hpp"
 
+#include <queue>
+
 #include "transaction/transaction_manager.hpp"
 
 namespace taraxa {
 
-TransactionQueue::TransactionQueue(std::shared_ptr<final_chain::FinalChain> final_chain, size_t max_size)
-    : known_txs_(max_size * 2, max_size / 5),
+TransactionQueue::TransactionQueue(std::shared_ptr<final_chain::FinalChain> final_chain, size_t max_size,
+                                   size_t shards_count)
+    : shards_(std::max<size_t>(shards_count, 1)),
+      hash_index_(shards_.size()),
+      known_txs_(max_size * 2, max_size / 5),
       kNonProposableTransactionsMaxSize(max_size * kNonProposableTransactionsLimitPercentage / 100),
       kMaxSize(max_size),
       kMaxDataSize(max_size * 1024),  // Data limit is max_size kB
       kMaxSingleAccountTransactionsSize(max_size * kSingleAccountTransactionsLimitPercentage / 100),
       final_chain_(final_chain) {
-  queue_transactions_.reserve(max_size);
+  for (auto &shard : shards_) {
+    shard.queue_transactions.reserve(max_size / shards_.size());
+  }
+  for (auto &index_shard : hash_index_) {
+    index_shard.transactions.reserve(max_size / hash_index_.size());
+  }
+}
+
+size_t TransactionQueue::size() const { return size_; }
+
+TransactionQueue::Shard &TransactionQueue::getShard(const addr_t &sender) {
+  return shards_[std::hash<addr_t>{}(sender) % shards_.size()];
 }
 
-size_t TransactionQueue::size() const { return queue_transactions_.size(); }
+TransactionQueue::HashIndexShard &TransactionQueue::getHashIndexShard(const trx_hash_t &hash) const {
+  return hash_index_[std::hash<trx_hash_t>{}(hash) % hash_index_.size()];
+}
 
-void TransactionQueue::addTransaction(const SharedTransaction &transaction, bool proposable,
+void TransactionQueue::indexTransaction(const SharedTransaction &transaction) {
+  auto &index_shard = getHashIndexShard(transaction->getHash());
+  std::unique_lock lock(index_shard.mutex);
+  index_shard.transactions.emplace(transaction->getHash(), transaction);
+}
+
+void TransactionQueue::unindexTransaction(const trx_hash_t &hash) {
+  auto &index_shard = getHashIndexShard(hash);
+  std::unique_lock lock(index_shard.mutex);
+  index_shard.transactions.erase(hash);
+}
+
+void TransactionQueue::addTransaction(Shard &shard, const SharedTransaction &transaction, bool proposable,
                                       uint64_t last_block_number) {
   if (proposable) {
-    if (queue_transactions_.emplace(transaction->getHash(), transaction).second) {
+    if (shard.queue_transactions.emplace(transaction->getHash(), transaction).second) {
+      indexTransaction(transaction);
       data_size_ += transaction->getData().size();
-      queue_transactions_gas_prices_[transaction->getGasPrice()] += transaction->getGas();
+      shard.queue_transactions_gas_prices[transaction->getGasPrice()] += transaction->getGas();
+      size_++;
     }
   } else {
-    if (non_proposable_transactions_
+    if (shard.non_proposable_transactions
             .emplace(transaction->getHash(), std::pair<uint64_t, SharedTransaction>{last_block_number, transaction})
             .second) {
+      indexTransaction(transaction);
       data_size_ += transaction->getData().size();
+      non_proposable_size_++;
     }
   }
 }
 
-bool TransactionQueue::removeTransaction(const SharedTransaction &transaction, bool proposable) {
+bool TransactionQueue::removeTransaction(Shard &shard, const SharedTransaction &transaction, bool proposable) {
   if (proposable) {
-    if (queue_transactions_.erase(transaction->getHash()) > 0) {
+    if (shard.queue_transactions.erase(transaction->getHash()) > 0) {
+      unindexTransaction(transaction->getHash());
       data_size_ -= transaction->getData().size();
-      auto &gas_price_entry = queue_transactions_gas_prices_[transaction->getGasPrice()];
+      size_--;
+      auto &gas_price_entry = shard.queue_transactions_gas_prices[transaction->getGasPrice()];
       gas_price_entry -= transaction->getGas();
       if (gas_price_entry == 0) {
-        queue_transactions_gas_prices_.erase(transaction->getGasPrice());
+        shard.queue_transactions_gas_prices.erase(transaction->getGasPrice());
       }
       return true;
     }
   } else {
-    if (non_proposable_transactions_.erase(transaction->getHash()) > 0) {
+    if (shard.non_proposable_transactions.erase(transaction->getHash()) > 0) {
+      unindexTransaction(transaction->getHash());
       data_size_ -= transaction->getData().size();
+      non_proposable_size_--;
       return true;
     }
   }
   return false;
 }
 
-std::unordered_map<taraxa::trx_hash_t, std::pair<uint64_t, taraxa::SharedTransaction>>::iterator
-TransactionQueue::removeTransaction(
-    std::unordered_map<taraxa::trx_hash_t, std::pair<uint64_t, taraxa::SharedTransaction>>::iterator it) {
+TransactionQueue::NonProposableTransactions::iterator TransactionQueue::removeTransaction(
+    Shard &shard, NonProposableTransactions::iterator it) {
+  unindexTransaction(it->first);
   data_size_ -= it->second.second->getData().size();
-  return non_proposable_transactions_.erase(it);
+  non_proposable_size_--;
+  return shard.non_proposable_transactions.erase(it);
 }
 
 bool TransactionQueue::contains(const trx_hash_t &hash) const {
-  return queue_transactions_.contains(hash) || non_proposable_transactions_.contains(hash);
+  const auto &index_shard = getHashIndexShard(hash);
+  std::shared_lock lock(index_shard.mutex);
+  return index_shard.transactions.contains(hash);
 }
 
 std::shared_ptr<Transaction> TransactionQueue::get(const trx_hash_t &hash) const {
-  if (const auto it = queue_transactions_.find(hash); it != queue_transactions_.end()) {
+  const auto &index_shard = getHashIndexShard(hash);
+  std::shared_lock lock(index_shard.mutex);
+  if (const auto it = index_shard.transactions.find(hash); it != index_shard.transactions.end()) {
     return it->second;
   }
-
-  if (const auto transaction = non_proposable_transactions_.find(hash);
-      transaction != non_proposable_transactions_.end()) {
-    return transaction->second.second;
-  }
-
   return nullptr;
 }
 
 SharedTransactions TransactionQueue::getOrderedTransactions(uint64_t count) const {
   SharedTransactions ret;
-  ret.reserve(count);
-
-  std::multimap<val_t, std::shared_ptr<Transaction>, std::greater<val_t>> head_transactions;
-  std::unordered_map<addr_t, std::pair<std::map<val_t, std::shared_ptr<Transaction>>::const_iterator,
-                                       std::map<val_t, std::shared_ptr<Transaction>>::const_iterator>>
-      iterators;
+  ret.reserve(std::min<uint64_t>(count, size_));
+  forEachOrderedTransaction([&ret, count](const SharedTransaction &trx) {
+    ret.push_back(trx);
+    return ret.size() != count;
+  });
+  return ret;
+}
 
-  iterators.reserve(account_nonce_transactions_.size());
-  // For accounts with multiple transactions we will iterate one level at a time
-  for (const auto &account : account_nonce_transactions_) {
-    iterators.insert({account.first, {account.second.begin(), account.second.end()}});
+void TransactionQueue::forEachOrderedTransaction(const std::function<bool(const SharedTransaction &)> &callback,
+                                                 OrderedIterationPosition *position) const {
+  // Shards are always locked in the same order, writers never hold more than a single shard lock
+  std::vector<std::shared_lock<std::shared_mutex>> locks;
+  locks.reserve(shards_.size());
+  for (const auto &shard : shards_) {
+    locks.emplace_back(shard.mutex);
   }
 
-  for (auto it = iterators.begin(); it != iterators.end(); it++) {
-    head_transactions.insert({it->second.first->second->getGasPrice(), it->second.first->second});
-    // Increase iterator for an account
-    it->second.first++;
+  struct Candidate {
+    SharedTransaction trx;
+    // Remaining transactions of the same account
+    AccountTransactions::const_iterator next;
+    AccountTransactions::const_iterator end;
+    // Set only for the lowest nonce transaction of an account, next account of the shard becomes a candidate with it
+    const Shard *shard = nullptr;
+    AccountHeads::const_iterator head;
+  };
+  const auto cmp = [](const Candidate &a, const Candidate &b) {
+    return a.trx->getGasPrice() < b.trx->getGasPrice();
+  };
+  std::priority_queue<Candidate, std::vector<Candidate>, decltype(cmp)> candidates(cmp);
+
+  const auto push_account_head = [&candidates, position](const Shard &shard, AccountHeads::const_iterator head) {
+    // Accounts with all transactions consumed by previous iterations are skipped. Gas price of the next transaction of
+    // a partially consumed account does not bound the following accounts, so they are merged until an account which
+    // starts with its lowest nonce transaction
+    for (; head != shard.account_heads.end(); ++head) {
+      const auto &account_transactions = shard.account_nonce_transactions.at(head->second);
+      auto first = account_transactions.begin();
+      if (position) {
+        if (const auto it = position->find(head->second); it != position->end()) {
+          first = account_transactions.lower_bound(it->second);
+        }
+      }
+      if (first == account_transactions.begin()) {
+        candidates.push({first->second, std::next(first), account_transactions.end(), &shard, head});
+        return;
+      }
+      if (first != account_transactions.end()) {
+        candidates.push({first->second, std::next(first), account_transactions.end(), nullptr, {}});
+      }
+    }
+  };
+
+  // Only the best account of each shard is a candidate at the beginning, others are merged lazily
+  for (const auto &shard : shards_) {
+    push_account_head(shard, shard.account_heads.begin());
   }
-  while (!head_transactions.empty()) {
-    // Take transactions with highest gas and put it in ordered transactions
-    auto head_trx = head_transactions.begin();
-    ret.push_back(head_trx->second);
-    if (ret.size() == count) {
-      break;
+
+  while (!candidates.empty()) {
+    auto candidate = candidates.top();
+    candidates.pop();
+    if (!callback(candidate.trx)) {
+      return;
     }
-    // If there is next nonce transaction of same account put it in head transactions
-    auto &it = iterators[head_trx->second->getSender()];
-    head_transactions.erase(head_trx);
-    if (it.first != it.second) {
-      head_transactions.insert({it.first->second->getGasPrice(), it.first->second});
-      it.first++;
+    if (position) {
+      (*position)[candidate.trx->getSender()] = candidate.trx->getNonce() + 1;
+    }
+    if (candidate.shard) {
+      push_account_head(*candidate.shard, std::next(candidate.head));
+    }
+    // If there is next nonce transaction of same account it becomes a candidate
+    if (candidate.next != candidate.end) {
+      candidates.push({candidate.next->second, std::next(candidate.next), candidate.end, nullptr, {}});
     }
   }
+}
 
-  return ret;
+void TransactionQueue::eraseAccountHead(Shard &shard, const addr_t &sender,
+                                        const AccountTransactions &account_transactions) {
+  if (!account_transactions.empty()) {
+    shard.account_heads.erase({account_transactions.begin()->second->getGasPrice(), sender});
+  }
+}
+
+void TransactionQueue::addAccountHead(Shard &shard, const addr_t &sender,
+                                      const AccountTransactions &account_transactions) {
+  if (!account_transactions.empty()) {
+    shard.account_heads.emplace(account_transactions.begin()->second->getGasPrice(), sender);
+  }
 }
 
 std::vector<SharedTransactions> TransactionQueue::getAllTransactions() const {
   std::vector<SharedTransactions> ret;
-  ret.reserve(account_nonce_transactions_.size());
-  for (const auto &account_it : account_nonce_transactions_) {
-    SharedTransactions trxs_per_account;
-    trxs_per_account.reserve(account_it.second.size());
-    for (const auto &t : account_it.second) {
-      trxs_per_account.emplace_back(t.second);
+  for (const auto &shard : shards_) {
+    std::shared_lock lock(shard.mutex);
+    ret.reserve(ret.size() + shard.account_nonce_transactions.size());
+    for (const auto &account_it : shard.account_nonce_transactions) {
+      SharedTransactions trxs_per_account;
+      trxs_per_account.reserve(account_it.second.size());
+      for (const auto &t : account_it.second) {
+        trxs_per_account.emplace_back(t.second);
+      }
+      ret.emplace_back(std::move(trxs_per_account));
     }
-    ret.emplace_back(std::move(trxs_per_account));
   }
   return ret;
 }
 
 bool TransactionQueue::erase(const SharedTransaction &transaction) {
+  auto &shard = getShard(transaction->getSender());
+  std::unique_lock lock(shard.mutex);
+  return eraseFromShard(shard, transaction);
+}
+
+bool TransactionQueue::eraseFromShard(Shard &shard, const SharedTransaction &transaction) {
   // Find the hash
-  const auto it = queue_transactions_.find(transaction->getHash());
-  if (it == queue_transactions_.end()) {
-    return removeTransaction(transaction, false);
+  const auto it = shard.queue_transactions.find(transaction->getHash());
+  if (it == shard.queue_transactions.end()) {
+    return removeTransaction(shard, transaction, false);
   }
 
-  const auto &account_it = account_nonce_transactions_.find(it->second->getSender());
-  assert(account_it != account_nonce_transactions_.end());
+  const auto &account_it = shard.account_nonce_transactions.find(it->second->getSender());
+  assert(account_it != shard.account_nonce_transactions.end());
   const auto &nonce_it = account_it->second.find(it->second->getNonce());
   assert(nonce_it != account_it->second.end());
   assert(transaction->getHash() == nonce_it->second->getHash());
 
+  eraseAccountHead(shard, account_it->first, account_it->second);
   account_it->second.erase(nonce_it);
   if (account_it->second.size() == 0) {
-    account_nonce_transactions_.erase(account_it);
+    shard.account_nonce_transactions.erase(account_it);
+  } else {
+    addAccountHead(shard, account_it->first, account_it->second);
   }
-  return removeTransaction(transaction, true);
+  return removeTransaction(shard, transaction, true);
 }
 
 TransactionStatus TransactionQueue::insert(std::shared_ptr<Transaction> &&transaction, bool proposable,
                                            uint64_t last_block_number) {
   assert(transaction);
   const auto tx_hash = transaction->getHash();
+  // Transactions with the same hash always have the same sender so only the sender shard needs to be checked
+  auto &shard = getShard(transaction->getSender());
 
-  if (contains(tx_hash)) {
-    return TransactionStatus::Known;
-  }
+  {
+    std::unique_lock lock(shard.mutex);
+    if (shard.queue_transactions.contains(tx_hash) || shard.non_proposable_transactions.contains(tx_hash)) {
+      return TransactionStatus::Known;
+    }
 
-  if (data_size_ > kMaxDataSize) {
-    transaction_overflow_time_ = std::chrono::system_clock::now();
-    return TransactionStatus::Overflow;
-  }
+    if (data_size_ > kMaxDataSize) {
+      transaction_overflow_time_ = std::chrono::system_clock::now();
+      return TransactionStatus::Overflow;
+    }
 
-  if (proposable) {
-    const auto &account_it = account_nonce_transactions_.find(transaction->getSender());
-    if (account_it == account_nonce_transactions_.end()) {
-      account_nonce_transactions_[transaction->getSender()][transaction->getNonce()] = transaction;
-      addTransaction(transaction, proposable);
+    if (!proposable) {
+      if (non_proposable_size_ <= kNonProposableTransactionsMaxSize) {
+        addTransaction(shard, transaction, false, last_block_number);
+        known_txs_.insert(tx_hash);
+        return TransactionStatus::InsertedNonProposable;
+      } else {
+        transaction_overflow_time_ = std::chrono::system_clock::now();
+        return TransactionStatus::Overflow;
+      }
+    }
+
+    const auto &account_it = shard.account_nonce_transactions.find(transaction->getSender());
+    if (account_it == shard.account_nonce_transactions.end()) {
+      auto &account_transactions = shard.account_nonce_transactions[transaction->getSender()];
+      account_transactions[transaction->getNonce()] = transaction;
+      addAccountHead(shard, transaction->getSender(), account_transactions);
+      addTransaction(shard, transaction, proposable);
     } else {
       if (account_it->second.size() == kMaxSingleAccountTransactionsSize) {
         transaction_overflow_time_ = std::chrono::system_clock::now();
@@ -175,8 +294,10 @@ TransactionStatus TransactionQueue::insert(std::shared_ptr<Transaction> &&transa
       }
       const auto &nonce_it = account_it->second.find(transaction->getNonce());
       if (nonce_it == account_it->second.end()) {
-        account_nonce_transactions_[transaction->getSender()][transaction->getNonce()] = transaction;
-        addTransaction(transaction, proposable);
+        eraseAccountHead(shard, account_it->first, account_it->second);
+        account_it->second[transaction->getNonce()] = transaction;
+        addAccountHead(shard, account_it->first, account_it->second);
+        addTransaction(shard, transaction, proposable);
       } else {
         // It should not be possible that transaction is already inside due to verification done before
         assert(nonce_it->second->getHash() != tx_hash);
@@ -184,84 +305,97 @@ TransactionStatus TransactionQueue::insert(std::shared_ptr<Transaction> &&transa
         if (transaction->getGasPrice() > nonce_it->second->getGasPrice()) {
           // Place same nonce transaction with lower gas price in non proposable transactions since it could be
           // possible that some dag block might contain it
-          removeTransaction(nonce_it->second, true);
-          addTransaction(nonce_it->second, false, last_block_number);
+          removeTransaction(shard, nonce_it->second, true);
+          addTransaction(shard, nonce_it->second, false, last_block_number);
 
-          account_nonce_transactions_[transaction->getSender()][transaction->getNonce()] = transaction;
-          addTransaction(transaction, proposable);
+          eraseAccountHead(shard, account_it->first, account_it->second);
+          nonce_it->second = transaction;
+          addAccountHead(shard, account_it->first, account_it->second);
+          addTransaction(shard, transaction, proposable);
         } else {
-          addTransaction(transaction, false, last_block_number);
+          addTransaction(shard, transaction, false, last_block_number);
         }
       }
     }
+  }
 
-    const auto queue_size = size();
-    // This check if priority_queue_ is not bigger than max size if so we delete 1% of transactions
-    if (queue_size > kMaxSize) [[unlikely]] {
-      auto ordered_transactions = getOrderedTransactions(queue_size);
-      uint32_t counter = 0;
-      for (auto it = ordered_transactions.rbegin(); it != ordered_transactions.rend(); it++) {
-        transaction_overflow_time_ = std::chrono::system_clock::now();
-        erase(*it);
-        known_txs_.erase((*it)->getHash());
-        counter++;
-        if (counter >= queue_size / 100) break;
-      }
-      if (!queue_transactions_.contains(tx_hash)) {
-        return TransactionStatus::Overflow;
-      }
-    }
-    known_txs_.insert(tx_hash);
-  } else {
-    if (non_proposable_transactions_.size() <= kNonProposableTransactionsMaxSize) {
-      addTransaction(transaction, false, last_block_number);
-      known_txs_.insert(tx_hash);
-      return TransactionStatus::InsertedNonProposable;
-    } else {
-      transaction_overflow_time_ = std::chrono::system_clock::now();
+  // This check if queue is not bigger than max size if so we delete 1% of transactions
+  if (size() > kMaxSize) [[unlikely]] {
+    trimQueue();
+    std::shared_lock lock(shard.mutex);
+    if (!shard.queue_transactions.contains(tx_hash)) {
       return TransactionStatus::Overflow;
     }
   }
+  known_txs_.insert(tx_hash);
   return TransactionStatus::Inserted;
 }
 
+void TransactionQueue::trimQueue() {
+  std::unique_lock trim_lock(trim_mutex_);
+  // Queue might have been already trimmed by a concurrent insert
+  const auto queue_size = size();
+  if (queue_size <= kMaxSize) {
+    return;
+  }
+
+  auto ordered_transactions = getOrderedTransactions(queue_size);
+  uint32_t counter = 0;
+  for (auto it = ordered_transactions.rbegin(); it != ordered_transactions.rend(); it++) {
+    transaction_overflow_time_ = std::chrono::system_clock::now();
+    erase(*it);
+    known_txs_.erase((*it)->getHash());
+    counter++;
+    if (counter >= queue_size / 100) break;
+  }
+}
+
 void TransactionQueue::blockFinalized(uint64_t block_number) {
-  for (auto it = non_proposable_transactions_.begin(); it != non_proposable_transactions_.end();) {
-    if (it->second.first + kNonProposableTransactionsPeriodExpiryLimit < block_number) {
-      known_txs_.erase(it->first);
-      it = removeTransaction(it);
-    } else {
-      ++it;
+  for (auto &shard : shards_) {
+    std::unique_lock lock(shard.mutex);
+    for (auto it = shard.non_proposable_transactions.begin(); it != shard.non_proposable_transactions.end();) {
+      if (it->second.first + kNonProposableTransactionsPeriodExpiryLimit < block_number) {
+        known_txs_.erase(it->first);
+        it = removeTransaction(shard, it);
+      } else {
+        ++it;
+      }
     }
   }
 }
 
 void TransactionQueue::purge() {
-  for (auto account_it = account_nonce_transactions_.begin(); account_it != account_nonce_transactions_.end();) {
-    const auto account = final_chain_->getAccount(account_it->first);
-    if (account.has_value()) {
-      for (auto nonce_it = account_it->second.begin(); nonce_it != account_it->second.end();) {
-        if (nonce_it->first < account->nonce) {
-          removeTransaction(nonce_it->second, true);
-          nonce_it = account_it->second.erase(nonce_it);
-        } else {
-          break;
+  for (auto &shard : shards_) {
+    std::unique_lock lock(shard.mutex);
+    for (auto account_it = shard.account_nonce_transactions.begin();
+         account_it != shard.account_nonce_transactions.end();) {
+      const auto account = final_chain_->getAccount(account_it->first);
+      if (account.has_value()) {
+        eraseAccountHead(shard, account_it->first, account_it->second);
+        for (auto nonce_it = account_it->second.begin(); nonce_it != account_it->second.end();) {
+          if (nonce_it->first < account->nonce) {
+            removeTransaction(shard, nonce_it->second, true);
+            nonce_it = account_it->second.erase(nonce_it);
+          } else {
+            break;
+          }
         }
-      }
 
-      if (account_it->second.size() == 0) {
-        account_it = account_nonce_transactions_.erase(account_it);
+        if (account_it->second.size() == 0) {
+          account_it = shard.account_nonce_transactions.erase(account_it);
+        } else {
+          addAccountHead(shard, account_it->first, account_it->second);
+          account_it++;
+        }
       } else {
         account_it++;
       }
-    } else {
-      account_it++;
     }
   }
 }
 
 bool TransactionQueue::nonProposableTransactionsOverTheLimit() const {
-  return non_proposable_transactions_.size() >= kNonProposableTransactionsMaxSize;
+  return non_proposable_size_ >= kNonProposableTransactionsMaxSize;
 }
 
 void TransactionQueue::markTransactionKnown(const trx_hash_t &trx_hash) { known_txs_.insert(trx_hash); }
@@ -269,8 +403,17 @@ void TransactionQueue::markTransactionKnown(const trx_hash_t &trx_hash) { known_
 bool TransactionQueue::isTransactionKnown(const trx_hash_t &trx_hash) const { return known_txs_.contains(trx_hash); }
 
 val_t TransactionQueue::getMinGasPriceForBlockInclusion(uint64_t limit) const {
+  // Merge gas price indexes of all shards
+  std::map<val_t, uint64_t, std::greater<val_t>> gas_prices;
+  for (const auto &shard : shards_) {
+    std::shared_lock lock(shard.mutex);
+    for (const auto &gas_price : shard.queue_transactions_gas_prices) {
+      gas_prices[gas_price.first] += gas_price.second;
+    }
+  }
+
   uint64_t total_gas = 0;
-  for (const auto &gas_price : queue_transactions_gas_prices_) {
+  for (const auto &gas_price : gas_prices) {
     total_gas += gas_price.second;
     if (total_gas >= limit) {
       return gas_price.first + 1;
@@ -279,4 +422,4 @@ val_t TransactionQueue::getMinGasPriceForBlockInclusion(uint64_t limit) const {
   return 1;
 }
 
-}  // namespace taraxa
\ No newline at end of file
+}  // namespace taraxa
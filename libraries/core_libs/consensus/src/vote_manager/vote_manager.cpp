@@ -3,8 +3,12 @@
 #include <libdevcore/SHA3.h>
 #include <libdevcrypto/Common.h>
 
+#include <algorithm>
+#include <future>
+#include <map>
 #include <optional>
 #include <shared_mutex>
+#include <unordered_set>
 
 #include "network/network.hpp"
 #include "pbft/pbft_manager.hpp"
@@ -21,7 +25,8 @@ VoteManager::VoteManager(const FullNodeConfig& config, std::shared_ptr<DbStorage
       key_manager_(std::move(key_manager)),
       slashing_manager_(std::move(slashing_manager)),
       verified_votes_(dev::toAddress(config.getFirstWallet().node_secret)),
-      already_validated_votes_(1000000, 1000) {
+      already_validated_votes_(1000000, 1000),
+      votes_validation_thread_pool_(std::clamp(std::thread::hardware_concurrency() / 2, 1u, 4u)) {
   // Use first wallet as default node_addr
   const auto& node_addr = dev::toAddress(config.getFirstWallet().node_secret);
   LOG_OBJECTS_CREATE("VOTE_MGR");
@@ -675,7 +680,8 @@ std::shared_ptr<PbftVote> VoteManager::generateVote(const blk_hash_t& blockhash,
   return std::make_shared<PbftVote>(wallet.node_secret, std::move(vrf_sortition), blockhash);
 }
 
-std::pair<bool, std::string> VoteManager::validateVote(const std::shared_ptr<PbftVote>& vote, bool strict) const {
+std::pair<bool, std::string> VoteManager::validateVote(const std::shared_ptr<PbftVote>& vote, bool strict,
+                                                       bool vrf_verified) const {
   std::stringstream err_msg;
   const uint64_t vote_period = vote->getPeriod();
 
@@ -703,7 +709,7 @@ std::pair<bool, std::string> VoteManager::validateVote(const std::shared_ptr<Pbf
       return {false, err_msg.str()};
     }
 
-    if (!vote->verifyVrfSortition(*pk, strict)) {
+    if (!vrf_verified && !vote->verifyVrfSortition(*pk, strict)) {
       err_msg << "Invalid vote " << vote->getHash() << ": invalid vrf proof";
       return {false, err_msg.str()};
     }
@@ -727,6 +733,150 @@ std::pair<bool, std::string> VoteManager::validateVote(const std::shared_ptr<Pbf
   return {true, ""};
 }
 
+bool VoteManager::preverifyVote(const std::shared_ptr<PbftVote>& vote, bool strict) const {
+  try {
+    if (!vote->verifyVote()) {
+      return false;
+    }
+
+    // Vrf key is taken from the cache, otherwise it is looked up in dpos state, which fails for future periods
+    const auto pk = key_manager_->getVrfKey(vote->getPeriod() - 1, vote->getVoterAddr());
+    return pk && vote->verifyVrfSortition(*pk, strict);
+  } catch (...) {
+    return false;
+  }
+}
+
+void VoteManager::recoverVoters(const std::vector<std::shared_ptr<PbftVote>>& votes) const {
+  votes_validation_thread_pool_.parallel_for(
+      votes.size(), kMinVotesForParallelValidation, [&votes](size_t start, size_t end) {
+        for (size_t i = start; i < end; ++i) {
+          try {
+            votes[i]->getVoter();
+          } catch (...) {
+            // Invalid signature is reported by verifyVote during validation
+          }
+        }
+      });
+}
+
+std::vector<std::optional<std::pair<bool, std::string>>> VoteManager::validateVotes(
+    const std::vector<std::shared_ptr<PbftVote>>& votes, bool strict) const {
+  std::vector<std::optional<std::pair<bool, std::string>>> results(votes.size());
+
+  // Votes that were not validated yet, duplicates are skipped
+  std::vector<std::shared_ptr<PbftVote>> votes_to_validate;
+  std::vector<size_t> votes_to_validate_idx;
+  votes_to_validate.reserve(votes.size());
+  votes_to_validate_idx.reserve(votes.size());
+  std::unordered_set<vote_hash_t> batch_votes;
+  for (size_t i = 0; i < votes.size(); i++) {
+    const auto& vote = votes[i];
+    if (already_validated_votes_.contains(vote->getHash()) || !batch_votes.insert(vote->getHash()).second) {
+      continue;
+    }
+    votes_to_validate.push_back(vote);
+    votes_to_validate_idx.push_back(i);
+  }
+
+  // Signature recovery is the most expensive part of the validation, so it is done before voters are needed
+  recoverVoters(votes_to_validate);
+
+  struct VoterInfo {
+    uint64_t dpos_votes_count = 0;
+    std::shared_ptr<vrf_wrapper::vrf_pk_t> vrf_key;
+  };
+  std::map<std::pair<PbftPeriod, addr_t>, VoterInfo> voters_info;
+  std::unordered_map<PbftPeriod, uint64_t> total_dpos_votes_counts;
+
+  // Votes that passed the signature & stake checks, their vrf proofs are verified afterwards
+  std::vector<std::tuple<size_t, const VoterInfo*, uint64_t>> votes_to_verify;
+  votes_to_verify.reserve(votes_to_validate.size());
+
+  for (size_t j = 0; j < votes_to_validate.size(); j++) {
+    const auto i = votes_to_validate_idx[j];
+    const auto& vote = votes_to_validate[j];
+    std::stringstream err_msg;
+    const uint64_t vote_period = vote->getPeriod();
+    try {
+      if (!vote->verifyVote()) {
+        already_validated_votes_.insert(vote->getHash());
+        err_msg << "Invalid vote " << vote->getHash() << ": invalid signature";
+        results[i] = {false, err_msg.str()};
+        continue;
+      }
+
+      auto voter_info_it = voters_info.find({vote_period, vote->getVoterAddr()});
+      if (voter_info_it == voters_info.end()) {
+        VoterInfo voter_info;
+        voter_info.dpos_votes_count = final_chain_->dposEligibleVoteCount(vote_period - 1, vote->getVoterAddr());
+        if (voter_info.dpos_votes_count) {
+          voter_info.vrf_key = key_manager_->getVrfKey(vote_period - 1, vote->getVoterAddr());
+        }
+        voter_info_it = voters_info.emplace(std::make_pair(vote_period, vote->getVoterAddr()), voter_info).first;
+      }
+
+      auto total_dpos_votes_count_it = total_dpos_votes_counts.find(vote_period);
+      if (total_dpos_votes_count_it == total_dpos_votes_counts.end()) {
+        total_dpos_votes_count_it =
+            total_dpos_votes_counts.emplace(vote_period, final_chain_->dposEligibleTotalVoteCount(vote_period - 1))
+                .first;
+      }
+
+      // Mark vote as validated only after getting values from dpos contract, same as in validateVote
+      already_validated_votes_.insert(vote->getHash());
+
+      if (voter_info_it->second.dpos_votes_count == 0) {
+        err_msg << "Invalid vote " << vote->getHash() << ": author " << vote->getVoterAddr() << " has zero stake";
+        results[i] = {false, err_msg.str()};
+        continue;
+      }
+
+      if (!voter_info_it->second.vrf_key) {
+        err_msg << "No vrf key mapped for vote author " << vote->getVoterAddr();
+        results[i] = {false, err_msg.str()};
+        continue;
+      }
+
+      votes_to_verify.emplace_back(i, &voter_info_it->second, total_dpos_votes_count_it->second);
+    } catch (state_api::ErrFutureBlock& e) {
+      err_msg << "Unable to validate vote " << vote->getHash() << " against dpos contract. It's period (" << vote_period
+              << ") is too far ahead of actual finalized pbft chain size (" << final_chain_->lastBlockNumber()
+              << "). Err msg: " << e.what();
+      results[i] = {false, err_msg.str()};
+    } catch (...) {
+      err_msg << "Invalid vote " << vote->getHash() << ": unknown error during validation";
+      results[i] = {false, err_msg.str()};
+    }
+  }
+
+  // Each vote is verified by exactly one thread, so results can be written without synchronization
+  votes_validation_thread_pool_.parallel_for(
+      votes_to_verify.size(), kMinVotesForParallelValidation, [&](size_t start, size_t end) {
+        for (size_t i = start; i < end; ++i) {
+          const auto& [vote_idx, voter_info, total_dpos_votes_count] = votes_to_verify[i];
+          const auto& vote = votes[vote_idx];
+          std::stringstream err_msg;
+          try {
+            if (!vote->verifyVrfSortition(*voter_info->vrf_key, strict)) {
+              err_msg << "Invalid vote " << vote->getHash() << ": invalid vrf proof";
+            } else if (!vote->calculateWeight(voter_info->dpos_votes_count, total_dpos_votes_count,
+                                              getPbftSortitionThreshold(total_dpos_votes_count, vote->getType()))) {
+              err_msg << "Invalid vote " << vote->getHash() << ": zero weight";
+            } else {
+              results[vote_idx] = {true, ""};
+              continue;
+            }
+          } catch (...) {
+            err_msg << "Invalid vote " << vote->getHash() << ": unknown error during validation";
+          }
+          results[vote_idx] = {false, err_msg.str()};
+        }
+      });
+
+  return results;
+}
+
 std::optional<uint64_t> VoteManager::getPbftTwoTPlusOne(PbftPeriod pbft_period, PbftVoteTypes vote_type) const {
   // Check cache first
   {
@@ -38,12 +38,15 @@ class Transaction final : public std::enable_shared_from_this<Transaction> {
   response::Value getV() const noexcept;
 
  private:
+  // Loads receipt view on first access
+  const ::taraxa::TransactionReceiptView* receipt() const noexcept;
+
   std::shared_ptr<::taraxa::final_chain::FinalChain> final_chain_;
   std::shared_ptr<::taraxa::TransactionManager> trx_manager_;
   std::function<std::shared_ptr<object::Block>(::taraxa::EthBlockNumber)> get_block_by_num_;
   std::shared_ptr<::taraxa::Transaction> transaction_;
   // Caching for performance
-  mutable std::optional<::taraxa::TransactionReceipt> receipt_;
+  mutable std::optional<::taraxa::TransactionReceiptView> receipt_;
   ::taraxa::TransactionLocation location_;
 };
 
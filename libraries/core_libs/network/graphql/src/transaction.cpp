@@ -51,50 +51,59 @@ response::Value Transaction::getInputData() const noexcept {
 
 std::shared_ptr<object::Block> Transaction::getBlock() const { return get_block_by_num_(location_.period); }
 
-std::optional<response::Value> Transaction::getStatus() const noexcept {
-  if (!receipt_) {
-    receipt_ = final_chain_->transactionReceipt(location_.period, location_.position, transaction_->getHash());
-    if (!receipt_) return std::nullopt;
+const ::taraxa::TransactionReceiptView* Transaction::receipt() const noexcept {
+  if (receipt_) {
+    return &*receipt_;
+  }
+  if (auto receipts = final_chain_->blockReceiptsView(location_.period);
+      receipts && location_.position < receipts->size()) {
+    return &receipt_.emplace(receipts->at(location_.position));
   }
-  return response::Value(static_cast<int>(receipt_->status_code));
+  // Receipts of old blocks are stored by transaction hash
+  auto receipt = final_chain_->transactionReceipt(location_.period, location_.position, transaction_->getHash());
+  if (!receipt) {
+    return nullptr;
+  }
+  auto rlp = std::make_shared<const ::taraxa::bytes>(::taraxa::util::rlp_enc(*receipt));
+  return &receipt_.emplace(rlp, dev::bytesConstRef(rlp.get()));
+}
+
+std::optional<response::Value> Transaction::getStatus() const noexcept {
+  const auto r = receipt();
+  if (!r) return std::nullopt;
+  return response::Value(static_cast<int>(r->statusCode()));
 }
 
 std::optional<response::Value> Transaction::getGasUsed() const noexcept {
-  if (!receipt_) {
-    receipt_ = final_chain_->transactionReceipt(location_.period, location_.position, transaction_->getHash());
-    if (!receipt_) return std::nullopt;
-  }
-  return response::Value(static_cast<int>(receipt_->gas_used));
+  const auto r = receipt();
+  if (!r) return std::nullopt;
+  return response::Value(static_cast<int>(r->gasUsed()));
 }
 
 std::optional<response::Value> Transaction::getCumulativeGasUsed() const noexcept {
-  if (!receipt_) {
-    receipt_ = final_chain_->transactionReceipt(location_.period, location_.position, transaction_->getHash());
-    if (!receipt_) return std::nullopt;
-  }
-  return response::Value(static_cast<int>(receipt_->cumulative_gas_used));
+  const auto r = receipt();
+  if (!r) return std::nullopt;
+  return response::Value(static_cast<int>(r->cumulativeGasUsed()));
 }
 
 std::shared_ptr<object::Account> Transaction::getCreatedContract(std::optional<response::Value>&&) const noexcept {
-  if (!receipt_) {
-    receipt_ = final_chain_->transactionReceipt(location_.period, location_.position, transaction_->getHash());
-    if (!receipt_) return nullptr;
-  }
-  if (!receipt_->new_contract_address) return nullptr;
-  return std::make_shared<object::Account>(std::make_shared<Account>(final_chain_, *receipt_->new_contract_address));
+  const auto r = receipt();
+  if (!r) return nullptr;
+  const auto new_contract_address = r->newContractAddress();
+  if (!new_contract_address) return nullptr;
+  return std::make_shared<object::Account>(std::make_shared<Account>(final_chain_, *new_contract_address));
 }
 
 std::optional<std::vector<std::shared_ptr<object::Log>>> Transaction::getLogs() const noexcept {
-  std::vector<std::shared_ptr<object::Log>> logs;
-  if (!receipt_) {
-    receipt_ = final_chain_->transactionReceipt(location_.period, location_.position, transaction_->getHash());
-    if (!receipt_) return std::nullopt;
-  }
+  const auto r = receipt();
+  if (!r) return std::nullopt;
 
-  for (int i = 0; i < static_cast<int>(receipt_->logs.size()); ++i) {
+  std::vector<std::shared_ptr<object::Log>> logs;
+  logs.reserve(r->logsCount());
+  r->forEachLog([&](size_t i, const ::taraxa::LogEntryView& log) {
     logs.push_back(std::make_shared<object::Log>(
-        std::make_shared<Log>(final_chain_, trx_manager_, shared_from_this(), receipt_->logs[i], i)));
-  }
+        std::make_shared<Log>(final_chain_, trx_manager_, shared_from_this(), log.decode(), static_cast<int>(i))));
+  });
 
   return logs;
 }
@@ -74,9 +74,9 @@ int DagBlock::getTransactionCount() const noexcept { return static_cast<int>(dag
 
 std::optional<std::vector<std::shared_ptr<object::Transaction>>> DagBlock::getTransactions() const noexcept {
   std::vector<std::shared_ptr<object::Transaction>> transactions_result;
-  for (const auto& trx_hash : dag_block_->getTrxs()) {
-    transactions_result.push_back(std::make_shared<object::Transaction>(std::make_shared<Transaction>(
-        final_chain_, transaction_manager_, get_block_by_num_, transaction_manager_->getTransaction(trx_hash))));
+  for (auto& trx : transaction_manager_->getTransactionsByHashes(dag_block_->getTrxs())) {
+    transactions_result.push_back(std::make_shared<object::Transaction>(
+        std::make_shared<Transaction>(final_chain_, transaction_manager_, get_block_by_num_, std::move(trx))));
   }
 
   return transactions_result;
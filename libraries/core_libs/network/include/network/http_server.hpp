@@ -3,6 +3,7 @@
 #include <atomic>
 #include <boost/asio.hpp>
 #include <boost/beast.hpp>
+#include <chrono>
 
 #include "common/types.hpp"
 #include "logger/logger.hpp"
@@ -14,8 +15,20 @@ class HttpProcessor {
  public:
   using Request = boost::beast::http::request<boost::beast::http::string_body>;
   using Response = boost::beast::http::response<boost::beast::http::string_body>;
+  // Sends next chunk of streamed response body, returns false if it could not be sent
+  using ChunkWriter = std::function<bool(std::string_view chunk)>;
+  // Produces streamed response body, throws if the response can't be completed
+  using BodyStreamer = std::function<void(const ChunkWriter& write_chunk)>;
+
+  virtual ~HttpProcessor() = default;
 
   virtual Response process(const Request& request) = 0;
+
+  /**
+   * @brief Returns streamer if response body should be produced incrementally and sent with chunked transfer encoding
+   * instead of being processed by process(). Streamed response header is filled into header
+   */
+  virtual BodyStreamer stream(const Request& /*request*/, Response& /*header*/) { return {}; }
 };
 
 class HttpConnection;
@@ -74,6 +87,13 @@ class HttpConnection : public std::enable_shared_from_this<HttpConnection> {
   boost::beast::flat_buffer buffer_;
   boost::beast::http::request<boost::beast::http::string_body> request_;
   boost::beast::http::response<boost::beast::http::string_body> response_;
+
+ private:
+  // Sends streamed response synchronously, returns false if the response could not be completed. Connection is
+  // dropped if a single chunk is not written within kStreamedWriteTimeout
+  bool writeStreamed(const HttpProcessor::BodyStreamer& streamer);
+
+  static constexpr std::chrono::seconds kStreamedWriteTimeout{30};
 };
 
 }  // namespace taraxa::net
\ No newline at end of file
@@ -2,12 +2,16 @@
 
 #include <json/json.h>
 
+#include <chrono>
 #include <functional>
 #include <list>
 #include <map>
 #include <memory>
+#include <mutex>
+#include <string_view>
 
 #include "network/rpc/eth/LogFilter.hpp"
+#include "network/rpc/eth/LogFilterIndex.hpp"
 
 enum class SubscriptionType {
   HEADS,
@@ -21,16 +25,68 @@ enum class SubscriptionType {
 
 namespace taraxa::net {
 
+const char* subscriptionTypeName(SubscriptionType type);
+
+/**
+ * @brief Payload of a single subscription event. Each payload variant (full or reduced, e.g. hash only) is serialized
+ *        at most once and the immutable buffer is shared by all sessions and subscriptions requesting that variant.
+ *
+ * @note Not thread safe - it is created and consumed by the thread fanning the event out to the sessions
+ */
+class SubscriptionPayload {
+ public:
+  using Buffer = std::shared_ptr<const std::string>;
+  using Reducer = Json::Value (*)(const Json::Value&);
+
+  explicit SubscriptionPayload(Json::Value payload);
+
+  const Buffer& full();
+  /**
+   * @param reducer creates reduced variant of the payload, must be the same for all subscriptions of the event type
+   */
+  const Buffer& reduced(Reducer reducer);
+  std::chrono::steady_clock::time_point createdAt() const { return created_at_; }
+
+ private:
+  const Json::Value payload_;
+  Buffer full_;
+  Buffer reduced_;
+  const std::chrono::steady_clock::time_point created_at_;
+};
+
+/**
+ * @brief eth_subscription notification that shares serialized result with all other subscriptions of the event
+ */
+struct SubscriptionMessage {
+  // Envelope up to the result: {"jsonrpc":"2.0","method":"eth_subscription","params":{"result":
+  static std::string_view head();
+
+  SubscriptionType type;
+  SubscriptionPayload::Buffer result;
+  // Envelope after the result: ,"subscription":"0x1"}}
+  std::string tail;
+  std::chrono::steady_clock::time_point created_at;
+};
+
 class Subscription {
  public:
-  Subscription(int id) : id_(id) {}
+  Subscription(int id);
   virtual ~Subscription() = default;
   virtual SubscriptionType getType() const = 0;
   int getId() const { return id_; }
-  virtual std::string processPayload(Json::Value payload) const = 0;
+  SubscriptionMessage makeMessage(SubscriptionPayload& payload) const;
+  SubscriptionMessage makeMessage(SubscriptionPayload::Buffer result,
+                                  std::chrono::steady_clock::time_point created_at) const;
 
  protected:
+  virtual const SubscriptionPayload::Buffer& selectPayload(SubscriptionPayload& payload) const {
+    return payload.full();
+  }
+
   int id_;
+
+ private:
+  const std::string tail_;
 };
 
 class HeadsSubscription : public Subscription {
@@ -39,7 +95,6 @@ class HeadsSubscription : public Subscription {
   static constexpr SubscriptionType type = SubscriptionType::HEADS;
 
   SubscriptionType getType() const override { return type; }
-  std::string processPayload(Json::Value payload) const override;
 };
 
 class DagBlocksSubscription : public Subscription {
@@ -47,7 +102,9 @@ class DagBlocksSubscription : public Subscription {
   explicit DagBlocksSubscription(int id, bool hash_only = false) : Subscription(id), full_data_(hash_only) {}
   static constexpr SubscriptionType type = SubscriptionType::DAG_BLOCKS;
   SubscriptionType getType() const override { return type; }
-  std::string processPayload(Json::Value payload) const override;
+
+ protected:
+  const SubscriptionPayload::Buffer& selectPayload(SubscriptionPayload& payload) const override;
 
  private:
   bool full_data_ = false;
@@ -58,7 +115,6 @@ class TransactionsSubscription : public Subscription {
   explicit TransactionsSubscription(int id) : Subscription(id) {}
   static constexpr SubscriptionType type = SubscriptionType::TRANSACTIONS;
   SubscriptionType getType() const override { return type; }
-  std::string processPayload(Json::Value payload) const override;
 };
 
 class DagBlockFinalizedSubscription : public Subscription {
@@ -66,7 +122,6 @@ class DagBlockFinalizedSubscription : public Subscription {
   explicit DagBlockFinalizedSubscription(int id) : Subscription(id) {}
   static constexpr SubscriptionType type = SubscriptionType::DAG_BLOCK_FINALIZED;
   SubscriptionType getType() const override { return type; }
-  std::string processPayload(Json::Value payload) const override;
 };
 
 class PbftBlockExecutedSubscription : public Subscription {
@@ -74,7 +129,9 @@ class PbftBlockExecutedSubscription : public Subscription {
   explicit PbftBlockExecutedSubscription(int id, bool full_block = false) : Subscription(id), full_block_(full_block) {}
   static constexpr SubscriptionType type = SubscriptionType::PBFT_BLOCK_EXECUTED;
   SubscriptionType getType() const override { return type; }
-  std::string processPayload(Json::Value payload) const override;
+
+ protected:
+  const SubscriptionPayload::Buffer& selectPayload(SubscriptionPayload& payload) const override;
 
  private:
   bool full_block_ = false;
@@ -86,7 +143,9 @@ class PillarBlockSubscription : public Subscription {
       : Subscription(id), include_signatures_(include_signatures) {}
   static constexpr SubscriptionType type = SubscriptionType::PILLAR_BLOCK;
   SubscriptionType getType() const override { return type; }
-  std::string processPayload(Json::Value payload) const override;
+
+ protected:
+  const SubscriptionPayload::Buffer& selectPayload(SubscriptionPayload& payload) const override;
 
  private:
   bool include_signatures_ = false;
@@ -97,26 +156,49 @@ class LogsSubscription : public Subscription {
   explicit LogsSubscription(int id, rpc::eth::LogFilter&& filter) : Subscription(id), filter_(filter) {}
   static constexpr SubscriptionType type = SubscriptionType::LOGS;
   SubscriptionType getType() const override { return type; }
-  std::string processPayload(Json::Value payload) const override;
-  rpc::eth::LogFilter getFilter() const { return filter_; }
+  const rpc::eth::LogFilter& getFilter() const { return filter_; }
 
  private:
   rpc::eth::LogFilter filter_;
 };
 
+/**
+ * @brief Logs of a single block. Every matched log entry is serialized at most once and shared by all sessions and
+ *        subscriptions it matches
+ *
+ * @note Not thread safe - it is created and consumed by the thread fanning the event out to the sessions
+ */
+class LogsSubscriptionPayload {
+ public:
+  LogsSubscriptionPayload(const final_chain::BlockHeader& header, const TransactionHashes& trx_hashes,
+                          const TransactionReceipts& receipts);
+
+  const final_chain::BlockHeader& header;
+  const TransactionHashes& trx_hashes;
+  const TransactionReceipts& receipts;
+
+  const SubscriptionPayload::Buffer& serialize(const rpc::eth::LocalisedLogEntry& log);
+  std::chrono::steady_clock::time_point createdAt() const { return created_at_; }
+
+ private:
+  // [trx position, log position in receipt] -> serialized log
+  std::map<std::pair<uint32_t, uint64_t>, SubscriptionPayload::Buffer> serialized_logs_;
+  const std::chrono::steady_clock::time_point created_at_;
+};
+
 class Subscriptions {
  public:
-  Subscriptions(std::function<void(std::string&&)> send) : send_(send) {}
+  Subscriptions(std::function<void(SubscriptionMessage&&)> send) : send_(send) {}
   int addSubscription(std::shared_ptr<Subscription> subscription);
   bool removeSubscription(int id);
-  void process(SubscriptionType type, const Json::Value& payload);
-  void processLogs(const final_chain::BlockHeader& header, TransactionHashes trx_hashes,
-                   const TransactionReceipts& receipts);
+  void process(SubscriptionType type, SubscriptionPayload& payload);
+  void processLogs(LogsSubscriptionPayload& payload);
 
  private:
-  std::function<void(std::string&&)> send_;
+  std::function<void(SubscriptionMessage&&)> send_;
   std::map<uint64_t, std::shared_ptr<Subscription>> subscriptions_;
   std::map<SubscriptionType, std::list<uint64_t>> subscriptions_by_type_;
+  rpc::eth::LogFilterIndex<uint64_t> logs_index_;
   std::mutex subscriptions_mutex_;
 };
 }  // namespace taraxa::net
\ No newline at end of file
@@ -15,6 +15,9 @@ class IDagBlockPacketHandler : public ExtSyncingPacketHandler {
   void onNewBlockVerified(const std::shared_ptr<DagBlock> &block, bool proposed, const SharedTransactions &trxs);
   virtual void sendBlockWithTransactions(const std::shared_ptr<TaraxaPeer> &peer,
                                          const std::shared_ptr<DagBlock> &block, SharedTransactions &&trxs) = 0;
+  // Sends the same block with transactions to multiple peers, packet is encoded and compressed only once
+  virtual void broadcastBlockWithTransactions(const std::vector<std::shared_ptr<TaraxaPeer>> &peers,
+                                              const std::shared_ptr<DagBlock> &block, SharedTransactions &&trxs) = 0;
 
   // Note: Used only in tests
   void requestDagBlocks(std::shared_ptr<TaraxaPeer> peer);
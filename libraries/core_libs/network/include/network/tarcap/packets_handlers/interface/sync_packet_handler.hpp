@@ -19,18 +19,21 @@ class ISyncPacketHandler : public ExtSyncingPacketHandler {
   void startSyncingPbft();
 
   /**
-   * @brief Send sync request to the current syncing peer with specified request_period
+   * @brief Send sync requests for chunks of missing periods to idle peers, the last chunk is requested from the current
+   *        syncing peer
    *
-   * @param request_period
-   *
-   * @return true if sync request was sent, otherwise false
+   * @return false if there is nothing more to be synced from peers, otherwise true
    */
-  virtual bool syncPeerPbft(PbftPeriod request_period);
+  virtual bool requestPbftSyncChunks();
 
   void sendStatusToPeers();
 
   virtual bool sendStatus(const dev::p2p::NodeID& node_id, bool initial);
 
+ protected:
+  // Max number of chunks that can be synced ahead of the PBFT chain
+  static constexpr PbftPeriod kMaxSyncAheadChunks = 10;
+
  private:
   const h256 kGenesisHash;
 };
@@ -2,6 +2,7 @@
 
 #include "network/tarcap/packets_handlers/latest/common/packet_handler.hpp"
 #include "transaction/transaction.hpp"
+#include "transaction/transaction_announcement_log.hpp"
 
 namespace taraxa::network::tarcap {
 
@@ -19,6 +20,19 @@ class ITransactionPacketHandler : public PacketHandler {
    */
   void periodicSendTransactions(std::vector<SharedTransactions>&& transactions);
 
+  /**
+   * @brief Sends transactions inserted into the pool since the previous call to all connected peers
+   * @note This method is used as periodic event to broadcast transactions to the other peers in network. Only peers
+   *       that did not receive pool snapshot yet or fell behind the announcement log get the whole pool
+   *
+   * @param announcements log of proposable transactions inserted into the pool
+   * @param pool_snapshot returns all pool transactions grouped per account
+   * @param get_pooled returns transaction if it is still in the pool, nullptr otherwise
+   */
+  void periodicSendNewTransactions(const TransactionAnnouncementLog& announcements,
+                                   const std::function<std::vector<SharedTransactions>()>& pool_snapshot,
+                                   const std::function<SharedTransaction(const trx_hash_t&)>& get_pooled);
+
   /**
    * @brief Send transactions
    *
@@ -38,7 +52,53 @@ class ITransactionPacketHandler : public PacketHandler {
   std::vector<std::pair<std::shared_ptr<TaraxaPeer>, std::pair<SharedTransactions, std::vector<trx_hash_t>>>>
   transactionsToSendToPeers(std::vector<SharedTransactions>&& transactions);
 
+  /**
+   * @brief select which newly announced transactions and hashes to send to which connected peer and advance peers
+   *        announcement cursors
+   *
+   * @param announcements log of proposable transactions inserted into the pool
+   * @param pool_snapshot returns all pool transactions grouped per account
+   * @param get_pooled returns transaction if it is still in the pool, nullptr otherwise
+   * @return selected transactions and hashes to be sent per peer
+   */
+  std::vector<std::pair<std::shared_ptr<TaraxaPeer>, std::pair<SharedTransactions, std::vector<trx_hash_t>>>>
+  newTransactionsToSendToPeers(const TransactionAnnouncementLog& announcements,
+                               const std::function<std::vector<SharedTransactions>()>& pool_snapshot,
+                               const std::function<SharedTransaction(const trx_hash_t&)>& get_pooled);
+
  private:
+  /**
+   * @brief Sends selected transactions to peers, starting with a random peer
+   *
+   * @param peers_with_transactions_to_send selected transactions and hashes per peer
+   */
+  void sendTransactionsToPeers(
+      std::vector<std::pair<std::shared_ptr<TaraxaPeer>, std::pair<SharedTransactions, std::vector<trx_hash_t>>>>&&
+          peers_with_transactions_to_send);
+
+  /**
+   * @brief select which transactions and hashes to send to peers
+   *
+   * @param peers peers to select transactions for
+   * @param transactions grouped per account to be sent
+   * @return selected transactions and hashes to be sent per peer
+   */
+  std::vector<std::pair<std::shared_ptr<TaraxaPeer>, std::pair<SharedTransactions, std::vector<trx_hash_t>>>>
+  transactionsToSendToPeers(const std::vector<std::shared_ptr<TaraxaPeer>>& peers,
+                            const std::vector<SharedTransactions>& transactions);
+
+  /**
+   * @brief select which announced transactions and hashes to send to peer starting at its announcement cursor
+   *
+   * @param peer
+   * @param announcements log of proposable transactions inserted into the pool
+   * @param get_pooled returns transaction if it is still in the pool, nullptr otherwise
+   * @return selected transactions and hashes to be sent to peer, std::nullopt if peer cursor was overwritten
+   */
+  std::optional<std::pair<SharedTransactions, std::vector<trx_hash_t>>> newTransactionsToSendToPeer(
+      const std::shared_ptr<TaraxaPeer>& peer, const TransactionAnnouncementLog& announcements,
+      const std::function<SharedTransaction(const trx_hash_t&)>& get_pooled);
+
   /**
    * @brief select which transactions and hashes to send to peer
    *
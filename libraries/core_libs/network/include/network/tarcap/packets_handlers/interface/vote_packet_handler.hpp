@@ -49,6 +49,24 @@ class IVotePacketHandler : public ExtVotesPacketHandler {
    */
   virtual void sendPbftVotesBundle(const std::shared_ptr<TaraxaPeer>& peer,
                                    std::vector<std::shared_ptr<PbftVote>>&& votes);
+
+ protected:
+  /**
+   * @brief Sends the same pbft vote to multiple peers, packet is encoded and compressed only once
+   * @param peers
+   * @param vote
+   * @param block
+   */
+  void broadcastPbftVote(const std::vector<std::shared_ptr<TaraxaPeer>>& peers, const std::shared_ptr<PbftVote>& vote,
+                         const std::shared_ptr<PbftBlock>& block);
+
+  /**
+   * @brief Sends the same pbft votes bundle to multiple peers, packets are encoded and compressed only once
+   * @param peers
+   * @param votes
+   */
+  void broadcastPbftVotesBundle(const std::vector<std::shared_ptr<TaraxaPeer>>& peers,
+                                std::vector<std::shared_ptr<PbftVote>>&& votes);
 };
 
 }  // namespace taraxa::network::tarcap
@@ -15,6 +15,17 @@ class ExtPillarVotePacketHandler : public PacketHandler {
  protected:
   bool processPillarVote(const std::shared_ptr<PillarVote>& vote, const std::shared_ptr<TaraxaPeer>& peer);
 
+  /**
+   * @brief Processes multiple pillar votes at once - signatures are verified in parallel and votes are added under
+   *        single lock
+   *
+   * @param votes
+   * @param peer
+   * @return number of processed votes
+   */
+  size_t processPillarVotesBundle(const std::vector<std::shared_ptr<PillarVote>>& votes,
+                                  const std::shared_ptr<TaraxaPeer>& peer);
+
  protected:
   std::shared_ptr<pillar_chain::PillarChainManager> pillar_chain_manager_;
 };
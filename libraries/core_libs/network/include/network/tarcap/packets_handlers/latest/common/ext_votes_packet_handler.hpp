@@ -41,6 +41,17 @@ class ExtVotesPacketHandler : public PacketHandler {
   bool processVote(const std::shared_ptr<PbftVote>& vote, const std::shared_ptr<PbftBlock>& pbft_block,
                    const std::shared_ptr<TaraxaPeer>& peer, bool validate_max_round_step);
 
+  /**
+   * @brief Process votes bundle - votes signatures and vrf proofs are validated in batch
+   *
+   * @param votes
+   * @param peer
+   * @param validate_max_round_step
+   * @return number of successfully processed votes
+   */
+  size_t processVotesBundle(const std::vector<std::shared_ptr<PbftVote>>& votes,
+                            const std::shared_ptr<TaraxaPeer>& peer, bool validate_max_round_step);
+
   /**
    * @brief Checks is vote is relevant for current pbft state in terms of period, round and type
    * @param vote
@@ -51,6 +62,19 @@ class ExtVotesPacketHandler : public PacketHandler {
   void requestPbftNextVotesAtPeriodRound(const dev::p2p::NodeID& peerID, PbftPeriod pbft_period, PbftRound pbft_round);
 
  private:
+  /**
+   * @brief Checks that need to be done before vote signature, vrf, etc... is validated - vote is not in verified
+   *        votes yet, its period, round & step are within limits and it is not a double vote
+   * @note Throws MaliciousPeerException in case of double vote
+   *
+   * @param vote
+   * @param peer
+   * @param validate_max_round_step
+   * @return true if vote should be validated, otherwise false
+   */
+  bool preValidateVote(const std::shared_ptr<PbftVote>& vote, const std::shared_ptr<TaraxaPeer>& peer,
+                       bool validate_max_round_step);
+
   /**
    * @brief Validates vote period, round and step against max values from config
    *
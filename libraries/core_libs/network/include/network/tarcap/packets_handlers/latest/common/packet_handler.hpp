@@ -63,6 +63,14 @@ class PacketHandler : public BasePacketHandler {
 
  protected:
   bool sealAndSend(const dev::p2p::NodeID& node_id, SubprotocolPacketType packet_type, dev::bytes&& rlp_bytes);
+
+  /**
+   * @brief Sends the same packet to multiple peers, it is encoded and compressed only once for all of them
+   *
+   * @return peers the packet was sent to
+   */
+  std::vector<std::shared_ptr<TaraxaPeer>> sealAndBroadcast(const std::vector<std::shared_ptr<TaraxaPeer>>& peers,
+                                                            SubprotocolPacketType packet_type, dev::bytes&& rlp_bytes);
   void disconnect(const dev::p2p::NodeID& node_id, dev::p2p::DisconnectReason reason);
 
  protected:
@@ -20,6 +20,8 @@ class DagBlockPacketHandler : public IDagBlockPacketHandler {
 
   void sendBlockWithTransactions(const std::shared_ptr<TaraxaPeer> &peer, const std::shared_ptr<DagBlock> &block,
                                  SharedTransactions &&trxs) override;
+  void broadcastBlockWithTransactions(const std::vector<std::shared_ptr<TaraxaPeer>> &peers,
+                                      const std::shared_ptr<DagBlock> &block, SharedTransactions &&trxs) override;
 
   void onNewBlockReceived(std::shared_ptr<DagBlock> &&block, const std::shared_ptr<TaraxaPeer> &peer = nullptr,
                           const std::unordered_map<trx_hash_t, std::shared_ptr<Transaction>> &trxs = {});
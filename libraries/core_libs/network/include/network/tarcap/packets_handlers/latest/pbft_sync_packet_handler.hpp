@@ -26,6 +26,22 @@ class PbftSyncPacketHandler : public ISyncPacketHandler {
   virtual PeriodData decodePeriodData(const dev::RLP& period_data_rlp) const;
   virtual std::vector<std::shared_ptr<PbftVote>> decodeVotesBundle(const dev::RLP& votes_bundle_rlp) const;
 
+  enum class SyncedPeriodStatus { kProcessed, kInvalid, kSyncStopped };
+
+  /**
+   * @brief Validates synced period data and pushes them into the period data queue
+   *
+   * @param packet sync packet with the next period to be synced
+   * @param peer peer the packet was received from
+   * @return kSyncStopped if syncing was completed or stopped, so no more periods should be processed
+   */
+  SyncedPeriodStatus processSyncedPeriod(PbftSyncPacket& packet, const std::shared_ptr<TaraxaPeer>& peer);
+
+  /**
+   * @brief Requests next chunks of periods, in case syncing got too far ahead of processing it is delayed
+   */
+  void continueSyncing();
+
   void pbftSyncComplete();
   void delayedPbftSync(uint32_t counter);
 
@@ -33,6 +49,8 @@ class PbftSyncPacketHandler : public ISyncPacketHandler {
 
   std::shared_ptr<VoteManager> vote_mgr_;
   util::ThreadPool periodic_events_tp_;
+  // Only one delayed sync is scheduled at the time
+  std::atomic<bool> delayed_sync_scheduled_{false};
 };
 
 }  // namespace taraxa::network::tarcap
@@ -0,0 +1,129 @@
+#pragma once
+
+#include <chrono>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <set>
+#include <unordered_map>
+
+#include "network/tarcap/packets/latest/pbft_sync_packet.hpp"
+#include "network/tarcap/taraxa_peer.hpp"
+
+namespace taraxa::network::tarcap {
+
+/**
+ * @brief PbftSyncRequests splits missing PBFT periods into chunks of sync_level_size periods, which are requested
+ *        concurrently from multiple peers. Packets received ahead of the next period to be processed are buffered, so
+ *        period data are still processed in order
+ *
+ * The last chunk is always requested from the syncing peer with the longest chain as only its response contains cert
+ * votes of the latest block. Requests that time out are requested again from other peers and their peers are penalized
+ */
+class PbftSyncRequests {
+ public:
+  PbftSyncRequests(PbftPeriod chunk_size, size_t max_requests, std::chrono::milliseconds request_timeout);
+
+  /**
+   * @brief Starts new syncing, previous requests and buffered packets are dropped
+   *
+   * @param from first period to be requested
+   */
+  void reset(PbftPeriod from);
+
+  /**
+   * @brief Assigns chunks of periods to idle peers
+   *
+   * @param peers peers that can be requested
+   * @param main_peer syncing peer with the longest chain, only it can be requested for the last chunk
+   * @param synced_period periods up to synced_period are already synced and are not requested anymore
+   * @param max_period periods above max_period are not requested, so syncing does not get too far ahead of processing
+   * @return peers and first periods to be requested from them
+   */
+  std::vector<std::pair<std::shared_ptr<TaraxaPeer>, PbftPeriod>> assignRequests(
+      const std::vector<std::shared_ptr<TaraxaPeer>>& peers, const std::shared_ptr<TaraxaPeer>& main_peer,
+      PbftPeriod synced_period, PbftPeriod max_period);
+
+  /**
+   * @brief Registers received sync packet, request is completed with its last packet
+   *
+   * @return true if period was requested from the peer, otherwise false
+   */
+  bool onPacket(const dev::p2p::NodeID& peer_id, PbftPeriod period, bool last_block);
+
+  /**
+   * @brief Requests without any packet received within request timeout are requested again from other peers
+   *
+   * @return number of timed out requests
+   */
+  size_t checkTimeouts();
+
+  /**
+   * @brief Drops pending request and buffered packets of peer that disconnected or sent invalid data, its periods are
+   *        requested again from other peers
+   *
+   * @param peer_id
+   * @param from_period first period that must be requested again, e.g. period of invalid packet that was already
+   *        taken out of the buffer
+   */
+  void dropPeer(const dev::p2p::NodeID& peer_id, std::optional<PbftPeriod> from_period = {});
+
+  /**
+   * @brief Buffers packet received ahead of the next period to be processed
+   *
+   * @return false if packet with the same period is already buffered
+   */
+  bool bufferPacket(PbftSyncPacket&& packet, const std::shared_ptr<TaraxaPeer>& peer);
+
+  /**
+   * @brief Takes buffered packet out of the buffer, packets with lower periods are dropped as they are not needed
+   *        anymore
+   *
+   * @return packet together with the peer it was received from
+   */
+  std::optional<std::pair<PbftSyncPacket, std::shared_ptr<TaraxaPeer>>> popBufferedPacket(PbftPeriod period);
+
+  /**
+   * @return true if all periods up to target_period were received and there is nothing buffered
+   */
+  bool finished(PbftPeriod target_period) const;
+
+  size_t pendingRequestsCount() const;
+  size_t bufferedPacketsCount() const;
+  int32_t peerScore(const dev::p2p::NodeID& peer_id) const;
+
+ private:
+  struct Request {
+    PbftPeriod from;
+    PbftPeriod to;
+    PbftPeriod received;  // last received period, from - 1 if nothing received yet
+    bool last_chunk;      // requested from the main peer up to its chain size
+    std::chrono::steady_clock::time_point deadline;
+  };
+
+  void retryUnsafe(const Request& request);
+  int32_t peerScoreUnsafe(const dev::p2p::NodeID& peer_id) const;
+
+  const PbftPeriod kChunkSize;
+  const size_t kMaxRequests;
+  const std::chrono::milliseconds kRequestTimeout;
+
+  // Peers with lower score are not requested until the next syncing, except of the main syncing peer
+  static constexpr int32_t kMinPeerScore = -4;
+  static constexpr int32_t kMaxPeerScore = 16;
+  static constexpr int32_t kTimeoutPenalty = 2;
+
+  // First period of the next chunk that was not requested yet
+  PbftPeriod next_period_{1};
+  // First periods of chunks that need to be requested again
+  std::set<PbftPeriod> retry_;
+  // Pending requests, peer is requested for at most one chunk at the time
+  std::unordered_map<dev::p2p::NodeID, Request> requests_;
+  // Packets received ahead of the next period to be processed
+  std::map<PbftPeriod, std::pair<PbftSyncPacket, std::shared_ptr<TaraxaPeer>>> buffer_;
+  // Peers scores - increased by each completed request and decreased by each timed out request
+  std::unordered_map<dev::p2p::NodeID, int32_t> scores_;
+  mutable std::mutex mutex_;
+};
+
+}  // namespace taraxa::network::tarcap
@@ -5,6 +5,7 @@
 #include <shared_mutex>
 
 #include "common/types.hpp"
+#include "network/tarcap/shared_states/pbft_sync_requests.hpp"
 
 namespace taraxa::network::tarcap {
 
@@ -16,7 +17,8 @@ class TaraxaPeer;
  */
 class PbftSyncingState {
  public:
-  PbftSyncingState(uint16_t deep_syncing_threshold);
+  PbftSyncingState(uint16_t deep_syncing_threshold, PbftPeriod sync_level_size = 1, size_t sync_max_peers = 1,
+                   std::chrono::milliseconds sync_request_timeout = std::chrono::seconds{10});
 
   /**
    * @brief Set pbft syncing
@@ -70,6 +72,11 @@ class PbftSyncingState {
    */
   bool isActivelySyncing() const;
 
+  /**
+   * @brief Pending pbft sync requests and buffered out of order sync packets, reset when syncing starts or stops
+   */
+  PbftSyncRequests& syncRequests();
+
  private:
   std::atomic<bool> deep_pbft_syncing_{false};
   std::atomic<bool> pbft_syncing_{false};
@@ -88,6 +95,8 @@ class PbftSyncingState {
   // Last syncing peer - it is not reset to null, it is only replaced when new syncing starts
   std::shared_ptr<TaraxaPeer> last_syncing_peer_;
   mutable std::shared_mutex peer_mutex_;
+
+  PbftSyncRequests sync_requests_;
 };
 
 }  // namespace taraxa::network::tarcap
@@ -125,6 +125,8 @@ class TaraxaPeer : public boost::noncopyable {
   std::atomic_uint64_t peer_requested_dag_syncing_time_ = 0;
   std::atomic_bool peer_light_node = false;
   std::atomic<PbftPeriod> peer_light_node_history = 0;
+  // Sequence number of the next transaction announcement to gossip to peer, 0 if peer did not get pool snapshot yet
+  std::atomic<uint64_t> transactions_announcement_cursor_ = 0;
   std::string address_;
 
   // Mutex used to prevent race condition between dag syncing and gossiping
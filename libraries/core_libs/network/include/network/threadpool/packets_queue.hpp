@@ -1,5 +1,7 @@
 #pragma once
 
+#include <boost/lockfree/queue.hpp>
+
 #include <list>
 #include <optional>
 
@@ -9,28 +11,62 @@
 
 namespace taraxa::network::threadpool {
 
+/**
+ * @brief Queue of packets with the same priority. Packets that neither block nor can be blocked by other packets are
+ *        kept in a lock-free queue so they can be pushed and popped without the threadpool queue mutex, all other
+ *        packets are kept in a list that is guarded by the threadpool queue mutex
+ */
 class PacketsQueue {
  public:
   PacketsQueue() = default;
+  ~PacketsQueue();
+
+  PacketsQueue(const PacketsQueue&) = delete;
+  PacketsQueue& operator=(const PacketsQueue&) = delete;
+  PacketsQueue(PacketsQueue&&) = delete;
+  PacketsQueue& operator=(PacketsQueue&&) = delete;
 
   /**
    * @brief Push new task to the queue
+   * @note Threadpool queue mutex must be locked
    *
    * @param packet
    */
   void pushBack(std::pair<tarcap::TarcapVersion, PacketData>&& packet);
 
+  /**
+   * @brief Push new non-blocking task to the queue
+   * @note This method is thread-safe
+   *
+   * @param packet
+   */
+  void pushBackNonBlocking(std::pair<tarcap::TarcapVersion, PacketData>&& packet);
+
   /**
    * @brief Return Task from queue. In some rare situations when all packets are blocked for processing due to
    *        blocking dependencies there might returned empty optional
    * @note If empty optional is returned too often, there might be some logical bug in terms of packet priority &
-   *       existing dependencies
+   *       existing dependencies. Threadpool queue mutex must be locked
    * @param blocked_packets_types_mask bit mask with all blocked packets for processing
    *
    * @return std::optional<Task>
    */
   std::optional<std::pair<tarcap::TarcapVersion, PacketData>> pop(const PacketsBlockingMask& packets_blocking_mask);
 
+  /**
+   * @brief Return non-blocking Task from queue
+   * @note This method is thread-safe
+   *
+   * @return std::optional<Task>
+   */
+  std::optional<std::pair<tarcap::TarcapVersion, PacketData>> popNonBlocking();
+
+  /**
+   * @note This method is thread-safe
+   * @return true if there are packets that must be popped under the threadpool queue mutex
+   */
+  bool hasBlockingPackets() const;
+
   /**
    * @return false in case there is already kMaxWorkersCount_ workers processing packets from
    *         this queue at the same time, otherwise true
@@ -45,9 +81,13 @@ class PacketsQueue {
   void setMaxWorkersCount(size_t max_workers_count);
 
   /**
-   * @brief Increment act_workers_count_ by 1
+   * @brief Increment act_workers_count_ by 1 unless max workers count is reached
+   * @note This method is thread-safe
+   *
+   * @param ignore_max_workers_count if true, max workers count is not checked
+   * @return true if act_workers_count_ was incremented, otherwise false
    */
-  void incrementActWorkersCount();
+  bool tryIncrementActWorkersCount(bool ignore_max_workers_count = false);
 
   /**
    * @brief Decrement act_workers_count_ by 1
@@ -75,6 +115,9 @@ class PacketsQueue {
  private:
   std::list<std::pair<tarcap::TarcapVersion, PacketData>> packets_;
 
+  // Non-blocking packets, ownership of the packet is transferred to the queue until it is popped
+  boost::lockfree::queue<std::pair<tarcap::TarcapVersion, PacketData>*> non_blocking_packets_{1024};
+
   // How many workers can process packets from this queue at the same time
   size_t kMaxWorkersCount_{0};
 
@@ -83,6 +126,9 @@ class PacketsQueue {
 
   // How many packets are currently inside the queue
   std::atomic<size_t> act_packets_count_{0};
+
+  // How many packets are currently inside packets_
+  std::atomic<size_t> blocking_packets_count_{0};
 };
 
 }  // namespace taraxa::network::threadpool
@@ -3,6 +3,8 @@
 #include <libdevcore/RLP.h>
 
 #include <array>
+#include <condition_variable>
+#include <mutex>
 #include <utility>
 
 #include "logger/logger.hpp"
@@ -29,27 +31,27 @@ class PriorityQueue {
 
   /**
    * @brief Pushes new packet into the priority queue
+   * @note Non-blocking packets are pushed lock-free, queue_mutex must be locked when pushing any other packet
    * @param packet
    */
   void pushBack(std::pair<tarcap::TarcapVersion, PacketData>&& packet);
 
   /**
+   * @brief Pops packet with the highest priority & oldest "receive" time and reserves worker for its processing.
+   *        Non-blocking packets are popped without locking queue_lock, which is locked only if packets with blocking
+   *        dependencies have to be checked. Blocking dependencies of popped packet are updated before queue_lock is
+   *        released
+   *
+   * @param queue_lock threadpool queue mutex lock, might be already locked
    * @return std::optional<PacketData> packet with the highest priority & oldest "receive" time
    */
-  std::optional<std::pair<tarcap::TarcapVersion, PacketData>> pop();
+  std::optional<std::pair<tarcap::TarcapVersion, PacketData>> pop(std::unique_lock<std::mutex>& queue_lock);
 
   /**
    * @return true of all priority packets_queues_ are empty, otheriwse false
    */
   bool empty() const;
 
-  /**
-   * @brief Updates blocking dependencies at the start of packet processing
-   *
-   * @param packet
-   */
-  void updateDependenciesStart(const PacketData& packet);
-
   /**
    * @brief Updates blocking dependencies after packet processing is done
    *
@@ -86,9 +88,29 @@ class PriorityQueue {
    * @brief Queue can borrow reserved thread from one of the other priority queues but each queue must have
    *        at least 1 thread reserved all the time even if has nothing to do
    *
-   * @return true if thread can be borrowed, otherwise false
+   * @return number of threads currently reserved for idle queues
    */
-  bool canBorrowThread();
+  size_t reservedThreadsNum() const;
+
+  /**
+   * @brief Reserves worker from the specified queue and tries to pop packet from it
+   *
+   * @param queue
+   * @param queue_lock threadpool queue mutex lock, locked only if there are packets with blocking dependencies
+   * @param borrow_thread if true, queue max workers limit is ignored and thread is borrowed from the other queues
+   * @return packet or empty optional if there is no packet that could be processed
+   */
+  std::optional<std::pair<tarcap::TarcapVersion, PacketData>> popFromQueue(PacketsQueue& queue,
+                                                                           std::unique_lock<std::mutex>& queue_lock,
+                                                                           bool borrow_thread);
+
+  /**
+   * @brief Updates blocking dependencies at the start of packet processing
+   * @note queue_mutex must be locked for packets with blocking dependencies
+   *
+   * @param packet
+   */
+  void updateDependenciesStart(const PacketData& packet);
 
  private:
   // Declare logger instances
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <atomic>
 #include <condition_variable>
 #include <mutex>
 #include <thread>
@@ -88,14 +89,18 @@ class PacketsThreadPool {
   std::atomic<bool> stopProcessing_{false};
 
   // How many packets were pushed into the queue, it also serves for creating packet unique id
-  uint64_t packets_count_{0};
+  std::atomic<uint64_t> packets_count_{0};
 
   // Queue of unprocessed packets
   PriorityQueue queue_;
 
-  // Queue mutex
+  // Queue mutex - guards only packets with blocking dependencies, non-blocking packets are pushed & popped lock-free
   std::mutex queue_mutex_;
 
+  // Number of workers waiting on cond_var_, pushing of non-blocking packet locks queue_mutex_ only to wake them up.
+  // Accessed with seq_cst fences on both sides so a packet pushed lock-free cannot miss a worker going to wait
+  std::atomic<size_t> waiting_workers_count_{0};
+
   // Queue condition variable
   std::condition_variable cond_var_;
 
@@ -42,6 +42,7 @@ class WsServer : public std::enable_shared_from_this<WsServer>, public jsonrpc::
  private:
   void do_accept();
   void on_accept(beast::error_code ec, tcp::socket socket);
+  void reportFanout(SubscriptionType type, std::chrono::steady_clock::time_point start) const;
   LOG_OBJECTS_DEFINE
   boost::asio::io_context& ioc_;
   tcp::acceptor acceptor_;
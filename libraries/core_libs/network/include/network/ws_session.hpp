@@ -8,8 +8,11 @@
 #include <boost/beast/core.hpp>
 #include <boost/beast/websocket.hpp>
 #include <cstdlib>
+#include <deque>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <variant>
 
 #include "common/types.hpp"
 #include "final_chain/data.hpp"
@@ -29,7 +32,7 @@ class WsSession : public std::enable_shared_from_this<WsSession> {
   explicit WsSession(tcp::socket&& socket, addr_t node_addr, std::shared_ptr<WsServer> ws_server)
       : ws_(std::move(socket)),
         ws_server_(ws_server),
-        subscriptions_(std::bind(&WsSession::do_write, this, std::placeholders::_1)),
+        subscriptions_(std::bind(&WsSession::send, this, std::placeholders::_1)),
         write_strand_(boost::asio::make_strand(ws_.get_executor())) {
     LOG_OBJECTS_CREATE("WS_SESSION");
   }
@@ -41,23 +44,33 @@ class WsSession : public std::enable_shared_from_this<WsSession> {
 
   virtual std::string processRequest(const std::string_view& request) = 0;
 
-  void newEthBlock(const Json::Value& payload);
-  void newDagBlock(const Json::Value& blk);
-  void newDagBlockFinalized(const Json::Value& payload);
-  void newPbftBlockExecuted(const Json::Value& payload);
-  void newPendingTransaction(const Json::Value& payload);
-  void newPillarBlockData(const Json::Value& payload);
-  void newLogs(const final_chain::BlockHeader& header, TransactionHashes trx_hashes,
-               const TransactionReceipts& receipts);
+  void newEthBlock(SubscriptionPayload& payload);
+  void newDagBlock(SubscriptionPayload& payload);
+  void newDagBlockFinalized(SubscriptionPayload& payload);
+  void newPbftBlockExecuted(SubscriptionPayload& payload);
+  void newPendingTransaction(SubscriptionPayload& payload);
+  void newPillarBlockData(SubscriptionPayload& payload);
+  void newLogs(LogsSubscriptionPayload& payload);
+
+  // Max number of messages waiting to be written, session of a client that does not keep up is closed
+  static constexpr size_t kMaxSendQueueSize = 1024;
 
   LOG_OBJECTS_DEFINE
  private:
+  using OutgoingMessage = std::variant<std::string, SubscriptionMessage>;
+
   static bool is_normal(const beast::error_code& ec);
   void on_close(beast::error_code ec);
   void on_accept(beast::error_code ec);
   void do_read();
   void on_read(beast::error_code ec, std::size_t bytes_transferred);
-  void write(std::string&& message);
+  void send(SubscriptionMessage&& message);
+  void enqueue(OutgoingMessage&& message);
+  void flush();
+  void write(const OutgoingMessage& message);
+  template <typename ConstBufferSequence>
+  bool writeBuffers(const ConstBufferSequence& buffers);
+  void evict();
 
  protected:
   void handleRequest();
@@ -70,6 +83,10 @@ class WsSession : public std::enable_shared_from_this<WsSession> {
 
  private:
   boost::asio::strand<boost::asio::any_io_executor> write_strand_;
+  // Messages waiting to be written on write_strand_, flush_scheduled_ is set while flush is posted or running
+  std::deque<OutgoingMessage> send_queue_;
+  bool flush_scheduled_ = false;
+  std::mutex send_queue_mutex_;
   beast::flat_buffer read_buffer_;
   std::atomic<bool> closed_ = false;
   std::string ip_;
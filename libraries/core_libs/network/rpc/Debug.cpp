@@ -18,25 +18,31 @@ using namespace taraxa;
 namespace taraxa::net {
 
 Json::Value Debug::debug_traceCall(const Json::Value& call_params, const std::string& blk_num) {
-  Json::Value res;
+  return util::readJsonFromString(debugTraceCall(call_params, blk_num));
+}
+
+Json::Value Debug::trace_call(const Json::Value& call_params, const Json::Value& trace_params,
+                              const std::string& blk_num) {
+  return util::readJsonFromString(traceCall(call_params, trace_params, blk_num));
+}
+
+std::string Debug::debugTraceCall(const Json::Value& call_params, const std::string& blk_num) {
   const auto block = parse_blk_num(blk_num);
   auto trx = to_eth_trx(call_params, block);
   if (auto node = app_.lock()) {
-    return util::readJsonFromString(node->getFinalChain()->trace({}, {std::move(trx)}, block));
+    return node->getFinalChain()->trace({}, {std::move(trx)}, block);
   }
-  return res;
+  return kNullResult;
 }
 
-Json::Value Debug::trace_call(const Json::Value& call_params, const Json::Value& trace_params,
-                              const std::string& blk_num) {
-  Json::Value res;
+std::string Debug::traceCall(const Json::Value& call_params, const Json::Value& trace_params,
+                             const std::string& blk_num) {
   const auto block = parse_blk_num(blk_num);
   auto params = parse_tracking_parms(trace_params);
   if (auto node = app_.lock()) {
-    return util::readJsonFromString(
-        node->getFinalChain()->trace({}, {to_eth_trx(call_params, block)}, block, std::move(params)));
+    return node->getFinalChain()->trace({}, {to_eth_trx(call_params, block)}, block, std::move(params));
   }
-  return res;
+  return kNullResult;
 }
 
 std::tuple<std::vector<state_api::EVMTransaction>, state_api::EVMTransaction, uint64_t>
@@ -58,22 +64,28 @@ Debug::get_transaction_with_state(const std::string& transaction_hash) {
   return {to_eth_trxs(state_trxs), to_eth_trx(block_transactions[loc->position]), loc->period};
 }
 Json::Value Debug::debug_traceTransaction(const std::string& transaction_hash) {
-  Json::Value res;
+  return util::readJsonFromString(debugTraceTransaction(transaction_hash));
+}
+
+Json::Value Debug::trace_replayTransaction(const std::string& transaction_hash, const Json::Value& trace_params) {
+  return util::readJsonFromString(traceReplayTransaction(transaction_hash, trace_params));
+}
+
+std::string Debug::debugTraceTransaction(const std::string& transaction_hash) {
   auto [state_trxs, trx, period] = get_transaction_with_state(transaction_hash);
   if (auto node = app_.lock()) {
-    return util::readJsonFromString(node->getFinalChain()->trace({}, {trx}, period));
+    return node->getFinalChain()->trace({}, {trx}, period);
   }
-  return res;
+  return kNullResult;
 }
 
-Json::Value Debug::trace_replayTransaction(const std::string& transaction_hash, const Json::Value& trace_params) {
-  Json::Value res;
+std::string Debug::traceReplayTransaction(const std::string& transaction_hash, const Json::Value& trace_params) {
   auto params = parse_tracking_parms(trace_params);
   auto [state_trxs, trx, period] = get_transaction_with_state(transaction_hash);
   if (auto node = app_.lock()) {
-    return util::readJsonFromString(node->getFinalChain()->trace(state_trxs, {trx}, period, params));
+    return node->getFinalChain()->trace(state_trxs, {trx}, period, params);
   }
-  return res;
+  return kNullResult;
 }
 
 bool only_transfers(const SharedTransactions& trxs) {
@@ -83,21 +95,43 @@ bool only_transfers(const SharedTransactions& trxs) {
 }
 
 Json::Value Debug::trace_replayBlockTransactions(const std::string& block_num, const Json::Value& trace_params) {
-  Json::Value res;
+  return util::readJsonFromString(traceReplayBlockTransactions(block_num, trace_params));
+}
+
+std::string Debug::traceReplayBlockTransactions(const std::string& block_num, const Json::Value& trace_params) {
   const auto block = parse_blk_num(block_num);
   auto params = parse_tracking_parms(trace_params);
   if (auto node = app_.lock()) {
     auto transactions = node->getDB()->getPeriodTransactions(block);
     if (!transactions.has_value() || transactions->empty()) {
-      return Json::Value(Json::arrayValue);
+      return "[]";
     }
     if (only_transfers(*transactions)) {
-      return Json::Value(Json::arrayValue);
+      return "[]";
     }
     std::vector<state_api::EVMTransaction> trxs = to_eth_trxs(*transactions);
-    return util::readJsonFromString(node->getFinalChain()->trace({}, std::move(trxs), block, std::move(params)));
+    return node->getFinalChain()->trace({}, std::move(trxs), block, std::move(params));
+  }
+  return kNullResult;
+}
+
+std::string Debug::trace(const std::string& method, const Json::Value& params) {
+  if (method == "debug_traceTransaction") {
+    return debugTraceTransaction(params[0].asString());
+  }
+  if (method == "debug_traceCall") {
+    return debugTraceCall(params[0], params[1].asString());
+  }
+  if (method == "trace_call") {
+    return traceCall(params[0], params[1], params[2].asString());
+  }
+  if (method == "trace_replayTransaction") {
+    return traceReplayTransaction(params[0].asString(), params[1]);
+  }
+  if (method == "trace_replayBlockTransactions") {
+    return traceReplayBlockTransactions(params[0].asString(), params[1]);
   }
-  return res;
+  throw std::invalid_argument("Unknown trace method " + method);
 }
 
 Json::Value Debug::debug_getPeriodTransactionsWithReceipts(const std::string& _period) {
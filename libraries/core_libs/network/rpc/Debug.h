@@ -3,7 +3,9 @@
 
 #include <json/value.h>
 
+#include <array>
 #include <memory>
+#include <string_view>
 
 #include "DebugFace.h"
 #include "common/app_base.hpp"
@@ -51,7 +53,23 @@ class Debug : public DebugFace {
   virtual Json::Value debug_dposValidatorTotalStakes(const std::string& param1) override;
   virtual Json::Value debug_dposTotalAmountDelegated(const std::string& param1) override;
 
+  static constexpr std::array<std::string_view, 5> kTraceMethods{"debug_traceTransaction", "debug_traceCall",
+                                                                 "trace_call", "trace_replayTransaction",
+                                                                 "trace_replayBlockTransactions"};
+  /**
+   * @brief Executes one of kTraceMethods with positional params and returns trace as serialized by the EVM, without
+   * parsing it into Json::Value
+   */
+  std::string trace(const std::string& method, const Json::Value& params);
+
  private:
+  static constexpr auto kNullResult = "null";
+
+  std::string debugTraceTransaction(const std::string& transaction_hash);
+  std::string debugTraceCall(const Json::Value& call_params, const std::string& blk_num);
+  std::string traceCall(const Json::Value& call_params, const Json::Value& trace_params, const std::string& blk_num);
+  std::string traceReplayTransaction(const std::string& transaction_hash, const Json::Value& trace_params);
+  std::string traceReplayBlockTransactions(const std::string& block_num, const Json::Value& trace_params);
   state_api::EVMTransaction to_eth_trx(std::shared_ptr<Transaction> t) const;
   state_api::EVMTransaction to_eth_trx(const Json::Value& json, EthBlockNumber blk_num);
   std::vector<state_api::EVMTransaction> to_eth_trxs(const std::vector<std::shared_ptr<Transaction>>& trxs);
@@ -70,8 +70,8 @@ Json::Value Taraxa::taraxa_getDagBlockByHash(const string& _blockHash, bool _inc
       }
       if (_includeTransactions) {
         block_json["transactions"] = Json::Value(Json::arrayValue);
-        for (auto const& t : block->getTrxs()) {
-          block_json["transactions"].append(app->getTransactionManager()->getTransaction(t)->toJSON());
+        for (auto const& trx : app->getTransactionManager()->getTransactionsByHashes(block->getTrxs())) {
+          block_json["transactions"].append(trx->toJSON());
         }
       }
       return block_json;
@@ -178,8 +178,8 @@ Json::Value Taraxa::taraxa_getDagBlockByLevel(const string& _blockLevel, bool _i
       }
       if (_includeTransactions) {
         block_json["transactions"] = Json::Value(Json::arrayValue);
-        for (auto const& t : b->getTrxs()) {
-          block_json["transactions"].append(app->getTransactionManager()->getTransaction(t)->toJSON());
+        for (auto const& trx : app->getTransactionManager()->getTransactionsByHashes(b->getTrxs())) {
+          block_json["transactions"].append(trx->toJSON());
         }
       }
       res.append(block_json);
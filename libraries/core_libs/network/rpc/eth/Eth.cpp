@@ -93,6 +93,36 @@ Json::Value toJson(const LocalisedTransactionReceipt& ltr) {
   return res;
 }
 
+Json::Value toJson(const LocalisedTransactionReceiptView& ltr) {
+  Json::Value res(Json::objectValue);
+  add(res, ltr.trx_loc);
+  res["from"] = toJS(ltr.trx_from);
+  res["to"] = toJson(ltr.trx_to);
+  res["status"] = toJS(ltr.r.statusCode());
+  res["gasUsed"] = toJS(ltr.r.gasUsed());
+  res["cumulativeGasUsed"] = toJS(ltr.r.cumulativeGasUsed());
+  res["contractAddress"] = toJson(ltr.r.newContractAddress());
+
+  // Bloom is accumulated from the same pass over logs
+  LogBloom bloom;
+  auto& logs_json = res["logs"] = Json::Value(Json::arrayValue);
+  ltr.r.forEachLog([&](size_t log_i, const LogEntryView& le) {
+    bloom |= le.bloom();
+    auto& log_json = logs_json.append(Json::Value(Json::objectValue));
+    add(log_json, ltr.trx_loc);
+    log_json["removed"] = false;
+    log_json["data"] = toHexPrefixed(le.data());
+    log_json["address"] = toJS(le.address());
+    log_json["logIndex"] = toJS(log_i);
+    auto& topics_json = log_json["topics"] = Json::Value(Json::arrayValue);
+    for (size_t i = 0; i < le.topicsCount(); ++i) {
+      topics_json.append(toJS(le.topic(i)));
+    }
+  });
+  res["logsBloom"] = toJS(bloom);
+  return res;
+}
+
 Json::Value toJson(const SyncStatus& obj) {
   Json::Value res(Json::objectValue);
   res["startingBlock"] = toJS(obj.starting_block);
@@ -114,9 +144,15 @@ Address toAddress(const std::string& s) {
 
 class EthImpl : public Eth, EthParams {
   Watches watches_;
+  std::unique_ptr<util::ThreadPool> logs_query_pool_;
+  LogFilter::Budget logs_query_budget_;
 
  public:
-  EthImpl(EthParams&& prerequisites) : EthParams(std::move(prerequisites)), watches_(watches_cfg) {}
+  EthImpl(EthParams&& prerequisites)
+      : EthParams(std::move(prerequisites)),
+        watches_(watches_cfg),
+        logs_query_pool_(logs_query_threads ? std::make_unique<util::ThreadPool>(logs_query_threads) : nullptr),
+        logs_query_budget_{logs_query_max_blocks, logs_query_max_results} {}
 
   virtual RPCModules implementedModules() const override { return RPCModules{RPCModule{"eth", "1.0"}}; }
 
@@ -273,7 +309,7 @@ class EthImpl : public Eth, EthParams {
       return Json::Value(Json::arrayValue);
     }
 
-    auto receipts = final_chain->blockReceipts(blk_n);
+    auto receipts = final_chain->blockReceiptsView(blk_n);
     return util::transformToJsonParallel(
         transactions, [this, &receipts, blk_n, &block_hash](const auto& trx, auto index) {
           if (!receipts) {
@@ -284,7 +320,7 @@ class EthImpl : public Eth, EthParams {
                 trx->getReceiver(),
             });
           }
-          return toJson(LocalisedTransactionReceipt{
+          return toJson(LocalisedTransactionReceiptView{
               receipts->at(index),
               ExtendedTransactionLocation{{{blk_n, index}, *block_hash}, trx->getHash()},
               trx->getSender(),
@@ -319,13 +355,15 @@ class EthImpl : public Eth, EthParams {
 
   Json::Value eth_getFilterLogs(const string& _filterId) override {
     if (auto filter = watches_.logs_.get_watch_params(jsToInt(_filterId))) {
-      return toJsonArray(filter->match_all(*final_chain));
+      return matchLogs(*filter);
     }
     return Json::Value(Json::arrayValue);
   }
 
-  Json::Value eth_getLogs(const Json::Value& _json) override {
-    return toJsonArray(parse_log_filter(_json).match_all(*final_chain));
+  Json::Value eth_getLogs(const Json::Value& _json) override { return matchLogs(parse_log_filter(_json)); }
+
+  void getLogs(const Json::Value& _json, const std::function<void(const LocalisedLogEntry&)>& cb) override {
+    parse_log_filter(_json).match_all(*final_chain, cb, logs_query_pool_.get(), logs_query_budget_);
   }
 
   Json::Value eth_syncing() override {
@@ -528,6 +566,14 @@ class EthImpl : public Eth, EthParams {
     return parse_blk_num(json.asString());
   }
 
+  Json::Value matchLogs(const LogFilter& filter) {
+    Json::Value res(Json::arrayValue);
+    filter.match_all(
+        *final_chain, [&res](const auto& lle) { res.append(toJson(lle)); }, logs_query_pool_.get(),
+        logs_query_budget_);
+    return res;
+  }
+
   LogFilter parse_log_filter(const Json::Value& json) {
     EthBlockNumber from_block;
     optional<EthBlockNumber> to_block;
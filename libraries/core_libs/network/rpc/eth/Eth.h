@@ -20,6 +20,10 @@ struct EthParams {
   std::function<uint64_t()> get_earliest_block = [] { return uint64_t(0); };
   std::function<std::optional<SyncStatus>()> syncing_probe = [] { return std::nullopt; };
   WatchesConfig watches_cfg;
+  // Threads scanning eth_getLogs block ranges, 0 scans on the calling thread
+  uint16_t logs_query_threads = 0;
+  uint64_t logs_query_max_blocks = 0;
+  uint64_t logs_query_max_results = 0;
 };
 
 struct Eth : virtual ::taraxa::net::EthFace {
@@ -36,6 +40,8 @@ struct Eth : virtual ::taraxa::net::EthFace {
   virtual void note_block_executed(const final_chain::BlockHeader&, const SharedTransactions&,
                                    const TransactionReceipts&) = 0;
   virtual void note_pending_transaction(const h256& trx_hash) = 0;
+  // Streams logs matching eth_getLogs filter to cb as they are found, instead of building the whole response
+  virtual void getLogs(const Json::Value& filter, const std::function<void(const LocalisedLogEntry&)>& cb) = 0;
 };
 
 std::shared_ptr<Eth> NewEth(EthParams&&);
@@ -2,6 +2,10 @@
 
 #include <jsonrpccpp/common/exception.h>
 
+#include <deque>
+#include <future>
+#include <numeric>
+
 #include "Eth.h"
 
 namespace taraxa::net::rpc::eth {
@@ -88,21 +92,35 @@ void LogFilter::match_one(const TransactionReceipt& r, const std::function<void(
     return;
   }
   for (size_t log_i = 0; log_i < r.logs.size(); ++log_i) {
-    const auto& e = r.logs[log_i];
-    if (!addresses_.empty() && !addresses_.count(e.address)) {
-      continue;
+    if (matches(r.logs[log_i])) {
+      cb(log_i);
     }
-    auto ok = true;
-    for (size_t i = 0; i < topics_.size(); ++i) {
-      if (!topics_[i].empty() && (e.topics.size() < i || !topics_[i].count(e.topics[i]))) {
-        ok = false;
-        break;
-      }
+  }
+}
+
+bool LogFilter::matches(const LogEntry& e) const {
+  if (!addresses_.empty() && !addresses_.count(e.address)) {
+    return false;
+  }
+  for (size_t i = 0; i < topics_.size(); ++i) {
+    if (!topics_[i].empty() && (e.topics.size() <= i || !topics_[i].count(e.topics[i]))) {
+      return false;
     }
-    if (ok) {
-      cb(log_i);
+  }
+  return true;
+}
+
+bool LogFilter::matches(const LogEntryView& e) const {
+  if (!addresses_.empty() && !addresses_.count(e.address())) {
+    return false;
+  }
+  const auto topics_count = e.topicsCount();
+  for (size_t i = 0; i < topics_.size(); ++i) {
+    if (!topics_[i].empty() && (topics_count <= i || !topics_[i].count(e.topic(i)))) {
+      return false;
     }
   }
+  return true;
 }
 
 bool LogFilter::blk_number_matches(EthBlockNumber blk_n) const {
@@ -124,24 +142,49 @@ void LogFilter::match_one(const ExtendedTransactionLocation& trx_loc, const Tran
   }
 }
 
-std::vector<LocalisedLogEntry> LogFilter::match_all(const final_chain::FinalChain& final_chain) const {
+void LogFilter::match_one(const ExtendedTransactionLocation& trx_loc, const TransactionReceiptView& r,
+                          const std::function<void(const LocalisedLogEntry&)>& cb) const {
+  if (!blk_number_matches(trx_loc.period)) {
+    return;
+  }
+  // Comparing addresses and topics directly is cheaper than computing receipt bloom out of them
+  r.forEachLog([&](size_t log_i, const LogEntryView& log) {
+    if (is_range_only_ || matches(log)) {
+      cb({log.decode(), trx_loc, log_i});
+    }
+  });
+}
+
+std::vector<LocalisedLogEntry> LogFilter::match_range(const final_chain::FinalChain& final_chain,
+                                                     const std::vector<LogBloom>& blooms, EthBlockNumber from,
+                                                     EthBlockNumber to) const {
+  std::vector<EthBlockNumber> blocks;
+  if (is_range_only_) {
+    blocks.resize(to - from + 1);
+    std::iota(blocks.begin(), blocks.end(), from);
+  } else {
+    blocks = final_chain.withBlockBlooms(blooms, from, to);
+  }
   std::vector<LocalisedLogEntry> ret;
-  auto action = [&, this](EthBlockNumber blk_n) {
+  if (blocks.empty()) {
+    return ret;
+  }
+  const auto blocks_receipts = final_chain.blocksReceiptsViews(blocks);
+  for (size_t blk_i = 0; blk_i < blocks.size(); ++blk_i) {
+    const auto blk_n = blocks[blk_i];
     ExtendedTransactionLocation trx_loc{{{blk_n}, *final_chain.blockHash(blk_n)}};
-    auto block_receipts = final_chain.blockReceipts(blk_n);
-    if (block_receipts && block_receipts->size()) {
+    const auto& block_receipts = blocks_receipts[blk_i];
+    if (block_receipts && !block_receipts->empty()) {
       std::vector<std::pair<uint64_t, LocalisedLogEntry>> ret_block;
       for (uint32_t i = 0; i < block_receipts->size(); i++) {
         match_one(trx_loc, (*block_receipts)[i], [&](const auto& lle) { ret_block.push_back({i, lle}); });
         ++trx_loc.position;
       }
-      if (ret_block.size() > 0) {
-        for (auto& r : ret_block) {
-          auto transaction = final_chain.transaction(trx_loc.period, r.first);
-          if (transaction) {
-            r.second.trx_loc.trx_hash = transaction->getHash();
-            ret.push_back(r.second);
-          }
+      for (auto& r : ret_block) {
+        auto transaction = final_chain.transaction(trx_loc.period, r.first);
+        if (transaction) {
+          r.second.trx_loc.trx_hash = transaction->getHash();
+          ret.push_back(std::move(r.second));
         }
       }
     } else {
@@ -153,30 +196,175 @@ std::vector<LocalisedLogEntry> LogFilter::match_all(const final_chain::FinalChai
         ++trx_loc.position;
       }
     }
-  };
+  }
+  return ret;
+}
+
+std::optional<std::vector<LogLocation>> LogFilter::lookup_logs_index(const final_chain::FinalChain& final_chain,
+                                                                     EthBlockNumber to) const {
+  // Index is worth it only if it narrows search below number of blocks in the range, other conditions of the filter
+  // are checked on receipts
+  auto min_estimate = to - from_block_ + 1;
+  std::function<std::vector<LogLocation>()> lookup;
+  if (!addresses_.empty()) {
+    std::vector<Address> addresses(addresses_.cbegin(), addresses_.cend());
+    if (const auto estimate = final_chain.estimateLogsByAddresses(addresses, from_block_, to);
+        estimate <= min_estimate) {
+      min_estimate = estimate;
+      lookup = [&, addresses, to] { return final_chain.logsByAddresses(addresses, from_block_, to); };
+    }
+  }
+  for (uint8_t i = 0; i < topics_.size(); ++i) {
+    if (topics_[i].empty()) {
+      continue;
+    }
+    std::vector<h256> topics(topics_[i].cbegin(), topics_[i].cend());
+    if (const auto estimate = final_chain.estimateLogsByTopics(topics, i, from_block_, to); estimate < min_estimate) {
+      min_estimate = estimate;
+      lookup = [&, topics, i, to] { return final_chain.logsByTopics(topics, i, from_block_, to); };
+    }
+  }
+  if (!lookup) {
+    return {};
+  }
+  return lookup();
+}
+
+std::vector<LocalisedLogEntry> LogFilter::match_locations(const final_chain::FinalChain& final_chain,
+                                                          const std::vector<LogLocation>& locations, size_t begin,
+                                                          size_t end) const {
+  std::vector<EthBlockNumber> blocks;
+  for (auto i = begin; i < end; ++i) {
+    if (blocks.empty() || blocks.back() != locations[i].period) {
+      blocks.push_back(locations[i].period);
+    }
+  }
+  const auto blocks_receipts = final_chain.blocksReceiptsViews(blocks);
+  std::vector<LocalisedLogEntry> ret;
+  for (size_t i = begin, blk_i = 0; i < end; ++i) {
+    const auto& location = locations[i];
+    while (blocks[blk_i] != location.period) {
+      ++blk_i;
+    }
+    const auto& block_receipts = blocks_receipts[blk_i];
+    if (!block_receipts || location.trx_position >= block_receipts->size()) {
+      continue;
+    }
+    const auto receipt = (*block_receipts)[location.trx_position];
+    if (location.log_position >= receipt.logsCount()) {
+      continue;
+    }
+    const auto log = receipt.log(location.log_position);
+    if (!matches(log)) {
+      continue;
+    }
+    auto transaction = final_chain.transaction(location.period, location.trx_position);
+    if (!transaction) {
+      continue;
+    }
+    ExtendedTransactionLocation trx_loc{
+        {{location.period, location.trx_position}, *final_chain.blockHash(location.period)}, transaction->getHash()};
+    ret.push_back({log.decode(), trx_loc, location.log_position});
+  }
+  return ret;
+}
+
+std::vector<LocalisedLogEntry> LogFilter::match_all(const final_chain::FinalChain& final_chain) const {
+  std::vector<LocalisedLogEntry> ret;
+  match_all(final_chain, [&ret](const auto& lle) { ret.push_back(lle); });
+  return ret;
+}
+
+void LogFilter::match_all(const final_chain::FinalChain& final_chain,
+                          const std::function<void(const LocalisedLogEntry&)>& cb, util::ThreadPool* pool,
+                          const Budget& budget) const {
   // to_block can't be greater than the last executed block number
   const auto last_block_number = final_chain.lastBlockNumber();
   auto to_blk_n = to_block_ ? *to_block_ : last_block_number;
   if (to_blk_n > last_block_number) {
     to_blk_n = last_block_number;
   }
+  if (from_block_ > to_blk_n) {
+    return;
+  }
+  if (budget.max_blocks && to_blk_n - from_block_ >= budget.max_blocks) {
+    BOOST_THROW_EXCEPTION(jsonrpc::JsonRpcException(
+        jsonrpc::Errors::ERROR_RPC_INVALID_PARAMS,
+        "query exceeds limit of " + std::to_string(budget.max_blocks) + " blocks, narrow the block range"));
+  }
 
-  if (is_range_only_) {
-    for (auto blk_n = from_block_; blk_n <= to_blk_n; ++blk_n) {
-      action(blk_n);
+  const auto blooms = is_range_only_ ? std::vector<LogBloom>{} : bloomPossibilities();
+  auto segment_end = [to_blk_n](EthBlockNumber from) {
+    return std::min(to_blk_n, (from / kSegmentSize + 1) * kSegmentSize - 1);
+  };
+  uint64_t results_count = 0;
+  auto emit = [&](std::vector<LocalisedLogEntry>&& segment) {
+    results_count += segment.size();
+    if (budget.max_results && results_count > budget.max_results) {
+      BOOST_THROW_EXCEPTION(jsonrpc::JsonRpcException(
+          jsonrpc::Errors::ERROR_RPC_INVALID_PARAMS,
+          "query returned more than " + std::to_string(budget.max_results) + " results, narrow the block range"));
+    }
+    for (const auto& lle : segment) {
+      cb(lle);
+    }
+  };
+
+  if (!is_range_only_ && final_chain.hasLogsIndex()) {
+    if (const auto locations = lookup_logs_index(final_chain, to_blk_n)) {
+      // Locations are matched in chunks of kSegmentSize blocks
+      for (size_t begin = 0; begin < locations->size();) {
+        auto end = begin;
+        for (EthBlockNumber blocks = 0; end < locations->size(); ++end) {
+          if ((end == begin || (*locations)[end].period != (*locations)[end - 1].period) && ++blocks > kSegmentSize) {
+            break;
+          }
+        }
+        emit(match_locations(final_chain, *locations, begin, end));
+        begin = end;
+      }
+      return;
     }
-    return ret;
   }
-  std::set<EthBlockNumber> matchingBlocks;
-  for (const auto& bloom : bloomPossibilities()) {
-    for (auto blk_n : final_chain.withBlockBloom(bloom, from_block_, to_blk_n)) {
-      matchingBlocks.insert(blk_n);
+
+  if (!pool) {
+    for (auto from = from_block_; from <= to_blk_n;) {
+      const auto to = segment_end(from);
+      emit(match_range(final_chain, blooms, from, to));
+      from = to + 1;
     }
+    return;
   }
-  for (auto blk_n : matchingBlocks) {
-    action(blk_n);
+
+  // Only a window of segments is scanned ahead, so results are streamed in order without buffering whole range
+  const auto window = std::max<size_t>(pool->capacity() * 2, 1);
+  std::deque<std::future<std::vector<LocalisedLogEntry>>> in_flight;
+  auto next_from = from_block_;
+  auto schedule = [&] {
+    while (in_flight.size() < window && next_from <= to_blk_n) {
+      const auto to = segment_end(next_from);
+      auto task = std::make_shared<std::packaged_task<std::vector<LocalisedLogEntry>()>>(
+          [&, from = next_from, to] { return match_range(final_chain, blooms, from, to); });
+      in_flight.push_back(task->get_future());
+      pool->post([task] { (*task)(); });
+      next_from = to + 1;
+    }
+  };
+  try {
+    schedule();
+    while (!in_flight.empty()) {
+      auto segment = in_flight.front().get();
+      in_flight.pop_front();
+      schedule();
+      emit(std::move(segment));
+    }
+  } catch (...) {
+    // scheduled tasks reference this query, so they must finish before it is unwound
+    for (auto& f : in_flight) {
+      f.wait();
+    }
+    throw;
   }
-  return ret;
 }
 
 AddressSet parse_addresses(const Json::Value& json) {
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "common/thread_pool.hpp"
 #include "data.hpp"
 #include "final_chain/final_chain.hpp"
 
@@ -8,6 +9,15 @@ namespace taraxa::net::rpc::eth {
 struct LogFilter {
   using Topics = std::array<std::unordered_set<h256>, 4>;
 
+  // Limits of a single query, 0 means unlimited
+  struct Budget {
+    uint64_t max_blocks = 0;
+    uint64_t max_results = 0;
+  };
+
+  // Number of blocks scanned by a single task, multiple of the top level bloom index chunk
+  static constexpr EthBlockNumber kSegmentSize = 4096;
+
  private:
   EthBlockNumber from_block_;
   std::optional<EthBlockNumber> to_block_;
@@ -18,13 +28,37 @@ struct LogFilter {
  public:
   LogFilter(EthBlockNumber from_block, std::optional<EthBlockNumber> to_block, AddressSet addresses,
             LogFilter::Topics topics);
+  const AddressSet& addresses() const { return addresses_; }
+  const Topics& topics() const { return topics_; }
   std::vector<LogBloom> bloomPossibilities() const;
   bool matches(LogBloom b) const;
   void match_one(const TransactionReceipt& r, const std::function<void(size_t)>& cb) const;
   bool blk_number_matches(EthBlockNumber blk_n) const;
   void match_one(const ExtendedTransactionLocation& trx_loc, const TransactionReceipt& r,
                  const std::function<void(const LocalisedLogEntry&)>& cb) const;
+  // Only matched log entries are decoded
+  void match_one(const ExtendedTransactionLocation& trx_loc, const TransactionReceiptView& r,
+                 const std::function<void(const LocalisedLogEntry&)>& cb) const;
   std::vector<LocalisedLogEntry> match_all(const final_chain::FinalChain& final_chain) const;
+  /**
+   * @brief Scans filter range split into segments, concurrently if pool is provided, and streams matches to cb in
+   * block order. Throws JsonRpcException if query exceeds budget
+   */
+  void match_all(const final_chain::FinalChain& final_chain, const std::function<void(const LocalisedLogEntry&)>& cb,
+                 util::ThreadPool* pool = nullptr, const Budget& budget = {}) const;
+
+ private:
+  bool matches(const LogEntry& e) const;
+  bool matches(const LogEntryView& e) const;
+  // Looks up the most selective condition in logs index, nullopt if bloom scan is expected to be cheaper
+  std::optional<std::vector<LogLocation>> lookup_logs_index(const final_chain::FinalChain& final_chain,
+                                                            EthBlockNumber to) const;
+  std::vector<LocalisedLogEntry> match_locations(const final_chain::FinalChain& final_chain,
+                                                 const std::vector<LogLocation>& locations, size_t begin,
+                                                 size_t end) const;
+  std::vector<LocalisedLogEntry> match_range(const final_chain::FinalChain& final_chain,
+                                             const std::vector<LogBloom>& blooms, EthBlockNumber from,
+                                             EthBlockNumber to) const;
 };
 
 AddressSet parse_addresses(const Json::Value& json);
@@ -0,0 +1,108 @@
+#pragma once
+
+#include <algorithm>
+#include <unordered_map>
+#include <vector>
+
+#include "LogFilter.hpp"
+
+namespace taraxa::net::rpc::eth {
+
+/**
+ * @brief Index of installed log filters, so that logs are matched only against filters that can possibly match them.
+ *
+ * Filter is indexed by its addresses, by its first topic options if it has no addresses or as a wildcard if it has
+ * neither. Every log entry has single address and first topic, so each filter is a candidate at most once per log.
+ *
+ * @note Not thread safe
+ */
+template <typename Key>
+class LogFilterIndex {
+ public:
+  void add(const Key& key, const LogFilter& filter) {
+    if (!filter.addresses().empty()) {
+      for (const auto& address : filter.addresses()) {
+        by_address_[address].push_back(key);
+      }
+    } else if (!filter.topics()[0].empty()) {
+      for (const auto& topic : filter.topics()[0]) {
+        by_topic0_[topic].push_back(key);
+      }
+    } else {
+      wildcard_.push_back(key);
+    }
+    ++size_;
+  }
+
+  void remove(const Key& key, const LogFilter& filter) {
+    if (!filter.addresses().empty()) {
+      for (const auto& address : filter.addresses()) {
+        erase(by_address_, address, key);
+      }
+    } else if (!filter.topics()[0].empty()) {
+      for (const auto& topic : filter.topics()[0]) {
+        erase(by_topic0_, topic, key);
+      }
+    } else {
+      wildcard_.erase(std::remove(wildcard_.begin(), wildcard_.end(), key), wildcard_.end());
+    }
+    --size_;
+  }
+
+  size_t size() const { return size_; }
+  bool empty() const { return size_ == 0; }
+
+  /**
+   * @brief Calls cb once for every filter that may match some log of the receipt, filter itself still needs to be
+   * matched against the receipt
+   */
+  template <typename Callback>
+  void forEachCandidate(const TransactionReceipt& receipt, Callback&& cb) const {
+    if (receipt.logs.empty() || empty()) {
+      return;
+    }
+
+    std::vector<Key> candidates(wildcard_);
+    const auto append = [&candidates](const auto& index, const auto& value) {
+      if (auto it = index.find(value); it != index.end()) {
+        candidates.insert(candidates.end(), it->second.begin(), it->second.end());
+      }
+    };
+    for (const auto& log : receipt.logs) {
+      append(by_address_, log.address);
+      if (!log.topics.empty()) {
+        append(by_topic0_, log.topics[0]);
+      }
+    }
+    // Filter could be a candidate for multiple logs of the same receipt
+    if (receipt.logs.size() > 1) {
+      std::sort(candidates.begin(), candidates.end());
+      candidates.erase(std::unique(candidates.begin(), candidates.end()), candidates.end());
+    }
+
+    for (const auto& key : candidates) {
+      cb(key);
+    }
+  }
+
+ private:
+  template <typename Index, typename Value>
+  static void erase(Index& index, const Value& value, const Key& key) {
+    auto it = index.find(value);
+    if (it == index.end()) {
+      return;
+    }
+    auto& keys = it->second;
+    keys.erase(std::remove(keys.begin(), keys.end(), key), keys.end());
+    if (keys.empty()) {
+      index.erase(it);
+    }
+  }
+
+  std::unordered_map<Address, std::vector<Key>> by_address_;
+  std::unordered_map<h256, std::vector<Key>> by_topic0_;
+  std::vector<Key> wildcard_;
+  size_t size_ = 0;
+};
+
+}  // namespace taraxa::net::rpc::eth
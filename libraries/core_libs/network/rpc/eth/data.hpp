@@ -7,8 +7,10 @@ namespace taraxa::net::rpc::eth {
 using taraxa::LogBloom;
 using taraxa::LogBlooms;
 using taraxa::LogEntry;
+using taraxa::LogEntryView;
 using taraxa::TransactionLocation;
 using taraxa::TransactionReceipt;
+using taraxa::TransactionReceiptView;
 
 struct TransactionLocationWithBlockHash : TransactionLocation {
   h256 blk_h{};
@@ -30,6 +32,14 @@ struct LocalisedTransactionReceipt {
   std::optional<addr_t> trx_to;
 };
 
+// Same as LocalisedTransactionReceipt, but serialized straight from the stored RLP
+struct LocalisedTransactionReceiptView {
+  TransactionReceiptView r;
+  ExtendedTransactionLocation trx_loc;
+  addr_t trx_from;
+  std::optional<addr_t> trx_to;
+};
+
 struct LocalisedLogEntry {
   LogEntry le;
   ExtendedTransactionLocation trx_loc;
@@ -58,6 +68,7 @@ Json::Value toJson(const LocalisedTransaction& lt);
 Json::Value toJson(const final_chain::BlockHeader& obj);
 Json::Value toJson(const LocalisedLogEntry& lle);
 Json::Value toJson(const LocalisedTransactionReceipt& ltr);
+Json::Value toJson(const LocalisedTransactionReceiptView& ltr);
 Json::Value toJson(const SyncStatus& obj);
 
 template <typename T>
@@ -4,6 +4,7 @@
 #include <queue>
 
 #include "LogFilter.hpp"
+#include "LogFilterIndex.hpp"
 #include "common/global_const.hpp"
 #include "data.hpp"
 
@@ -35,10 +36,21 @@ using WatchID = uint64_t;
 GLOBAL_CONST(WatchType, watch_id_type_mask_bits);
 
 struct placeholder_t {};
-template <WatchType type_, typename InputType_, typename OutputType_ = placeholder_t, typename Params = placeholder_t>
+
+// Index of logs watches, updates are processed only for watches which filters can match the receipt logs
+struct LogsWatchIndex : LogFilterIndex<WatchID> {
+  template <typename Input, typename Callback>
+  void forEachCandidate(const Input& input, Callback&& cb) const {
+    LogFilterIndex<WatchID>::forEachCandidate(input.second, std::forward<Callback>(cb));
+  }
+};
+
+template <WatchType type_, typename InputType_, typename OutputType_ = placeholder_t, typename Params = placeholder_t,
+          typename Index = placeholder_t>
 class WatchGroup {
  public:
   static constexpr auto type = type_;
+  static constexpr bool is_indexed = !std::is_same_v<Index, placeholder_t>;
   using InputType = InputType_;
   using OutputType = std::conditional_t<std::is_same_v<OutputType_, placeholder_t>, InputType, OutputType_>;
   using time_point = std::chrono::high_resolution_clock::time_point;
@@ -59,6 +71,8 @@ class WatchGroup {
   mutable std::unordered_map<WatchID, Watch> watches_;
   mutable std::shared_mutex watches_mu_;
   mutable WatchID watch_id_seq_ = 0;
+  // Guarded by watches_mu_
+  mutable Index index_;
 
  public:
   explicit WatchGroup(WatchesConfig const& cfg = {}, Updater&& updater = {})
@@ -79,13 +93,22 @@ class WatchGroup {
       throw WatchLimitExceeded();
     }
     auto id = ((++watch_id_seq_) << watch_id_type_mask_bits()) + type;
-    watches_.insert_or_assign(id, Watch{std::move(params), std::chrono::high_resolution_clock::now()});
+    [[maybe_unused]] auto [it, _] =
+        watches_.insert_or_assign(id, Watch{std::move(params), std::chrono::high_resolution_clock::now()});
+    if constexpr (is_indexed) {
+      index_.add(id, it->second.params);
+    }
     return id;
   }
 
   bool uninstall_watch(WatchID watch_id) const {
     std::unique_lock l(watches_mu_);
-    return watches_.erase(watch_id);
+    auto it = watches_.find(watch_id);
+    if (it == watches_.end()) {
+      return false;
+    }
+    erase(it);
+    return true;
   }
 
   void uninstall_stale_watches() const {
@@ -94,7 +117,7 @@ class WatchGroup {
     for (auto it = watches_.begin(); it != watches_.end();) {
       if (cfg_.idle_timeout <=
           duration_cast<std::chrono::seconds>(std::chrono::high_resolution_clock::now() - it->second.last_touched)) {
-        it = watches_.erase(it);
+        it = erase(it);
         did_uninstall = true;
       } else {
         it++;
@@ -117,12 +140,18 @@ class WatchGroup {
 
   void process_update(InputType const& obj_in) const {
     std::shared_lock l(watches_mu_);
-    for (auto& entry : watches_) {
-      auto& watch = entry.second;
+    const auto update = [&](Watch& watch) {
       updater_(watch.params, obj_in, [&](auto const& obj_out) {
         std::unique_lock l(watch.mu.val);
         watch.updates.push_back(obj_out);
       });
+    };
+    if constexpr (is_indexed) {
+      index_.forEachCandidate(obj_in, [&](WatchID watch_id) { update(watches_.at(watch_id)); });
+    } else {
+      for (auto& entry : watches_) {
+        update(entry.second);
+      }
     }
   }
 
@@ -137,6 +166,14 @@ class WatchGroup {
     }
     return ret;
   }
+
+ private:
+  auto erase(typename std::unordered_map<WatchID, Watch>::iterator it) const {
+    if constexpr (is_indexed) {
+      index_.remove(it->first, it->second.params);
+    }
+    return watches_.erase(it);
+  }
 };
 
 class Watches {
@@ -146,8 +183,8 @@ class Watches {
   WatchGroup<WatchType::new_blocks, h256> const new_blocks_{cfg_};
   WatchGroup<WatchType::new_transactions, h256> const new_transactions_{cfg_};
   WatchGroup<WatchType::logs,  //
-             std::pair<ExtendedTransactionLocation const&, TransactionReceipt const&>, LocalisedLogEntry,
-             LogFilter> const logs_{
+             std::pair<ExtendedTransactionLocation const&, TransactionReceipt const&>, LocalisedLogEntry, LogFilter,
+             LogsWatchIndex> const logs_{
       cfg_,
       [](auto const& log_filter, auto const& input, auto const& do_update) {
         auto const& [trx_loc, receipt] = input;
@@ -1,10 +1,104 @@
-
 #include "jsonrpc_http_processor.hpp"
 
+#include <algorithm>
+#include <cctype>
+#include <condition_variable>
+#include <mutex>
+
 #include "common/jsoncpp.hpp"
 #include "common/util.hpp"
 namespace taraxa::net {
 
+namespace {
+
+Json::Value requestId(const Json::Value &req_json) {
+  if (req_json.isObject() && req_json.isMember("id") &&  // this conditional was taken from jsonrpccpp sources
+      (req_json["id"].isNull() || req_json["id"].isIntegral() || req_json["id"].isString())) {
+    return req_json["id"];
+  }
+  return Json::nullValue;
+}
+
+Json::Value makeErrorResponse(const Json::Value &id, int code, const std::string &message) {
+  Json::Value res_json(Json::objectValue);
+  res_json["jsonrpc"] = "2.0";
+  res_json["id"] = id;
+  auto &res_json_error = res_json["error"] = Json::Value(Json::objectValue);
+  res_json_error["code"] = code;
+  res_json_error["message"] = message;
+  return res_json;
+}
+
+bool isBatch(const std::string &body) {
+  const auto first = body.find_first_not_of(" \t\r\n");
+  return first != std::string::npos && body[first] == '[';
+}
+
+void setCommonHeaders(HttpProcessor::Response &response) {
+  response.set("Access-Control-Allow-Origin", "*");
+  response.set("Access-Control-Allow-Headers", "Accept, Accept-Language, Content-Language, Content-Type");
+  response.set("Connection", "close");
+}
+
+}  // namespace
+
+JsonStreamWriter::JsonStreamWriter(const HttpProcessor::ChunkWriter &write_chunk, size_t buffer_size)
+    : write_chunk_(write_chunk), buffer_size_(buffer_size) {}
+
+void JsonStreamWriter::write(std::string_view json) {
+  if (buffer_.size() + json.size() > buffer_size_) {
+    flush();
+    // Value that doesn't fit into the buffer is sent without copying
+    if (json.size() > buffer_size_) {
+      send(json);
+      return;
+    }
+  }
+  buffer_.append(json);
+}
+
+void JsonStreamWriter::writeValue(const Json::Value &json) { write(util::to_string(json)); }
+
+void JsonStreamWriter::beginArray() {
+  write("[");
+  array_empty_ = true;
+}
+
+void JsonStreamWriter::writeArrayItem(const Json::Value &json) {
+  if (!array_empty_) {
+    write(",");
+  }
+  array_empty_ = false;
+  writeValue(json);
+}
+
+void JsonStreamWriter::endArray() { write("]"); }
+
+void JsonStreamWriter::flush() {
+  if (buffer_.empty()) {
+    return;
+  }
+  send(buffer_);
+  buffer_.clear();
+}
+
+void JsonStreamWriter::reset() { buffer_.clear(); }
+
+void JsonStreamWriter::send(std::string_view data) {
+  if (!write_chunk_(data)) {
+    throw std::runtime_error("Streamed response could not be sent");
+  }
+  started_ = true;
+}
+
+JsonRpcHttpProcessor::JsonRpcHttpProcessor(std::shared_ptr<util::ThreadPool> pool, BatchLimits batch_limits,
+                                           size_t stream_buffer_size)
+    : pool_(std::move(pool)), batch_limits_(batch_limits), stream_buffer_size_(stream_buffer_size) {}
+
+void JsonRpcHttpProcessor::addStreamingMethod(const jsonrpc::Procedure &procedure, StreamingMethod method) {
+  streaming_methods_.insert_or_assign(procedure.GetProcedureName(), std::make_pair(procedure, std::move(method)));
+}
+
 HttpProcessor::Response JsonRpcHttpProcessor::process(const Request &request) {
   Response response;
   std::optional<JsonRpcHttpProcessor::Error> err;
@@ -17,39 +111,190 @@ HttpProcessor::Response JsonRpcHttpProcessor::process(const Request &request) {
     response.set("Content-Type", "application/json");
     response.result(boost::beast::http::status::ok);
     try {
-      handler->HandleRequest(request.body(), response.body());
+      std::optional<Json::Value> batch;
+      if (isBatch(request.body())) {
+        try {
+          batch = util::parse_json(request.body());
+        } catch (Json::Exception const &) {
+          // Invalid json is reported by the handler
+        }
+      }
+      if (batch && batch_limits_.max_size && batch->size() > batch_limits_.max_size) {
+        err.emplace();
+        err->code = jsonrpc::Errors::ERROR_RPC_INVALID_REQUEST;
+        err->message << "Batch of " << batch->size() << " calls exceeds limit of " << batch_limits_.max_size;
+      } else if (batch && batch->isArray() && batch->size() > 1) {
+        response.body() = processBatch(*batch);
+      } else {
+        handler->HandleRequest(request.body(), response.body());
+      }
     } catch (std::exception const &e) {
       err.emplace();
       err->message << e.what();
     }
     if (err) {
-      auto const &err_msg = err->message.str();
-      Json::Value res_json(Json::objectValue);
-      res_json["jsonrpc"] = "2.0";
-      auto req_json = util::parse_json(request.body());
-      if (req_json.isObject() && req_json.isMember("id") &&  // this conditional was taken from jsonrpccpp sources
-          (req_json["id"].isNull() || req_json["id"].isIntegral() || req_json["id"].isString())) {
-        res_json["id"] = req_json["id"];
-      } else {
-        res_json["id"] = Json::nullValue;
+      Json::Value id = Json::nullValue;
+      try {
+        id = requestId(util::parse_json(request.body()));
+      } catch (Json::Exception const &) {
       }
-      auto &res_json_error = res_json["error"] = Json::Value(Json::objectValue);
-      res_json_error["code"] = err->code;
-      res_json_error["message"] = err_msg;
+      auto res_json = makeErrorResponse(id, err->code, err->message.str());
       if (!err->data.empty()) {
-        res_json_error["data"] = err->data;
+        res_json["error"]["data"] = err->data;
       }
       response.body() = util::to_string(res_json);
     }
   } else {
     response.result(boost::beast::http::status::method_not_allowed);
   }
-  response.set("Access-Control-Allow-Origin", "*");
-  response.set("Access-Control-Allow-Headers", "Accept, Accept-Language, Content-Language, Content-Type");
-  response.set("Connection", "close");
+  setCommonHeaders(response);
   response.prepare_payload();
 
   return response;
 }
 
-}  // namespace taraxa::net
\ No newline at end of file
+HttpProcessor::BodyStreamer JsonRpcHttpProcessor::stream(const Request &request, Response &header) {
+  if (streaming_methods_.empty() || request.method() != boost::beast::http::verb::post || isBatch(request.body())) {
+    return {};
+  }
+  // Cheap check, so that requests of other methods are not parsed twice
+  const auto &body = request.body();
+  if (std::none_of(streaming_methods_.begin(), streaming_methods_.end(), [&body](const auto &method) {
+        return body.find('"' + method.first + '"') != std::string::npos;
+      })) {
+    return {};
+  }
+
+  Json::Value call;
+  try {
+    call = util::parse_json(body);
+  } catch (Json::Exception const &) {
+    return {};
+  }
+  // Notifications have no response, so they are left to the handler
+  if (!call.isObject() || !call["method"].isString() || !call.isMember("id")) {
+    return {};
+  }
+  const auto method = streaming_methods_.find(call["method"].asString());
+  if (method == streaming_methods_.end()) {
+    return {};
+  }
+
+  header.version(request.version());
+  header.result(boost::beast::http::status::ok);
+  header.set("Content-Type", "application/json");
+  setCommonHeaders(header);
+
+  return [&procedure = method->second.first, &method = method->second.second, call = std::move(call),
+          stream_buffer_size = stream_buffer_size_](const ChunkWriter &write_chunk) {
+    JsonStreamWriter writer(write_chunk, stream_buffer_size);
+    const auto id = requestId(call);
+    try {
+      // Methods rely on params having been validated, same as methods called by the handler
+      if (!procedure.ValidateParameters(call["params"])) {
+        throw jsonrpc::JsonRpcException(jsonrpc::Errors::ERROR_RPC_INVALID_PARAMS);
+      }
+      writer.write(R"({"id":)");
+      writer.writeValue(id);
+      writer.write(R"(,"jsonrpc":"2.0","result":)");
+      method(call["params"], writer);
+      writer.write("}");
+      writer.flush();
+    } catch (const std::exception &e) {
+      if (writer.isStarted()) {
+        throw;
+      }
+      // Nothing was sent yet, so regular error response can be sent instead
+      writer.reset();
+      int code = jsonrpc::Errors::ERROR_RPC_INTERNAL_ERROR;
+      std::string message = e.what();
+      if (const auto rpc_exception = dynamic_cast<const jsonrpc::JsonRpcException *>(&e)) {
+        code = rpc_exception->GetCode();
+        message = rpc_exception->GetMessage();
+      }
+      writer.writeValue(makeErrorResponse(id, code, message));
+      writer.flush();
+    }
+  };
+}
+
+std::string JsonRpcHttpProcessor::processBatch(const Json::Value &batch) {
+  // Shared with pool tasks as they could be started after the batch is already finished
+  struct BatchExecution {
+    std::vector<Json::Value> calls;
+    std::vector<std::string> responses;
+    std::optional<std::chrono::steady_clock::time_point> deadline;
+    std::atomic<size_t> next_call = 0;
+    size_t finished_calls = 0;
+    std::mutex mutex;
+    std::condition_variable finished_cv;
+  };
+
+  auto execution = std::make_shared<BatchExecution>();
+  execution->calls.assign(batch.begin(), batch.end());
+  execution->responses.resize(execution->calls.size());
+  if (batch_limits_.timeout.count()) {
+    execution->deadline = std::chrono::steady_clock::now() + batch_limits_.timeout;
+  }
+
+  // Every call is claimed by a single thread, so the request thread waits only for calls that are being executed
+  const auto execute = [handler = GetHandler()](BatchExecution &execution) {
+    for (auto i = execution.next_call++; i < execution.calls.size(); i = execution.next_call++) {
+      const auto &call = execution.calls[i];
+      auto &response = execution.responses[i];
+      // Notifications get no response, not even an error
+      const bool is_notification = !call.isObject() || !call.isMember("id");
+      if (execution.deadline && std::chrono::steady_clock::now() > *execution.deadline) {
+        if (!is_notification) {
+          response = util::to_string(makeErrorResponse(requestId(call), jsonrpc::Errors::ERROR_RPC_INTERNAL_ERROR,
+                                                       "Batch execution time limit exceeded"));
+        }
+      } else {
+        try {
+          handler->HandleRequest(util::to_string(call), response);
+        } catch (std::exception const &e) {
+          if (!is_notification) {
+            response = util::to_string(
+                makeErrorResponse(requestId(call), jsonrpc::Errors::ERROR_RPC_INTERNAL_ERROR, e.what()));
+          }
+        }
+      }
+
+      std::lock_guard<std::mutex> lock(execution.mutex);
+      if (++execution.finished_calls == execution.calls.size()) {
+        execution.finished_cv.notify_one();
+      }
+    }
+  };
+
+  if (pool_) {
+    const auto helpers_count = std::min<size_t>(pool_->capacity(), execution->calls.size() - 1);
+    for (size_t i = 0; i < helpers_count; ++i) {
+      pool_->post([execution, execute]() { execute(*execution); });
+    }
+  }
+  execute(*execution);
+  {
+    std::unique_lock<std::mutex> lock(execution->mutex);
+    execution->finished_cv.wait(lock, [&] { return execution->finished_calls == execution->calls.size(); });
+  }
+
+  std::string result;
+  for (auto &response : execution->responses) {
+    // Handler terminates responses with a new line
+    while (!response.empty() && std::isspace(static_cast<unsigned char>(response.back()))) {
+      response.pop_back();
+    }
+    if (response.empty()) {
+      continue;
+    }
+    result += result.empty() ? "[" : ",";
+    result += response;
+  }
+  if (!result.empty()) {
+    result += "]";
+  }
+  return result;
+}
+
+}  // namespace taraxa::net
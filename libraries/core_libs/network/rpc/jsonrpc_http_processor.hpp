@@ -2,12 +2,50 @@
 
 #include <json/json.h>
 #include <jsonrpccpp/common/exception.h>
+#include <jsonrpccpp/common/procedure.h>
 #include <jsonrpccpp/server/abstractserverconnector.h>
 
+#include <chrono>
+#include <unordered_map>
+
+#include "common/thread_pool.hpp"
 #include "network/http_server.hpp"
 
 namespace taraxa::net {
 
+/**
+ * @brief Serializes json incrementally into chunks of a streamed response. At most buffer_size bytes are buffered,
+ * larger values are sent directly, so memory used by the response does not grow with its size
+ */
+class JsonStreamWriter {
+ public:
+  JsonStreamWriter(const HttpProcessor::ChunkWriter& write_chunk, size_t buffer_size);
+
+  // Writes already serialized json
+  void write(std::string_view json);
+  void writeValue(const Json::Value& json);
+
+  void beginArray();
+  void writeArrayItem(const Json::Value& json);
+  void endArray();
+
+  // Sends buffered data, throws if they could not be sent
+  void flush();
+  // True if part of the response was already sent, so it can't be replaced by an error response
+  bool isStarted() const { return started_; }
+  // Drops buffered data
+  void reset();
+
+ private:
+  void send(std::string_view data);
+
+  const HttpProcessor::ChunkWriter& write_chunk_;
+  const size_t buffer_size_;
+  std::string buffer_;
+  bool started_ = false;
+  bool array_empty_ = true;
+};
+
 class JsonRpcHttpProcessor final : public HttpProcessor, public jsonrpc::AbstractServerConnector {
  public:
   struct Error {
@@ -16,10 +54,49 @@ class JsonRpcHttpProcessor final : public HttpProcessor, public jsonrpc::Abstrac
     Json::Value data{Json::objectValue};
   };
 
+  // Limits of a single batch request, 0 means unlimited
+  struct BatchLimits {
+    size_t max_size = 0;
+    std::chrono::milliseconds timeout{0};
+  };
+
+  // Writes result of the call with given params
+  using StreamingMethod = std::function<void(const Json::Value& params, JsonStreamWriter& writer)>;
+
+  static constexpr size_t kDefaultStreamBufferSize = 1 << 20;
+
+  /**
+   * @param pool calls of batch requests are executed on it concurrently with the thread processing the request,
+   *        batches are executed sequentially if not provided
+   * @param stream_buffer_size max size of streamed response buffered in memory
+   */
+  explicit JsonRpcHttpProcessor(std::shared_ptr<util::ThreadPool> pool = {}, BatchLimits batch_limits = {},
+                                size_t stream_buffer_size = kDefaultStreamBufferSize);
+
+  /**
+   * @brief Responds to single (not batched) calls of the procedure with streamed response produced by method, instead
+   * of building whole response by jsonrpccpp handler. Params are validated against the procedure same as by the
+   * handler. Methods must be added before the server is started
+   */
+  void addStreamingMethod(const jsonrpc::Procedure& procedure, StreamingMethod method);
+
   Response process(const Request& request) override;
+  BodyStreamer stream(const Request& request, Response& header) override;
 
   bool StartListening() override { return true; }
   bool StopListening() override { return true; }
+
+ private:
+  /**
+   * @brief Executes calls of the batch in parallel and assembles their responses in the request order. Calls that
+   * were not started before batch timeout expired get an error response
+   */
+  std::string processBatch(const Json::Value& batch);
+
+  std::shared_ptr<util::ThreadPool> pool_;
+  const BatchLimits batch_limits_;
+  const size_t stream_buffer_size_;
+  std::unordered_map<std::string, std::pair<jsonrpc::Procedure, StreamingMethod>> streaming_methods_;
 };
 
 }  // namespace taraxa::net
\ No newline at end of file
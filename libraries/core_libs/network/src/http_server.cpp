@@ -1,7 +1,57 @@
 #include "network/http_server.hpp"
 
+#include <poll.h>
+
 namespace taraxa::net {
 
+namespace {
+
+/**
+ * @brief Synchronous write stream over the socket, writes fail with timed_out if they are not completed before the
+ * deadline, so a client that stops reading can't block the thread writing to it
+ */
+class DeadlineWriteStream {
+ public:
+  explicit DeadlineWriteStream(boost::asio::ip::tcp::socket &socket) : socket_(socket) { socket_.non_blocking(true); }
+
+  void expiresAfter(std::chrono::milliseconds timeout) { deadline_ = std::chrono::steady_clock::now() + timeout; }
+
+  template <typename ConstBufferSequence>
+  size_t write_some(const ConstBufferSequence &buffers, boost::system::error_code &ec) {
+    while (true) {
+      const auto written = socket_.write_some(buffers, ec);
+      if (ec != boost::asio::error::would_block && ec != boost::asio::error::try_again) {
+        return written;
+      }
+      const auto remaining =
+          std::chrono::duration_cast<std::chrono::milliseconds>(deadline_ - std::chrono::steady_clock::now());
+      if (remaining.count() <= 0) {
+        ec = boost::asio::error::timed_out;
+        return 0;
+      }
+      // Wait until socket is writable, errors are reported by the next write
+      pollfd fd{socket_.native_handle(), POLLOUT, 0};
+      ::poll(&fd, 1, static_cast<int>(remaining.count()));
+    }
+  }
+
+  template <typename ConstBufferSequence>
+  size_t write_some(const ConstBufferSequence &buffers) {
+    boost::system::error_code ec;
+    const auto written = write_some(buffers, ec);
+    if (ec) {
+      throw boost::system::system_error(ec);
+    }
+    return written;
+  }
+
+ private:
+  boost::asio::ip::tcp::socket &socket_;
+  std::chrono::steady_clock::time_point deadline_;
+};
+
+}  // namespace
+
 HttpServer::HttpServer(boost::asio::io_context &io, boost::asio::ip::tcp::endpoint ep, const addr_t &node_addr,
                        const std::shared_ptr<HttpProcessor> &request_processor,
                        std::shared_ptr<metrics::JsonRpcMetrics> metrics)
@@ -111,7 +161,12 @@ void HttpConnection::read() {
           LOG(server_->log_dg_) << "Received: " << request_;
 
           auto start_time = std::chrono::steady_clock::now();
-          response_ = server_->request_processor_->process(request_);
+          auto streamer = server_->request_processor_->stream(request_, response_);
+          if (!streamer) {
+            response_ = server_->request_processor_->process(request_);
+          } else if (!writeStreamed(streamer)) {
+            LOG(server_->log_nf_) << "Streamed response was not completed";
+          }
           auto end_time = std::chrono::steady_clock::now();
           auto processing_time = std::chrono::duration_cast<std::chrono::microseconds>(end_time - start_time);
 
@@ -119,6 +174,10 @@ void HttpConnection::read() {
             server_->metrics_->report(request_.body(), ip, "HTTP", processing_time.count());
           }
 
+          if (streamer) {
+            stop();
+            return;
+          }
           boost::beast::http::async_write(
               socket_, response_,
               [this_sp = getShared()](auto const & /*ec*/, auto /*bytes_transferred*/) { this_sp->stop(); });
@@ -126,4 +185,46 @@ void HttpConnection::read() {
       });
 }
 
+bool HttpConnection::writeStreamed(const HttpProcessor::BodyStreamer &streamer) {
+  boost::system::error_code ec;
+  DeadlineWriteStream stream(socket_);
+  response_.chunked(true);
+  boost::beast::http::response_serializer<boost::beast::http::string_body> serializer(response_);
+  // Header is sent with the first chunk, so the processor can still change it until then
+  bool header_sent = false;
+  const auto send_header = [&] {
+    if (!header_sent) {
+      stream.expiresAfter(kStreamedWriteTimeout);
+      boost::beast::http::write_header(stream, serializer, ec);
+      header_sent = true;
+    }
+    return !ec;
+  };
+
+  try {
+    streamer([&](std::string_view chunk) {
+      if (!send_header()) {
+        return false;
+      }
+      if (!chunk.empty()) {
+        stream.expiresAfter(kStreamedWriteTimeout);
+        boost::asio::write(stream, boost::beast::http::make_chunk(boost::asio::buffer(chunk.data(), chunk.size())),
+                           ec);
+      }
+      return !ec;
+    });
+  } catch (const std::exception &e) {
+    // Client gets truncated chunked body, it is the only way to report error after the response has been started
+    LOG(server_->log_er_) << "Streamed response failed: " << e.what();
+    return false;
+  }
+
+  if (!send_header()) {
+    return false;
+  }
+  stream.expiresAfter(kStreamedWriteTimeout);
+  boost::asio::write(stream, boost::beast::http::make_chunk_last(), ec);
+  return !ec;
+}
+
 }  // namespace taraxa::net
\ No newline at end of file
@@ -31,7 +31,9 @@ Network::Network(const FullNodeConfig &config, const h256 &genesis_hash, const s
     : kConf(config),
       all_packets_stats_(nullptr),
       node_stats_(nullptr),
-      pbft_syncing_state_(std::make_shared<network::tarcap::PbftSyncingState>(config.network.deep_syncing_threshold)),
+      pbft_syncing_state_(std::make_shared<network::tarcap::PbftSyncingState>(
+          config.network.deep_syncing_threshold, config.network.sync_level_size, config.network.sync_max_peers,
+          std::chrono::milliseconds{config.network.sync_request_timeout_ms})),
       pbft_mgr_(pbft_mgr),
       tp_(config.network.num_threads, false),
       packets_tp_(std::make_shared<network::threadpool::PacketsThreadPool>(config.network.packets_processing_threads,
@@ -177,7 +179,9 @@ void Network::registerPeriodicEvents(std::shared_ptr<TransactionManager> trx_mgr
     for (auto &tarcap : tarcaps_) {
       auto tx_packet_handler = tarcap.second->getSpecificHandler<network::tarcap::ITransactionPacketHandler>(
           network::SubprotocolPacketType::kTransactionPacket);
-      tx_packet_handler->periodicSendTransactions(trx_mgr->getAllPoolTrxs());
+      tx_packet_handler->periodicSendNewTransactions(
+          trx_mgr->getAnnouncementLog(), [&trx_mgr]() { return trx_mgr->getAllPoolTrxs(); },
+          [&trx_mgr](const trx_hash_t &trx_hash) { return trx_mgr->getPooledTransaction(trx_hash); });
     }
   };
   periodic_events_tp_.post_loop({kConf.network.transaction_interval_ms}, sendTxs);
@@ -192,6 +196,23 @@ void Network::registerPeriodicEvents(std::shared_ptr<TransactionManager> trx_mgr
   };
   periodic_events_tp_.post_loop({4000}, sendStatus);
 
+  // Request timed out pbft sync chunks from other peers and keep idle peers busy
+  auto syncPbftChunks = [this]() {
+    if (!pbft_syncing_state_->isPbftSyncing()) {
+      return;
+    }
+
+    if (const auto timed_out = pbft_syncing_state_->syncRequests().checkTimeouts(); timed_out) {
+      LOG(log_dg_) << timed_out << " pbft sync requests timed out";
+    }
+    for (auto &tarcap : tarcaps_) {
+      auto pbft_sync_packet_handler = tarcap.second->getSpecificHandler<network::tarcap::ISyncPacketHandler>(
+          network::SubprotocolPacketType::kPbftSyncPacket);
+      pbft_sync_packet_handler->requestPbftSyncChunks();
+    }
+  };
+  periodic_events_tp_.post_loop({1000}, syncPbftChunks);
+
   // Check nodes connections and refresh boot nodes
   auto checkNodesConnections = [this]() {
     // If node count drops to zero add boot nodes again and retry
@@ -12,6 +12,9 @@ int Subscriptions::addSubscription(std::shared_ptr<Subscription> subscription) {
   std::lock_guard<std::mutex> lock(subscriptions_mutex_);
   subscriptions_[subscription->getId()] = subscription;
   subscriptions_by_type_[subscription->getType()].push_back(subscription->getId());
+  if (auto logs_sub = std::dynamic_pointer_cast<LogsSubscription>(subscription)) {
+    logs_index_.add(logs_sub->getId(), logs_sub->getFilter());
+  }
   return subscription->getId();
 }
 
@@ -24,84 +27,129 @@ bool Subscriptions::removeSubscription(int id) {
   auto sub = it->second;
   auto& subs = subscriptions_by_type_[sub->getType()];
   subs.erase(std::remove(subs.begin(), subs.end(), id), subs.end());
+  if (auto logs_sub = std::dynamic_pointer_cast<LogsSubscription>(sub)) {
+    logs_index_.remove(logs_sub->getId(), logs_sub->getFilter());
+  }
   subscriptions_.erase(it);
   return true;
 }
 
-void Subscriptions::process(SubscriptionType type, const Json::Value& payload) {
+void Subscriptions::process(SubscriptionType type, SubscriptionPayload& payload) {
+  std::lock_guard<std::mutex> lock(subscriptions_mutex_);
   for (auto id : subscriptions_by_type_[type]) {
-    send_(subscriptions_[id]->processPayload(payload));
+    send_(subscriptions_[id]->makeMessage(payload));
+  }
+}
+
+void Subscriptions::processLogs(LogsSubscriptionPayload& payload) {
+  std::lock_guard<std::mutex> lock(subscriptions_mutex_);
+  if (logs_index_.empty()) {
+    return;
+  }
+
+  uint32_t idx = 0;
+  for (const auto& receipt : payload.receipts) {
+    rpc::eth::ExtendedTransactionLocation loc{{{payload.header.number, idx}, payload.header.hash},
+                                              payload.trx_hashes[idx]};
+    logs_index_.forEachCandidate(receipt, [&](uint64_t id) {
+      const auto& sub = static_cast<const LogsSubscription&>(*subscriptions_[id]);
+      sub.getFilter().match_one(loc, receipt, [&](const rpc::eth::LocalisedLogEntry& le) {
+        send_(sub.makeMessage(payload.serialize(le), payload.createdAt()));
+      });
+    });
+    ++idx;
   }
 }
-void Subscriptions::processLogs(const final_chain::BlockHeader& header, TransactionHashes trx_hashes,
-                                const TransactionReceipts& receipts) {
-  for (auto id : subscriptions_by_type_[SubscriptionType::LOGS]) {
-    auto sub = std::dynamic_pointer_cast<LogsSubscription>(subscriptions_[id]);
-    if (!sub) {
-      continue;
-    }
-
-    auto filter = sub->getFilter();
-    if (!filter.matches(header.log_bloom)) {
-      continue;
-    }
-
-    uint32_t idx = 0;
-    for (const auto& receipt : receipts) {
-      rpc::eth::ExtendedTransactionLocation loc{{{header.number, idx}, header.hash}, trx_hashes[idx]};
-      filter.match_one(loc, receipt,
-                       [&](const rpc::eth::LocalisedLogEntry& le) { send_(sub->processPayload(toJson(le))); });
-    }
+
+const char* subscriptionTypeName(SubscriptionType type) {
+  switch (type) {
+    case SubscriptionType::HEADS:
+      return "newHeads";
+    case SubscriptionType::DAG_BLOCKS:
+      return "newDagBlocks";
+    case SubscriptionType::TRANSACTIONS:
+      return "newPendingTransactions";
+    case SubscriptionType::DAG_BLOCK_FINALIZED:
+      return "newDagBlocksFinalized";
+    case SubscriptionType::PBFT_BLOCK_EXECUTED:
+      return "newPbftBlocks";
+    case SubscriptionType::PILLAR_BLOCK:
+      return "newPillarBlockData";
+    case SubscriptionType::LOGS:
+      return "logs";
   }
+  return "unknown";
 }
 
-std::string makeEthSubscriptionResponse(int id, const Json::Value& payload) {
-  Json::Value params;
-  params["result"] = payload;
-  params["subscription"] = dev::toJS(id);
-  Json::Value res;
-  res["jsonrpc"] = "2.0";
-  res["method"] = "eth_subscription";
-  res["params"] = params;
+SubscriptionPayload::SubscriptionPayload(Json::Value payload)
+    : payload_(std::move(payload)), created_at_(std::chrono::steady_clock::now()) {}
 
-  return util::to_string(res);
+const SubscriptionPayload::Buffer& SubscriptionPayload::full() {
+  if (!full_) {
+    full_ = std::make_shared<const std::string>(util::to_string(payload_));
+  }
+  return full_;
 }
 
-std::string HeadsSubscription::processPayload(Json::Value payload) const {
-  return makeEthSubscriptionResponse(id_, payload);
+const SubscriptionPayload::Buffer& SubscriptionPayload::reduced(Reducer reducer) {
+  if (!reduced_) {
+    reduced_ = std::make_shared<const std::string>(util::to_string(reducer(payload_)));
+  }
+  return reduced_;
 }
 
-std::string DagBlocksSubscription::processPayload(Json::Value payload) const {
-  if (!full_data_) {
-    payload = payload["hash"];
+LogsSubscriptionPayload::LogsSubscriptionPayload(const final_chain::BlockHeader& header,
+                                                 const TransactionHashes& trx_hashes,
+                                                 const TransactionReceipts& receipts)
+    : header(header), trx_hashes(trx_hashes), receipts(receipts), created_at_(std::chrono::steady_clock::now()) {}
+
+const SubscriptionPayload::Buffer& LogsSubscriptionPayload::serialize(const rpc::eth::LocalisedLogEntry& log) {
+  auto& serialized = serialized_logs_[{log.trx_loc.position, log.position_in_receipt}];
+  if (!serialized) {
+    serialized = std::make_shared<const std::string>(util::to_string(toJson(log)));
   }
-  return makeEthSubscriptionResponse(id_, payload);
+  return serialized;
+}
+
+std::string_view SubscriptionMessage::head() {
+  static const std::string kHead = R"({"jsonrpc":"2.0","method":"eth_subscription","params":{"result":)";
+  return kHead;
 }
 
-std::string TransactionsSubscription::processPayload(Json::Value payload) const {
-  return makeEthSubscriptionResponse(id_, payload);
+Subscription::Subscription(int id) : id_(id), tail_(R"(,"subscription":")" + dev::toJS(id) + R"("}})") {}
+
+SubscriptionMessage Subscription::makeMessage(SubscriptionPayload& payload) const {
+  return makeMessage(selectPayload(payload), payload.createdAt());
 }
 
-std::string DagBlockFinalizedSubscription::processPayload(Json::Value payload) const {
-  return makeEthSubscriptionResponse(id_, payload);
+SubscriptionMessage Subscription::makeMessage(SubscriptionPayload::Buffer result,
+                                              std::chrono::steady_clock::time_point created_at) const {
+  return {getType(), std::move(result), tail_, created_at};
 }
 
-std::string PbftBlockExecutedSubscription::processPayload(Json::Value payload) const {
-  if (!full_block_) {
-    payload = payload["block_hash"];
+const SubscriptionPayload::Buffer& DagBlocksSubscription::selectPayload(SubscriptionPayload& payload) const {
+  if (!full_data_) {
+    return payload.reduced([](const Json::Value& p) { return p["hash"]; });
   }
-  return makeEthSubscriptionResponse(id_, payload);
+  return payload.full();
 }
 
-std::string PillarBlockSubscription::processPayload(Json::Value payload) const {
-  if (!include_signatures_) {
-    payload.removeMember("signatures");
+const SubscriptionPayload::Buffer& PbftBlockExecutedSubscription::selectPayload(SubscriptionPayload& payload) const {
+  if (!full_block_) {
+    return payload.reduced([](const Json::Value& p) { return p["block_hash"]; });
   }
-  return makeEthSubscriptionResponse(id_, payload);
+  return payload.full();
 }
 
-std::string LogsSubscription::processPayload(Json::Value payload) const {
-  return makeEthSubscriptionResponse(id_, payload);
+const SubscriptionPayload::Buffer& PillarBlockSubscription::selectPayload(SubscriptionPayload& payload) const {
+  if (!include_signatures_) {
+    return payload.reduced([](const Json::Value& p) {
+      auto reduced = p;
+      reduced.removeMember("signatures");
+      return reduced;
+    });
+  }
+  return payload.full();
 }
 
-}  // namespace taraxa::net
\ No newline at end of file
+}  // namespace taraxa::net
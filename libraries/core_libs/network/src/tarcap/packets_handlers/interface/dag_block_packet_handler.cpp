@@ -37,6 +37,8 @@ void IDagBlockPacketHandler::onNewBlockVerified(const std::shared_ptr<DagBlock>
     return;
   }
 
+  // Peers that do not know the same transactions share the same packet
+  std::vector<std::pair<SharedTransactions, std::vector<std::shared_ptr<TaraxaPeer>>>> groups;
   std::string peer_and_transactions_to_log;
   uint32_t start_with = rand() % peers_to_send_count;
   for (uint32_t i = 0; i < peers_to_send_count; i++) {
@@ -60,7 +62,18 @@ void IDagBlockPacketHandler::onNewBlockVerified(const std::shared_ptr<DagBlock>
       peer_and_transactions_to_log += trx_hash.abridged();
     }
 
-    sendBlockWithTransactions(peer, block, std::move(transactions_to_send));
+    const auto same_transactions = [&transactions_to_send](const auto &group) {
+      return group.first == transactions_to_send;
+    };
+    if (auto group = std::find_if(groups.begin(), groups.end(), same_transactions); group != groups.end()) {
+      group->second.push_back(peer);
+    } else {
+      groups.emplace_back(std::move(transactions_to_send), std::vector<std::shared_ptr<TaraxaPeer>>{peer});
+    }
+  }
+
+  for (auto &group : groups) {
+    broadcastBlockWithTransactions(group.second, block, std::move(group.first));
   }
 
   LOG(log_dg_) << "Send DagBlock " << block->getHash() << " to peers: " << peer_and_transactions_to_log;
@@ -40,7 +40,7 @@ void ISyncPacketHandler::startSyncingPbft() {
     LOG(this->log_si_) << "Restarting syncing PBFT from peer " << peer_id << ", peer PBFT chain size "
                        << peer_pbft_chain_size << ", own PBFT chain synced at period " << pbft_sync_period;
 
-    if (syncPeerPbft(pbft_sync_period + 1)) {
+    if (requestPbftSyncChunks()) {
       // Disable snapshots only if are syncing from scratch
       if (pbft_syncing_state_->isDeepPbftSyncing()) {
         db_->disableSnapshots();
@@ -56,22 +56,35 @@ void ISyncPacketHandler::startSyncingPbft() {
   }
 }
 
-bool ISyncPacketHandler::syncPeerPbft(PbftPeriod request_period) {
+bool ISyncPacketHandler::requestPbftSyncChunks() {
   const auto syncing_peer = pbft_syncing_state_->syncingPeer();
   if (!syncing_peer) {
     LOG(this->log_er_) << "Unable to send GetPbftSyncPacket. No syncing peer set.";
     return false;
   }
 
-  if (request_period > syncing_peer->pbft_chain_size_) {
-    LOG(this->log_wr_) << "Invalid syncPeerPbft argument. Node " << syncing_peer->getId() << " chain size "
-                       << syncing_peer->pbft_chain_size_ << ", requested period " << request_period;
-    return false;
+  // Syncing is driven by the capability the syncing peer is connected through
+  if (!peers_state_->getPeer(syncing_peer->getId())) {
+    return true;
+  }
+
+  std::vector<std::shared_ptr<TaraxaPeer>> peers;
+  for (auto& peer : peers_state_->getAllPeers()) {
+    peers.push_back(std::move(peer.second));
+  }
+
+  auto& sync_requests = pbft_syncing_state_->syncRequests();
+  const auto max_period = pbft_chain_->getPbftChainSize() + kMaxSyncAheadChunks * kConf.network.sync_level_size;
+  for (const auto& [peer, request_period] :
+       sync_requests.assignRequests(peers, syncing_peer, pbft_mgr_->pbftSyncingPeriod(), max_period)) {
+    LOG(this->log_nf_) << "Send GetPbftSyncPacket with period " << request_period << " to node " << peer->getId();
+    if (!this->sealAndSend(peer->getId(), SubprotocolPacketType::kGetPbftSyncPacket,
+                           encodePacketRlp(GetPbftSyncPacket{request_period}))) {
+      sync_requests.dropPeer(peer->getId());
+    }
   }
 
-  LOG(this->log_nf_) << "Send GetPbftSyncPacket with period " << request_period << " to node " << syncing_peer->getId();
-  return this->sealAndSend(syncing_peer->getId(), SubprotocolPacketType::kGetPbftSyncPacket,
-                           encodePacketRlp(GetPbftSyncPacket{request_period}));
+  return !sync_requests.finished(syncing_peer->pbft_chain_size_);
 }
 
 void ISyncPacketHandler::sendStatusToPeers() {
@@ -1,5 +1,9 @@
 #include "network/tarcap/packets_handlers/interface/transaction_packet_handler.hpp"
 
+#include <algorithm>
+#include <unordered_map>
+#include <unordered_set>
+
 namespace taraxa::network::tarcap {
 
 ITransactionPacketHandler::ITransactionPacketHandler(const FullNodeConfig &conf,
@@ -9,7 +13,19 @@ ITransactionPacketHandler::ITransactionPacketHandler(const FullNodeConfig &conf,
     : PacketHandler(conf, std::move(peers_state), std::move(packets_stats), node_addr, logs_prefix) {}
 
 void ITransactionPacketHandler::periodicSendTransactions(std::vector<SharedTransactions> &&transactions) {
-  auto peers_with_transactions_to_send = transactionsToSendToPeers(std::move(transactions));
+  sendTransactionsToPeers(transactionsToSendToPeers(std::move(transactions)));
+}
+
+void ITransactionPacketHandler::periodicSendNewTransactions(
+    const TransactionAnnouncementLog &announcements,
+    const std::function<std::vector<SharedTransactions>()> &pool_snapshot,
+    const std::function<SharedTransaction(const trx_hash_t &)> &get_pooled) {
+  sendTransactionsToPeers(newTransactionsToSendToPeers(announcements, pool_snapshot, get_pooled));
+}
+
+void ITransactionPacketHandler::sendTransactionsToPeers(
+    std::vector<std::pair<std::shared_ptr<TaraxaPeer>, std::pair<SharedTransactions, std::vector<trx_hash_t>>>>
+        &&peers_with_transactions_to_send) {
   const auto peers_to_send_count = peers_with_transactions_to_send.size();
   if (peers_to_send_count > 0) {
     // Sending it in same order favours some peers over others, always start with a different position
@@ -23,6 +39,18 @@ void ITransactionPacketHandler::periodicSendTransactions(std::vector<SharedTrans
 
 std::vector<std::pair<std::shared_ptr<TaraxaPeer>, std::pair<SharedTransactions, std::vector<trx_hash_t>>>>
 ITransactionPacketHandler::transactionsToSendToPeers(std::vector<SharedTransactions> &&transactions) {
+  std::vector<std::shared_ptr<TaraxaPeer>> peers;
+  for (const auto &peer : peers_state_->getAllPeers()) {
+    if (!peer.second->syncing_) {
+      peers.push_back(peer.second);
+    }
+  }
+  return transactionsToSendToPeers(peers, transactions);
+}
+
+std::vector<std::pair<std::shared_ptr<TaraxaPeer>, std::pair<SharedTransactions, std::vector<trx_hash_t>>>>
+ITransactionPacketHandler::transactionsToSendToPeers(const std::vector<std::shared_ptr<TaraxaPeer>> &peers,
+                                                     const std::vector<SharedTransactions> &transactions) {
   // Main goal of the algorithm below is to send different transactions and hashes to different peers but still follow
   // nonce ordering for single account and not send higher nonces without sending low nonces first
   const auto accounts_size = transactions.size();
@@ -31,27 +59,152 @@ ITransactionPacketHandler::transactionsToSendToPeers(std::vector<SharedTransacti
   }
   std::vector<std::pair<std::shared_ptr<TaraxaPeer>, std::pair<SharedTransactions, std::vector<trx_hash_t>>>>
       peers_with_transactions_to_send;
-  auto peers = peers_state_->getAllPeers();
 
   // account_index keeps current account index so that different peers will receive
   // transactions from different accounts
   uint32_t account_index = 0;
   for (const auto &peer : peers) {
+    std::pair<SharedTransactions, std::vector<trx_hash_t>> peer_transactions;
+    std::tie(account_index, peer_transactions) = transactionsToSendToPeer(peer, transactions, account_index);
+
+    if (peer_transactions.first.size() > 0) {
+      peers_with_transactions_to_send.push_back({peer, std::move(peer_transactions)});
+    }
+  }
+
+  return peers_with_transactions_to_send;
+}
+
+std::vector<std::pair<std::shared_ptr<TaraxaPeer>, std::pair<SharedTransactions, std::vector<trx_hash_t>>>>
+ITransactionPacketHandler::newTransactionsToSendToPeers(
+    const TransactionAnnouncementLog &announcements,
+    const std::function<std::vector<SharedTransactions>()> &pool_snapshot,
+    const std::function<SharedTransaction(const trx_hash_t &)> &get_pooled) {
+  std::vector<std::pair<std::shared_ptr<TaraxaPeer>, std::pair<SharedTransactions, std::vector<trx_hash_t>>>>
+      peers_with_transactions_to_send;
+  // Peers which have no cursor yet or whose cursor was already overwritten in the log need the whole pool
+  std::vector<std::shared_ptr<TaraxaPeer>> snapshot_peers;
+
+  for (const auto &peer : peers_state_->getAllPeers()) {
     if (peer.second->syncing_) {
       continue;
     }
 
-    std::pair<SharedTransactions, std::vector<trx_hash_t>> peer_transactions;
-    std::tie(account_index, peer_transactions) = transactionsToSendToPeer(peer.second, transactions, account_index);
+    auto peer_transactions = newTransactionsToSendToPeer(peer.second, announcements, get_pooled);
+    if (!peer_transactions.has_value()) {
+      snapshot_peers.push_back(peer.second);
+      continue;
+    }
+    if (peer_transactions->first.size() > 0) {
+      peers_with_transactions_to_send.push_back({peer.second, std::move(*peer_transactions)});
+    }
+  }
 
-    if (peer_transactions.first.size() > 0) {
-      peers_with_transactions_to_send.push_back({peer.second, std::move(peer_transactions)});
+  if (!snapshot_peers.empty()) {
+    // Head is read before the snapshot is taken so no transaction inserted meanwhile is missed, transactions that
+    // end up both in the snapshot and after the cursor are filtered out by peer known transactions
+    const auto head = announcements.head();
+    auto snapshot_transactions = transactionsToSendToPeers(snapshot_peers, pool_snapshot());
+    // Peer stays on snapshots until it gets the rest of the pool, only then it switches to the announcement log
+    std::unordered_set<std::shared_ptr<TaraxaPeer>> saturated_peers;
+    for (auto &peer_transactions : snapshot_transactions) {
+      if (peer_transactions.second.first.size() == kMaxTransactionsInPacket) {
+        saturated_peers.insert(peer_transactions.first);
+      }
+      peers_with_transactions_to_send.push_back(std::move(peer_transactions));
+    }
+    for (const auto &peer : snapshot_peers) {
+      if (!saturated_peers.contains(peer)) {
+        peer->transactions_announcement_cursor_ = head;
+      }
     }
   }
 
   return peers_with_transactions_to_send;
 }
 
+std::optional<std::pair<SharedTransactions, std::vector<trx_hash_t>>>
+ITransactionPacketHandler::newTransactionsToSendToPeer(
+    const std::shared_ptr<TaraxaPeer> &peer, const TransactionAnnouncementLog &announcements,
+    const std::function<SharedTransaction(const trx_hash_t &)> &get_pooled) {
+  const uint64_t cursor = peer->transactions_announcement_cursor_;
+  if (!cursor) {
+    return std::nullopt;
+  }
+
+  std::pair<SharedTransactions, std::vector<trx_hash_t>> result;
+  // Announcements are read in batches so the log is not locked while peer known cache and pool are checked
+  uint64_t sequence = cursor;
+  uint64_t next_cursor = cursor;
+  // Once max number of transactions is reached the following announcements are only used as hashes and the cursor
+  // stays behind them, so they are sent as transactions in the next rounds
+  uint64_t hashes_end = 0;
+  while (!hashes_end || sequence < hashes_end) {
+    auto announced = announcements.since(sequence, kMaxTransactionsInPacket);
+    if (!announced.has_value()) {
+      if (sequence == cursor) {
+        return std::nullopt;
+      }
+      // Overwritten in the middle of the walk, peer gets pool snapshot in the next round
+      break;
+    }
+    if (announced->empty()) {
+      break;
+    }
+
+    for (const auto &trx_hash : *announced) {
+      if (hashes_end && sequence == hashes_end) {
+        break;
+      }
+      sequence++;
+      if (!hashes_end) {
+        next_cursor = sequence;
+      }
+
+      if (peer->isTransactionKnown(trx_hash)) {
+        continue;
+      }
+      auto trx = get_pooled(trx_hash);
+      if (!trx) {
+        continue;
+      }
+      if (hashes_end) {
+        result.second.push_back(trx_hash);
+        continue;
+      }
+      result.first.push_back(std::move(trx));
+      if (result.first.size() == kMaxTransactionsInPacket) {
+        hashes_end = sequence + kMaxHashesInPacket;
+      }
+    }
+  }
+
+  // Announcements of the same account might come out of nonce order, sort transactions of each account by nonce in the
+  // positions they already take in the packet
+  std::unordered_map<addr_t, std::vector<size_t>> account_positions;
+  for (size_t i = 0; i < result.first.size(); i++) {
+    account_positions[result.first[i]->getSender()].push_back(i);
+  }
+  for (const auto &[account, positions] : account_positions) {
+    if (positions.size() < 2) {
+      continue;
+    }
+    SharedTransactions account_trxs;
+    account_trxs.reserve(positions.size());
+    for (const auto position : positions) {
+      account_trxs.push_back(std::move(result.first[position]));
+    }
+    std::sort(account_trxs.begin(), account_trxs.end(),
+              [](const auto &a, const auto &b) { return a->getNonce() < b->getNonce(); });
+    for (size_t i = 0; i < positions.size(); i++) {
+      result.first[positions[i]] = std::move(account_trxs[i]);
+    }
+  }
+
+  peer->transactions_announcement_cursor_ = next_cursor;
+  return result;
+}
+
 std::pair<uint32_t, std::pair<SharedTransactions, std::vector<trx_hash_t>>>
 ITransactionPacketHandler::transactionsToSendToPeer(std::shared_ptr<TaraxaPeer> peer,
                                                     const std::vector<SharedTransactions> &transactions,
@@ -16,6 +16,8 @@ IVotePacketHandler::IVotePacketHandler(const FullNodeConfig &conf, std::shared_p
 
 void IVotePacketHandler::onNewPbftVote(const std::shared_ptr<PbftVote> &vote, const std::shared_ptr<PbftBlock> &block,
                                        bool rebroadcast) {
+  // Vote packet is the same for all peers that do (not) know the block, so each is encoded and compressed only once
+  std::vector<std::shared_ptr<TaraxaPeer>> peers_with_block, peers_without_block;
   for (const auto &peer : peers_state_->getAllPeers()) {
     if (peer.second->syncing_) {
       LOG(log_dg_) << " PBFT vote " << vote->getHash() << " not sent to " << peer.first << " peer syncing";
@@ -27,16 +29,21 @@ void IVotePacketHandler::onNewPbftVote(const std::shared_ptr<PbftVote> &vote, co
     }
 
     // Send also block in case it is not known for the pear or rebroadcast == true
-    if (rebroadcast || !peer.second->isPbftBlockKnown(vote->getBlockHash())) {
-      sendPbftVote(peer.second, vote, block);
+    if (block && (rebroadcast || !peer.second->isPbftBlockKnown(vote->getBlockHash()))) {
+      peers_with_block.push_back(peer.second);
     } else {
-      sendPbftVote(peer.second, vote, nullptr);
+      peers_without_block.push_back(peer.second);
     }
   }
+
+  broadcastPbftVote(peers_with_block, vote, block);
+  broadcastPbftVote(peers_without_block, vote, nullptr);
 }
 
 void IVotePacketHandler::onNewPbftVotesBundle(const std::vector<std::shared_ptr<PbftVote>> &votes, bool rebroadcast,
                                               const std::optional<dev::p2p::NodeID> &exclude_node) {
+  // Peers that do not know the same votes share the same packets
+  std::vector<std::pair<std::vector<std::shared_ptr<PbftVote>>, std::vector<std::shared_ptr<TaraxaPeer>>>> groups;
   for (const auto &peer : peers_state_->getAllPeers()) {
     if (peer.second->syncing_) {
       continue;
@@ -55,12 +62,41 @@ void IVotePacketHandler::onNewPbftVotesBundle(const std::vector<std::shared_ptr<
       peer_votes.push_back(vote);
     }
 
-    sendPbftVotesBundle(peer.second, std::move(peer_votes));
+    if (peer_votes.empty()) {
+      continue;
+    }
+
+    if (auto group = std::find_if(groups.begin(), groups.end(),
+                                  [&peer_votes](const auto &group) { return group.first == peer_votes; });
+        group != groups.end()) {
+      group->second.push_back(peer.second);
+    } else {
+      groups.emplace_back(std::move(peer_votes), std::vector<std::shared_ptr<TaraxaPeer>>{peer.second});
+    }
+  }
+
+  for (auto &group : groups) {
+    broadcastPbftVotesBundle(group.second, std::move(group.first));
   }
 }
 
 void IVotePacketHandler::sendPbftVote(const std::shared_ptr<TaraxaPeer> &peer, const std::shared_ptr<PbftVote> &vote,
                                       const std::shared_ptr<PbftBlock> &block) {
+  broadcastPbftVote({peer}, vote, block);
+}
+
+void IVotePacketHandler::sendPbftVotesBundle(const std::shared_ptr<TaraxaPeer> &peer,
+                                             std::vector<std::shared_ptr<PbftVote>> &&votes) {
+  broadcastPbftVotesBundle({peer}, std::move(votes));
+}
+
+void IVotePacketHandler::broadcastPbftVote(const std::vector<std::shared_ptr<TaraxaPeer>> &peers,
+                                           const std::shared_ptr<PbftVote> &vote,
+                                           const std::shared_ptr<PbftBlock> &block) {
+  if (peers.empty()) {
+    return;
+  }
+
   if (block && block->getBlockHash() != vote->getBlockHash()) {
     LOG(log_er_) << "Vote " << vote->getHash().abridged() << " voted block " << vote->getBlockHash().abridged()
                  << " != actual block " << block->getBlockHash().abridged();
@@ -72,8 +108,8 @@ void IVotePacketHandler::sendPbftVote(const std::shared_ptr<TaraxaPeer> &peer, c
     optional_packet_data = VotePacket::OptionalData{block, pbft_chain_->getPbftChainSize()};
   }
 
-  if (sealAndSend(peer->getId(), SubprotocolPacketType::kVotePacket,
-                  encodePacketRlp(VotePacket(vote, std::move(optional_packet_data))))) {
+  for (const auto &peer : sealAndBroadcast(peers, SubprotocolPacketType::kVotePacket,
+                                           encodePacketRlp(VotePacket(vote, std::move(optional_packet_data))))) {
     peer->markPbftVoteAsKnown(vote->getHash());
     if (block) {
       peer->markPbftBlockAsKnown(block->getBlockHash());
@@ -85,15 +121,16 @@ void IVotePacketHandler::sendPbftVote(const std::shared_ptr<TaraxaPeer> &peer, c
   }
 }
 
-void IVotePacketHandler::sendPbftVotesBundle(const std::shared_ptr<TaraxaPeer> &peer,
-                                             std::vector<std::shared_ptr<PbftVote>> &&votes) {
-  if (votes.empty()) {
+void IVotePacketHandler::broadcastPbftVotesBundle(const std::vector<std::shared_ptr<TaraxaPeer>> &peers,
+                                                  std::vector<std::shared_ptr<PbftVote>> &&votes) {
+  if (votes.empty() || peers.empty()) {
     return;
   }
 
-  auto sendVotes = [this, &peer](std::vector<std::shared_ptr<PbftVote>> &&votes) {
+  auto sendVotes = [this, &peers](std::vector<std::shared_ptr<PbftVote>> &&votes) {
     auto packet = VotesBundlePacket{OptimizedPbftVotesBundle{.votes = std::move(votes)}};
-    if (this->sealAndSend(peer->getId(), SubprotocolPacketType::kVotesBundlePacket, encodePacketRlp(packet))) {
+    for (const auto &peer :
+         this->sealAndBroadcast(peers, SubprotocolPacketType::kVotesBundlePacket, encodePacketRlp(packet))) {
       LOG(this->log_dg_) << " Votes bundle with " << packet.votes_bundle.votes.size() << " votes sent to "
                          << peer->getId();
       for (const auto &vote : packet.votes_bundle.votes) {
@@ -35,4 +35,35 @@ bool ExtPillarVotePacketHandler::processPillarVote(const std::shared_ptr<PillarV
   return true;
 }
 
+size_t ExtPillarVotePacketHandler::processPillarVotesBundle(const std::vector<std::shared_ptr<PillarVote>> &votes,
+                                                            const std::shared_ptr<TaraxaPeer> &peer) {
+  std::vector<std::shared_ptr<PillarVote>> relevant_votes;
+  relevant_votes.reserve(votes.size());
+  for (const auto &vote : votes) {
+    if (!pillar_chain_manager_->isRelevantPillarVote(vote)) {
+      LOG(this->log_dg_) << "Drop irrelevant pillar vote " << vote->getHash() << ", period " << vote->getPeriod()
+                         << " from peer " << peer->getId();
+      continue;
+    }
+    relevant_votes.push_back(vote);
+  }
+
+  const auto votes_valid = pillar_chain_manager_->validatePillarVotes(relevant_votes);
+  std::vector<std::shared_ptr<PillarVote>> valid_votes;
+  valid_votes.reserve(relevant_votes.size());
+  for (size_t i = 0; i < relevant_votes.size(); ++i) {
+    if (votes_valid[i]) {
+      valid_votes.push_back(relevant_votes[i]);
+    }
+  }
+
+  pillar_chain_manager_->addVerifiedPillarVotes(valid_votes);
+
+  // Mark pillar votes as known for peer
+  for (const auto &vote : valid_votes) {
+    peer->markPillarVoteAsKnown(vote->getHash());
+  }
+  return valid_votes.size();
+}
+
 }  // namespace taraxa::network::tarcap
@@ -31,6 +31,94 @@ bool ExtVotesPacketHandler::processVote(const std::shared_ptr<PbftVote> &vote,
     throw MaliciousPeerException("Received vote's voted value != received pbft block");
   }
 
+  if (!preValidateVote(vote, peer, validate_max_round_step)) {
+    return false;
+  }
+
+  // Validate vote's signature, vrf, etc...
+  if (const auto vote_valid = vote_mgr_->validateVote(vote); !vote_valid.first) {
+    LOG(this->log_wr_) << "Vote " << vote->getHash() << " validation failed. Err: " << vote_valid.second;
+    return false;
+  }
+
+  if (!vote_mgr_->addVerifiedVote(vote)) {
+    LOG(this->log_dg_) << "Vote " << vote->getHash() << " already inserted in verified queue(race condition)";
+    return false;
+  }
+
+  if (pbft_block) {
+    pbft_mgr_->processProposedBlock(pbft_block);
+  }
+
+  return true;
+}
+
+size_t ExtVotesPacketHandler::processVotesBundle(const std::vector<std::shared_ptr<PbftVote>> &votes,
+                                                 const std::shared_ptr<TaraxaPeer> &peer,
+                                                 bool validate_max_round_step) {
+  std::vector<std::shared_ptr<PbftVote>> received_votes;
+  received_votes.reserve(votes.size());
+  for (const auto &vote : votes) {
+    peer->markPbftVoteAsKnown(vote->getHash());
+
+    // Do not process vote that has already been validated
+    if (vote_mgr_->voteAlreadyValidated(vote->getHash())) {
+      LOG(log_dg_) << "Received vote " << vote->getHash() << " has already been validated";
+      continue;
+    }
+    received_votes.push_back(vote);
+  }
+
+  // Voters are needed by pre-validation already, recover them from signatures in parallel
+  vote_mgr_->recoverVoters(received_votes);
+
+  std::vector<std::shared_ptr<PbftVote>> votes_to_validate;
+  votes_to_validate.reserve(received_votes.size());
+  for (const auto &vote : received_votes) {
+    LOG(log_dg_) << "Received vote " << vote->getHash().abridged() << ", period " << vote->getPeriod() << ", round "
+                 << vote->getRound() << ", step " << vote->getStep() << ", voter " << vote->getVoterAddr()
+                 << " as part of votes bundle";
+
+    if (preValidateVote(vote, peer, validate_max_round_step)) {
+      votes_to_validate.push_back(vote);
+    }
+  }
+
+  // Validate votes signatures, vrf, etc... in batch
+  const auto validation_results = vote_mgr_->validateVotes(votes_to_validate);
+
+  size_t processed_votes_count = 0;
+  for (size_t i = 0; i < votes_to_validate.size(); i++) {
+    const auto &vote = votes_to_validate[i];
+    if (!validation_results[i].has_value()) {
+      LOG(log_dg_) << "Received vote " << vote->getHash() << " has already been validated";
+      continue;
+    }
+
+    if (!validation_results[i]->first) {
+      LOG(this->log_wr_) << "Vote " << vote->getHash() << " validation failed. Err: " << validation_results[i]->second;
+      continue;
+    }
+
+    // Bundle might contain double votes that were not in verified votes yet when pre-validated
+    if (auto vote_valid = vote_mgr_->isUniqueVote(vote); !vote_valid.first) {
+      slashing_manager_->submitDoubleVotingProof(vote, vote_valid.second);
+      throw MaliciousPeerException("Received double vote", vote->getVoter());
+    }
+
+    if (!vote_mgr_->addVerifiedVote(vote)) {
+      LOG(this->log_dg_) << "Vote " << vote->getHash() << " already inserted in verified queue(race condition)";
+      continue;
+    }
+
+    processed_votes_count++;
+  }
+
+  return processed_votes_count;
+}
+
+bool ExtVotesPacketHandler::preValidateVote(const std::shared_ptr<PbftVote> &vote,
+                                            const std::shared_ptr<TaraxaPeer> &peer, bool validate_max_round_step) {
   if (vote_mgr_->voteInVerifiedMap(vote)) {
     LOG(this->log_dg_) << "Vote " << vote->getHash() << " already inserted in verified queue";
     return false;
@@ -51,21 +139,6 @@ bool ExtVotesPacketHandler::processVote(const std::shared_ptr<PbftVote> &vote,
     throw MaliciousPeerException("Received double vote", vote->getVoter());
   }
 
-  // Validate vote's signature, vrf, etc...
-  if (const auto vote_valid = vote_mgr_->validateVote(vote); !vote_valid.first) {
-    LOG(this->log_wr_) << "Vote " << vote->getHash() << " validation failed. Err: " << vote_valid.second;
-    return false;
-  }
-
-  if (!vote_mgr_->addVerifiedVote(vote)) {
-    LOG(this->log_dg_) << "Vote " << vote->getHash() << " already inserted in verified queue(race condition)";
-    return false;
-  }
-
-  if (pbft_block) {
-    pbft_mgr_->processProposedBlock(pbft_block);
-  }
-
   return true;
 }
 
@@ -112,6 +112,52 @@ bool PacketHandler::sealAndSend(const dev::p2p::NodeID& node_id, SubprotocolPack
   return true;
 }
 
+std::vector<std::shared_ptr<TaraxaPeer>> PacketHandler::sealAndBroadcast(
+    const std::vector<std::shared_ptr<TaraxaPeer>>& peers, SubprotocolPacketType packet_type, dev::bytes&& rlp_bytes) {
+  std::vector<std::shared_ptr<TaraxaPeer>> receivers;
+  auto host = peers_state_->host_.lock();
+  if (!host) {
+    LOG(log_er_) << "sealAndBroadcast failed to obtain host";
+    return receivers;
+  }
+
+  std::vector<dev::p2p::NodeID> receivers_ids;
+  receivers.reserve(peers.size());
+  receivers_ids.reserve(peers.size());
+  for (const auto& peer : peers) {
+    const auto sender = peers_state_->getPacketSenderPeer(peer->getId(), packet_type);
+    if (!sender.first) [[unlikely]] {
+      LOG(log_wr_) << "Unable to send packet. Reason: " << sender.second;
+      host->disconnect(peer->getId(), dev::p2p::UserReason);
+      continue;
+    }
+    receivers.push_back(peer);
+    receivers_ids.push_back(peer->getId());
+  }
+  if (receivers.empty()) {
+    return receivers;
+  }
+
+  const auto begin = std::chrono::steady_clock::now();
+  const size_t packet_size = rlp_bytes.size();
+
+  host->broadcast(std::move(receivers_ids), TARAXA_CAPABILITY_NAME, packet_type, std::move(rlp_bytes),
+                  [begin, packet_size, packet_type, this](const dev::p2p::NodeID& node_id) {
+                    if (!kConf.network.ddos_protection.log_packets_stats) {
+                      return;
+                    }
+
+                    PacketStats packet_stats{
+                        1 /* count */, packet_size,
+                        std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - begin),
+                        std::chrono::microseconds{0}};
+
+                    packets_stats_->addSentPacket(convertPacketTypeToString(packet_type), node_id, packet_stats);
+                  });
+
+  return receivers;
+}
+
 void PacketHandler::disconnect(const dev::p2p::NodeID& node_id, dev::p2p::DisconnectReason reason) {
   if (auto host = peers_state_->host_.lock(); host) {
     LOG(log_nf_) << "Disconnect node " << node_id.abridged();
@@ -53,17 +53,39 @@ void DagBlockPacketHandler::process(const threadpool::PacketData &packet_data,
 void DagBlockPacketHandler::sendBlockWithTransactions(const std::shared_ptr<TaraxaPeer> &peer,
                                                       const std::shared_ptr<DagBlock> &block,
                                                       SharedTransactions &&trxs) {
-  // This lock prevents race condition between syncing and gossiping dag blocks
-  std::unique_lock lock(peer->mutex_for_sending_dag_blocks_);
+  broadcastBlockWithTransactions({peer}, block, std::move(trxs));
+}
 
-  DagBlockPacket dag_block_packet{.transactions = std::move(trxs), .dag_block = block};
-  if (!sealAndSend(peer->getId(), SubprotocolPacketType::kDagBlockPacket, encodePacketRlp(dag_block_packet))) {
-    LOG(log_wr_) << "Sending DagBlock " << block->getHash() << " failed to " << peer->getId();
+void DagBlockPacketHandler::broadcastBlockWithTransactions(const std::vector<std::shared_ptr<TaraxaPeer>> &peers,
+                                                           const std::shared_ptr<DagBlock> &block,
+                                                           SharedTransactions &&trxs) {
+  if (peers.empty()) {
     return;
   }
 
+  // This lock prevents race condition between syncing and gossiping dag blocks. Peers are locked always in the same
+  // order so concurrent broadcasts cannot deadlock
+  auto sorted_peers = peers;
+  std::sort(sorted_peers.begin(), sorted_peers.end(),
+            [](const auto &a, const auto &b) { return a->getId() < b->getId(); });
+  std::vector<std::unique_lock<boost::shared_mutex>> locks;
+  locks.reserve(sorted_peers.size());
+  for (const auto &peer : sorted_peers) {
+    locks.emplace_back(peer->mutex_for_sending_dag_blocks_);
+  }
+
+  DagBlockPacket dag_block_packet{.transactions = std::move(trxs), .dag_block = block};
+  const auto receivers =
+      sealAndBroadcast(sorted_peers, SubprotocolPacketType::kDagBlockPacket, encodePacketRlp(dag_block_packet));
+  if (receivers.size() != sorted_peers.size()) {
+    LOG(log_wr_) << "Sending DagBlock " << block->getHash() << " failed to " << sorted_peers.size() - receivers.size()
+                 << " peers";
+  }
+
   // Mark data as known if sending was successful
-  peer->markDagBlockAsKnown(block->getHash());
+  for (const auto &peer : receivers) {
+    peer->markDagBlockAsKnown(block->getHash());
+  }
 }
 
 void DagBlockPacketHandler::onNewBlockReceived(
@@ -29,24 +29,14 @@ void PbftSyncPacketHandler::process(const threadpool::PacketData &packet_data,
 
   // Note: no need to consider possible race conditions due to concurrent processing as it is
   // disabled on priority_queue blocking dependencies level
-  const auto syncing_peer = pbft_syncing_state_->syncingPeer();
-  if (!syncing_peer) {
-    LOG(log_wr_) << "PbftSyncPacket received from unexpected peer " << peer->getId().abridged()
-                 << " but there is no current syncing peer set";
-    return;
-  }
-
-  if (syncing_peer->getId() != peer->getId()) {
-    LOG(log_wr_) << "PbftSyncPacket received from unexpected peer " << peer->getId().abridged()
-                 << " current syncing peer " << syncing_peer->getId().abridged();
+  const auto pbft_block_period = packet.period_data.pbft_blk->getPeriod();
+  auto &sync_requests = pbft_syncing_state_->syncRequests();
+  if (!sync_requests.onPacket(peer->getId(), pbft_block_period, packet.last_block)) {
+    LOG(log_wr_) << "PbftSyncPacket with period " << pbft_block_period << " received from unexpected peer "
+                 << peer->getId().abridged();
     return;
   }
 
-  // Process received pbft blocks
-  // pbft_chain_synced is the flag to indicate own PBFT chain has synced with the peer's PBFT chain
-  const bool pbft_chain_synced = packet.current_block_cert_votes_bundle.has_value();
-  const auto pbft_blk_hash = packet.period_data.pbft_blk->getBlockHash();
-
   std::string received_dag_blocks_str;  // This is just log related stuff
   for (auto const &block : packet.period_data.dag_blocks) {
     received_dag_blocks_str += block->getHash().toString() + " ";
@@ -55,155 +45,185 @@ void PbftSyncPacketHandler::process(const threadpool::PacketData &packet_data,
     }
   }
 
-  const auto pbft_block_period = packet.period_data.pbft_blk->getPeriod();
   LOG(log_dg_) << "PbftSyncPacket received. Period: " << pbft_block_period
                << ", dag Blocks: " << received_dag_blocks_str << " from " << peer->getId();
 
-  peer->markPbftBlockAsKnown(pbft_blk_hash);
+  peer->markPbftBlockAsKnown(packet.period_data.pbft_blk->getBlockHash());
   // Update peer's pbft period if outdated
   if (peer->pbft_chain_size_ < pbft_block_period) {
     peer->pbft_chain_size_ = pbft_block_period;
   }
 
-  LOG(log_tr_) << "Processing pbft block: " << pbft_blk_hash;
+  // Reset last sync packet received time
+  pbft_syncing_state_->setLastSyncPacketTime();
 
-  if (pbft_chain_->findPbftBlockInChain(pbft_blk_hash)) {
-    LOG(log_wr_) << "PBFT block " << pbft_blk_hash << ", period: " << packet.period_data.pbft_blk->getPeriod()
-                 << " from " << peer->getId() << " already present in chain";
+  if (pbft_block_period > pbft_mgr_->pbftSyncingPeriod() + 1) {
+    // Chunks are requested from multiple peers concurrently, period data must be still pushed into the queue in order
+    LOG(log_tr_) << "Buffering PBFT block period " << pbft_block_period << ", expected period "
+                 << pbft_mgr_->pbftSyncingPeriod() + 1;
+    if (!sync_requests.bufferPacket(std::move(packet), peer)) {
+      LOG(log_dg_) << "PBFT block period " << pbft_block_period << " already buffered";
+    }
   } else {
-    if (pbft_block_period != pbft_mgr_->pbftSyncingPeriod() + 1) {
-      // This can happen if we just got synced and block was cert voted
-      if (pbft_chain_synced && pbft_block_period == pbft_mgr_->pbftSyncingPeriod()) {
-        pbftSyncComplete();
+    std::optional<std::pair<PbftSyncPacket, std::shared_ptr<TaraxaPeer>>> next_packet(std::in_place, std::move(packet),
+                                                                                      peer);
+    while (next_packet.has_value()) {
+      if (processSyncedPeriod(next_packet->first, next_packet->second) == SyncedPeriodStatus::kSyncStopped) {
         return;
       }
-
-      LOG(log_er_) << "Block " << pbft_blk_hash << " period unexpected: " << pbft_block_period
-                   << ". Expected period: " << pbft_mgr_->pbftSyncingPeriod() + 1;
-      return;
+      next_packet = sync_requests.popBufferedPacket(pbft_mgr_->pbftSyncingPeriod() + 1);
     }
+  }
+
+  continueSyncing();
+}
+
+PbftSyncPacketHandler::SyncedPeriodStatus PbftSyncPacketHandler::processSyncedPeriod(
+    PbftSyncPacket &packet, const std::shared_ptr<TaraxaPeer> &peer) {
+  // Process received pbft blocks
+  // pbft_chain_synced is the flag to indicate own PBFT chain has synced with the peer's PBFT chain
+  const bool pbft_chain_synced = packet.current_block_cert_votes_bundle.has_value();
+  const auto pbft_blk_hash = packet.period_data.pbft_blk->getBlockHash();
+  const auto pbft_block_period = packet.period_data.pbft_blk->getPeriod();
 
-    // Check cert vote matches if final synced block
+  const auto invalid_period_data = [this, &peer, pbft_block_period]() {
+    peers_state_->handleMaliciousSyncPeer(peer->getId());
+    pbft_syncing_state_->syncRequests().dropPeer(peer->getId(), pbft_block_period);
+    return SyncedPeriodStatus::kInvalid;
+  };
+
+  LOG(log_tr_) << "Processing pbft block: " << pbft_blk_hash;
+
+  if (pbft_chain_->findPbftBlockInChain(pbft_blk_hash)) {
+    LOG(log_wr_) << "PBFT block " << pbft_blk_hash << ", period: " << pbft_block_period << " from " << peer->getId()
+                 << " already present in chain";
     if (pbft_chain_synced) {
-      for (auto const &vote : packet.current_block_cert_votes_bundle->votes) {
-        if (vote->getBlockHash() != pbft_blk_hash) {
-          LOG(log_er_) << "Invalid cert votes block hash " << vote->getBlockHash() << " instead of " << pbft_blk_hash
-                       << " from peer " << peer->getId().abridged() << " received, stop syncing.";
-          peers_state_->handleMaliciousSyncPeer(peer->getId());
-          return;
-        }
-      }
+      pbftSyncComplete();
+      return SyncedPeriodStatus::kSyncStopped;
     }
+    return SyncedPeriodStatus::kProcessed;
+  }
 
-    // Check votes match the hash of previous block in the queue
-    auto last_pbft_block_hash = pbft_mgr_->lastPbftBlockHashFromQueueOrChain();
-    // Check cert vote matches
-    for (auto const &vote : packet.period_data.previous_block_cert_votes) {
-      if (vote->getBlockHash() != last_pbft_block_hash) {
-        LOG(log_er_) << "Invalid cert votes block hash " << vote->getBlockHash() << " instead of "
-                     << last_pbft_block_hash << " from peer " << peer->getId().abridged() << " received, stop syncing.";
-        peers_state_->handleMaliciousSyncPeer(peer->getId());
-        return;
+  if (pbft_block_period != pbft_mgr_->pbftSyncingPeriod() + 1) {
+    // This can happen if we just got synced and block was cert voted
+    if (pbft_chain_synced && pbft_block_period == pbft_mgr_->pbftSyncingPeriod()) {
+      pbftSyncComplete();
+      return SyncedPeriodStatus::kSyncStopped;
+    }
+
+    // Period was already synced from another peer or pushed by consensus meanwhile
+    LOG(log_dg_) << "Block " << pbft_blk_hash << " period unexpected: " << pbft_block_period
+                 << ". Expected period: " << pbft_mgr_->pbftSyncingPeriod() + 1;
+    return SyncedPeriodStatus::kProcessed;
+  }
+
+  // Check cert vote matches if final synced block
+  if (pbft_chain_synced) {
+    for (auto const &vote : packet.current_block_cert_votes_bundle->votes) {
+      if (vote->getBlockHash() != pbft_blk_hash) {
+        LOG(log_er_) << "Invalid cert votes block hash " << vote->getBlockHash() << " instead of " << pbft_blk_hash
+                     << " from peer " << peer->getId().abridged() << " received, stop syncing.";
+        return invalid_period_data();
       }
     }
+  }
 
-    if (!pbft_mgr_->validatePillarDataInPeriodData(packet.period_data)) {
-      peers_state_->handleMaliciousSyncPeer(peer->getId());
-      return;
+  // Check votes match the hash of previous block in the queue
+  auto last_pbft_block_hash = pbft_mgr_->lastPbftBlockHashFromQueueOrChain();
+  // Check cert vote matches
+  for (auto const &vote : packet.period_data.previous_block_cert_votes) {
+    if (vote->getBlockHash() != last_pbft_block_hash) {
+      LOG(log_er_) << "Invalid cert votes block hash " << vote->getBlockHash() << " instead of " << last_pbft_block_hash
+                   << " from peer " << peer->getId().abridged() << " received, stop syncing.";
+      return invalid_period_data();
     }
+  }
 
-    auto order_hash = PbftManager::calculateOrderHash(packet.period_data.dag_blocks);
-    if (order_hash != packet.period_data.pbft_blk->getOrderHash()) {
-      {  // This is just log related stuff
-        std::vector<trx_hash_t> trx_order;
-        trx_order.reserve(packet.period_data.transactions.size());
-        std::vector<blk_hash_t> blk_order;
-        blk_order.reserve(packet.period_data.dag_blocks.size());
-        for (auto t : packet.period_data.transactions) {
-          trx_order.push_back(t->getHash());
-        }
-        for (auto b : packet.period_data.dag_blocks) {
-          blk_order.push_back(b->getHash());
-        }
-        LOG(log_er_) << "Order hash incorrect in period data " << pbft_blk_hash << " expected: " << order_hash
-                     << " received " << packet.period_data.pbft_blk->getOrderHash() << "; Dag order: " << blk_order
-                     << "; Trx order: " << trx_order << "; from " << peer->getId().abridged() << ", stop syncing.";
+  if (!pbft_mgr_->validatePillarDataInPeriodData(packet.period_data)) {
+    return invalid_period_data();
+  }
+
+  auto order_hash = PbftManager::calculateOrderHash(packet.period_data.dag_blocks);
+  if (order_hash != packet.period_data.pbft_blk->getOrderHash()) {
+    {  // This is just log related stuff
+      std::vector<trx_hash_t> trx_order;
+      trx_order.reserve(packet.period_data.transactions.size());
+      std::vector<blk_hash_t> blk_order;
+      blk_order.reserve(packet.period_data.dag_blocks.size());
+      for (auto t : packet.period_data.transactions) {
+        trx_order.push_back(t->getHash());
+      }
+      for (auto b : packet.period_data.dag_blocks) {
+        blk_order.push_back(b->getHash());
       }
-      peers_state_->handleMaliciousSyncPeer(peer->getId());
-      return;
+      LOG(log_er_) << "Order hash incorrect in period data " << pbft_blk_hash << " expected: " << order_hash
+                   << " received " << packet.period_data.pbft_blk->getOrderHash() << "; Dag order: " << blk_order
+                   << "; Trx order: " << trx_order << "; from " << peer->getId().abridged() << ", stop syncing.";
     }
+    return invalid_period_data();
+  }
 
-    // This is special case when queue is empty and we can not say for sure that all votes that are part of this block
-    // have been verified before
-    if (pbft_mgr_->periodDataQueueEmpty()) {
-      for (const auto &v : packet.period_data.previous_block_cert_votes) {
-        if (auto vote_is_valid = vote_mgr_->validateVote(v); vote_is_valid.first == false) {
-          LOG(log_er_) << "Invalid reward votes in block " << packet.period_data.pbft_blk->getBlockHash()
-                       << " from peer " << peer->getId().abridged()
-                       << " received, stop syncing. Validation failed. Err: " << vote_is_valid.second;
-          peers_state_->handleMaliciousSyncPeer(peer->getId());
-          return;
-        }
-
-        vote_mgr_->addVerifiedVote(v);
+  // This is special case when queue is empty and we can not say for sure that all votes that are part of this block
+  // have been verified before
+  if (pbft_mgr_->periodDataQueueEmpty()) {
+    for (const auto &v : packet.period_data.previous_block_cert_votes) {
+      if (auto vote_is_valid = vote_mgr_->validateVote(v); vote_is_valid.first == false) {
+        LOG(log_er_) << "Invalid reward votes in block " << pbft_blk_hash << " from peer " << peer->getId().abridged()
+                     << " received, stop syncing. Validation failed. Err: " << vote_is_valid.second;
+        return invalid_period_data();
       }
 
-      // And now we need to replace it with verified votes
-      if (auto votes = vote_mgr_->checkRewardVotes(packet.period_data.pbft_blk, true); votes.first) {
-        packet.period_data.previous_block_cert_votes = std::move(votes.second);
-      } else {
-        // checkRewardVotes could fail because we just cert voted this block and moved to next period,
-        // in that case we are probably fully synced
-        if (pbft_block_period <= vote_mgr_->getRewardVotesPbftBlockPeriod()) {
-          pbft_syncing_state_->setPbftSyncing(false);
-          return;
-        }
-
-        LOG(log_er_) << "Invalid reward votes in block " << packet.period_data.pbft_blk->getBlockHash() << " from peer "
-                     << peer->getId().abridged() << " received, stop syncing.";
-        peers_state_->handleMaliciousSyncPeer(peer->getId());
-        return;
-      }
+      vote_mgr_->addVerifiedVote(v);
     }
 
-    LOG(log_tr_) << "Synced PBFT block hash " << pbft_blk_hash << " with "
-                 << packet.period_data.previous_block_cert_votes.size() << " cert votes";
-    LOG(log_tr_) << "Synced PBFT block " << packet.period_data;
-    std::vector<std::shared_ptr<PbftVote>> current_block_cert_votes;
-    if (pbft_chain_synced) {
-      current_block_cert_votes = std::move(packet.current_block_cert_votes_bundle->votes);
+    // And now we need to replace it with verified votes
+    if (auto votes = vote_mgr_->checkRewardVotes(packet.period_data.pbft_blk, true); votes.first) {
+      packet.period_data.previous_block_cert_votes = std::move(votes.second);
+    } else {
+      // checkRewardVotes could fail because we just cert voted this block and moved to next period,
+      // in that case we are probably fully synced
+      if (pbft_block_period <= vote_mgr_->getRewardVotesPbftBlockPeriod()) {
+        pbft_syncing_state_->setPbftSyncing(false);
+        return SyncedPeriodStatus::kSyncStopped;
+      }
+
+      LOG(log_er_) << "Invalid reward votes in block " << pbft_blk_hash << " from peer " << peer->getId().abridged()
+                   << " received, stop syncing.";
+      return invalid_period_data();
     }
-    pbft_mgr_->periodDataQueuePush(std::move(packet.period_data), peer->getId(), std::move(current_block_cert_votes));
   }
 
-  auto pbft_sync_period = pbft_mgr_->pbftSyncingPeriod();
-
-  // Reset last sync packet received time
-  pbft_syncing_state_->setLastSyncPacketTime();
+  LOG(log_tr_) << "Synced PBFT block hash " << pbft_blk_hash << " with "
+               << packet.period_data.previous_block_cert_votes.size() << " cert votes";
+  LOG(log_tr_) << "Synced PBFT block " << packet.period_data;
+  std::vector<std::shared_ptr<PbftVote>> current_block_cert_votes;
+  if (pbft_chain_synced) {
+    current_block_cert_votes = std::move(packet.current_block_cert_votes_bundle->votes);
+  }
+  pbft_mgr_->periodDataQueuePush(std::move(packet.period_data), peer->getId(), std::move(current_block_cert_votes));
 
   if (pbft_chain_synced) {
     pbftSyncComplete();
+    return SyncedPeriodStatus::kSyncStopped;
+  }
+  return SyncedPeriodStatus::kProcessed;
+}
+
+void PbftSyncPacketHandler::continueSyncing() {
+  if (!pbft_syncing_state_->isPbftSyncing()) {
     return;
   }
 
-  if (packet.last_block) {
-    // If current sync period is actually bigger than the block we just received we are probably synced
-    if (pbft_sync_period > pbft_block_period) {
-      pbft_syncing_state_->setPbftSyncing(false);
-      return;
-    }
-    if (pbft_syncing_state_->isPbftSyncing()) {
-      if (pbft_sync_period > pbft_chain_->getPbftChainSize() + (10 * kConf.network.sync_level_size)) {
-        LOG(log_tr_) << "Syncing pbft blocks too fast than processing. Has synced period " << pbft_sync_period
-                     << ", PBFT chain size " << pbft_chain_->getPbftChainSize();
-        periodic_events_tp_.post(kDelayedPbftSyncDelayMs, [this] { delayedPbftSync(1); });
-      } else {
-        if (!syncPeerPbft(pbft_sync_period + 1)) {
-          pbft_syncing_state_->setPbftSyncing(false);
-          return;
-        }
-      }
-    }
+  if (!requestPbftSyncChunks()) {
+    pbft_syncing_state_->setPbftSyncing(false);
+    return;
+  }
+
+  // Nothing could be requested as syncing got too far ahead of processing
+  if (!pbft_syncing_state_->syncRequests().pendingRequestsCount() && !delayed_sync_scheduled_.exchange(true)) {
+    LOG(log_tr_) << "Syncing pbft blocks too fast than processing. Has synced period "
+                 << pbft_mgr_->pbftSyncingPeriod() << ", PBFT chain size " << pbft_chain_->getPbftChainSize();
+    periodic_events_tp_.post(kDelayedPbftSyncDelayMs, [this] { delayedPbftSync(1); });
   }
 }
 
@@ -241,22 +261,30 @@ void PbftSyncPacketHandler::delayedPbftSync(uint32_t counter) {
   if (counter > max_delayed_pbft_sync_count) {
     LOG(log_er_) << "Pbft blocks stuck in queue, no new block processed in 60 seconds " << pbft_sync_period << " "
                  << pbft_chain_->getPbftChainSize();
+    delayed_sync_scheduled_ = false;
     pbft_syncing_state_->setPbftSyncing(false);
     LOG(log_tr_) << "Syncing PBFT is stopping";
     return;
   }
 
-  if (pbft_syncing_state_->isPbftSyncing()) {
-    if (pbft_sync_period > pbft_chain_->getPbftChainSize() + (10 * kConf.network.sync_level_size)) {
-      LOG(log_tr_) << "Syncing pbft blocks faster than processing " << pbft_sync_period << " "
-                   << pbft_chain_->getPbftChainSize();
-      periodic_events_tp_.post(kDelayedPbftSyncDelayMs, [this, counter] { delayedPbftSync(counter + 1); });
-    } else {
-      if (!syncPeerPbft(pbft_sync_period + 1)) {
-        pbft_syncing_state_->setPbftSyncing(false);
-      }
-    }
+  if (!pbft_syncing_state_->isPbftSyncing()) {
+    delayed_sync_scheduled_ = false;
+    return;
+  }
+
+  if (!requestPbftSyncChunks()) {
+    delayed_sync_scheduled_ = false;
+    pbft_syncing_state_->setPbftSyncing(false);
+    return;
+  }
+
+  if (!pbft_syncing_state_->syncRequests().pendingRequestsCount()) {
+    LOG(log_tr_) << "Syncing pbft blocks faster than processing " << pbft_sync_period << " "
+                 << pbft_chain_->getPbftChainSize();
+    periodic_events_tp_.post(kDelayedPbftSyncDelayMs, [this, counter] { delayedPbftSync(counter + 1); });
+    return;
   }
+  delayed_sync_scheduled_ = false;
 }
 
 }  // namespace taraxa::network::tarcap
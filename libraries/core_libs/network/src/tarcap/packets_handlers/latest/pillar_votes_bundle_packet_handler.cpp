@@ -33,9 +33,9 @@ void PillarVotesBundlePacketHandler::process(const threadpool::PacketData &packe
               << " < ficus hardfork block num";
       throw MaliciousPeerException(err_msg.str());
     }
-
-    processPillarVote(pillar_vote, peer);
   }
+
+  processPillarVotesBundle(packet.pillar_votes_bundle.pillar_votes, peer);
 }
 
 }  // namespace taraxa::network::tarcap
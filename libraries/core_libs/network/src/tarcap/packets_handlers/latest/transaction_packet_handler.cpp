@@ -35,7 +35,8 @@ inline void TransactionPacketHandler::process(const threadpool::PacketData &pack
     peer->markTransactionAsKnown(extra_tx_hash);
   }
 
-  size_t unseen_txs_count = 0;
+  SharedTransactions unseen_transactions;
+  unseen_transactions.reserve(packet.transactions.size());
   // size_t data_size = 0;
   for (auto &transaction : packet.transactions) {
     const auto tx_hash = transaction->getHash();
@@ -47,8 +48,15 @@ inline void TransactionPacketHandler::process(const threadpool::PacketData &pack
       continue;
     }
 
-    unseen_txs_count++;
+    unseen_transactions.push_back(std::move(transaction));
+  }
+  const auto unseen_txs_count = unseen_transactions.size();
+
+  // Recover senders of the whole packet in parallel before transactions are verified and inserted one by one
+  trx_mgr_->recoverSenders(unseen_transactions);
 
+  for (auto &transaction : unseen_transactions) {
+    const auto tx_hash = transaction->getHash();
     const auto [verified, reason] = trx_mgr_->verifyTransaction(transaction);
     if (!verified) {
       std::ostringstream err_msg;
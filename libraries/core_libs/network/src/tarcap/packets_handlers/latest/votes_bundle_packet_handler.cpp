@@ -56,26 +56,7 @@ void VotesBundlePacketHandler::process(const threadpool::PacketData &packet_data
     check_max_round_step = false;
   }
 
-  size_t processed_votes_count = 0;
-  for (const auto &vote : packet.votes_bundle.votes) {
-    peer->markPbftVoteAsKnown(vote->getHash());
-
-    // Do not process vote that has already been validated
-    if (vote_mgr_->voteAlreadyValidated(vote->getHash())) {
-      LOG(log_dg_) << "Received vote " << vote->getHash() << " has already been validated";
-      continue;
-    }
-
-    LOG(log_dg_) << "Received vote " << vote->getHash().abridged() << ", period " << vote->getPeriod() << ", round "
-                 << vote->getRound() << ", step " << vote->getStep() << ", voter " << vote->getVoterAddr()
-                 << " as part of votes bundle";
-
-    if (!processVote(vote, nullptr, peer, check_max_round_step)) {
-      continue;
-    }
-
-    processed_votes_count++;
-  }
+  const auto processed_votes_count = processVotesBundle(packet.votes_bundle.votes, peer, check_max_round_step);
 
   LOG(log_nf_) << "Received " << packet.votes_bundle.votes.size() << " (processed " << processed_votes_count
                << " ) sync votes from peer " << peer->getId() << ". Votes period " << reference_vote->getPeriod()
@@ -0,0 +1,212 @@
+#include "network/tarcap/shared_states/pbft_sync_requests.hpp"
+
+#include <algorithm>
+
+namespace taraxa::network::tarcap {
+
+PbftSyncRequests::PbftSyncRequests(PbftPeriod chunk_size, size_t max_requests,
+                                   std::chrono::milliseconds request_timeout)
+    : kChunkSize(std::max<PbftPeriod>(chunk_size, 1)),
+      kMaxRequests(std::max<size_t>(max_requests, 1)),
+      kRequestTimeout(request_timeout) {}
+
+void PbftSyncRequests::reset(PbftPeriod from) {
+  std::scoped_lock lock(mutex_);
+  next_period_ = from;
+  retry_.clear();
+  requests_.clear();
+  buffer_.clear();
+  // Penalized peers get another chance in the new syncing
+  std::erase_if(scores_, [](const auto& score) { return score.second < 0; });
+}
+
+std::vector<std::pair<std::shared_ptr<TaraxaPeer>, PbftPeriod>> PbftSyncRequests::assignRequests(
+    const std::vector<std::shared_ptr<TaraxaPeer>>& peers, const std::shared_ptr<TaraxaPeer>& main_peer,
+    PbftPeriod synced_period, PbftPeriod max_period) {
+  std::vector<std::pair<std::shared_ptr<TaraxaPeer>, PbftPeriod>> assigned;
+  if (!main_peer) {
+    return assigned;
+  }
+  const PbftPeriod target_period = main_peer->pbft_chain_size_;
+  const auto now = std::chrono::steady_clock::now();
+
+  std::scoped_lock lock(mutex_);
+  // Drop chunks that were already synced meanwhile from other peers or by consensus
+  next_period_ = std::max(next_period_, synced_period + 1);
+  while (!retry_.empty() && *retry_.begin() <= synced_period) {
+    const auto from = *retry_.begin();
+    retry_.erase(retry_.begin());
+    if (from + kChunkSize - 1 > synced_period) {
+      retry_.insert(synced_period + 1);
+    }
+  }
+
+  const auto can_request = [&](const std::shared_ptr<TaraxaPeer>& peer, PbftPeriod from) {
+    const auto to = from + kChunkSize - 1;
+    if (to >= target_period) {
+      return peer->getId() == main_peer->getId();
+    }
+    if (peerScoreUnsafe(peer->getId()) < kMinPeerScore) {
+      return false;
+    }
+    // Peer would consider itself as the last one and send its whole chain
+    if (peer->pbft_chain_size_ <= to) {
+      return false;
+    }
+    // Light node does not have old periods
+    return !peer->peer_light_node || from + peer->peer_light_node_history > peer->pbft_chain_size_;
+  };
+
+  std::vector<std::shared_ptr<TaraxaPeer>> idle_peers;
+  idle_peers.reserve(peers.size());
+  for (const auto& peer : peers) {
+    if (!requests_.contains(peer->getId())) {
+      idle_peers.push_back(peer);
+    }
+  }
+  std::stable_sort(idle_peers.begin(), idle_peers.end(), [this](const auto& a, const auto& b) {
+    return peerScoreUnsafe(a->getId()) > peerScoreUnsafe(b->getId());
+  });
+
+  for (const auto& peer : idle_peers) {
+    if (requests_.size() >= kMaxRequests) {
+      break;
+    }
+
+    std::optional<PbftPeriod> from;
+    if (auto it = std::find_if(retry_.begin(), retry_.end(), [&](auto period) { return can_request(peer, period); });
+        it != retry_.end()) {
+      from = *it;
+      retry_.erase(it);
+    } else if (next_period_ <= std::min(target_period, max_period) && can_request(peer, next_period_)) {
+      from = next_period_;
+      next_period_ += kChunkSize;
+    }
+
+    if (!from.has_value()) {
+      continue;
+    }
+    const auto to = *from + kChunkSize - 1;
+    requests_.emplace(peer->getId(), Request{*from, to, *from - 1, to >= target_period, now + kRequestTimeout});
+    assigned.emplace_back(peer, *from);
+  }
+
+  return assigned;
+}
+
+bool PbftSyncRequests::onPacket(const dev::p2p::NodeID& peer_id, PbftPeriod period, bool last_block) {
+  std::scoped_lock lock(mutex_);
+  auto it = requests_.find(peer_id);
+  if (it == requests_.end() || period < it->second.from || period > it->second.to) {
+    return false;
+  }
+
+  auto& request = it->second;
+  request.received = period;
+  request.deadline = std::chrono::steady_clock::now() + kRequestTimeout;
+  if (last_block || period == request.to) {
+    // Only the last chunk can be shorter as the main peer has no more periods, otherwise the rest is missing
+    if (!request.last_chunk) {
+      retryUnsafe(request);
+    }
+    requests_.erase(it);
+    auto& score = scores_[peer_id];
+    score = std::min(score + 1, kMaxPeerScore);
+  }
+  return true;
+}
+
+size_t PbftSyncRequests::checkTimeouts() {
+  const auto now = std::chrono::steady_clock::now();
+  size_t timed_out = 0;
+
+  std::scoped_lock lock(mutex_);
+  for (auto it = requests_.begin(); it != requests_.end();) {
+    if (it->second.deadline > now) {
+      ++it;
+      continue;
+    }
+    retryUnsafe(it->second);
+    scores_[it->first] -= kTimeoutPenalty;
+    it = requests_.erase(it);
+    ++timed_out;
+  }
+  return timed_out;
+}
+
+void PbftSyncRequests::dropPeer(const dev::p2p::NodeID& peer_id, std::optional<PbftPeriod> from_period) {
+  std::scoped_lock lock(mutex_);
+  if (auto it = requests_.find(peer_id); it != requests_.end()) {
+    retryUnsafe(it->second);
+    requests_.erase(it);
+  }
+  if (from_period.has_value()) {
+    retry_.insert(*from_period);
+  }
+
+  // Each continuous range of dropped packets is requested again
+  std::optional<PbftPeriod> last_dropped;
+  for (auto it = buffer_.begin(); it != buffer_.end();) {
+    if (it->second.second->getId() != peer_id) {
+      ++it;
+      continue;
+    }
+    if (!last_dropped.has_value() || *last_dropped + 1 != it->first) {
+      retry_.insert(it->first);
+    }
+    last_dropped = it->first;
+    it = buffer_.erase(it);
+  }
+}
+
+bool PbftSyncRequests::bufferPacket(PbftSyncPacket&& packet, const std::shared_ptr<TaraxaPeer>& peer) {
+  const auto period = packet.period_data.pbft_blk->getPeriod();
+  std::scoped_lock lock(mutex_);
+  return buffer_.try_emplace(period, std::move(packet), peer).second;
+}
+
+std::optional<std::pair<PbftSyncPacket, std::shared_ptr<TaraxaPeer>>> PbftSyncRequests::popBufferedPacket(
+    PbftPeriod period) {
+  std::scoped_lock lock(mutex_);
+  buffer_.erase(buffer_.begin(), buffer_.lower_bound(period));
+  auto node = buffer_.extract(period);
+  if (node.empty()) {
+    return {};
+  }
+  return std::move(node.mapped());
+}
+
+bool PbftSyncRequests::finished(PbftPeriod target_period) const {
+  std::scoped_lock lock(mutex_);
+  return requests_.empty() && retry_.empty() && buffer_.empty() && next_period_ > target_period;
+}
+
+size_t PbftSyncRequests::pendingRequestsCount() const {
+  std::scoped_lock lock(mutex_);
+  return requests_.size();
+}
+
+size_t PbftSyncRequests::bufferedPacketsCount() const {
+  std::scoped_lock lock(mutex_);
+  return buffer_.size();
+}
+
+int32_t PbftSyncRequests::peerScore(const dev::p2p::NodeID& peer_id) const {
+  std::scoped_lock lock(mutex_);
+  return peerScoreUnsafe(peer_id);
+}
+
+void PbftSyncRequests::retryUnsafe(const Request& request) {
+  if (request.received < request.to) {
+    retry_.insert(request.received + 1);
+  }
+}
+
+int32_t PbftSyncRequests::peerScoreUnsafe(const dev::p2p::NodeID& peer_id) const {
+  if (auto it = scores_.find(peer_id); it != scores_.end()) {
+    return it->second;
+  }
+  return 0;
+}
+
+}  // namespace taraxa::network::tarcap
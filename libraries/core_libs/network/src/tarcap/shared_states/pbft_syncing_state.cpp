@@ -5,7 +5,10 @@
 
 namespace taraxa::network::tarcap {
 
-PbftSyncingState::PbftSyncingState(uint16_t deep_syncing_threshold) : kDeepSyncingThreshold(deep_syncing_threshold) {}
+PbftSyncingState::PbftSyncingState(uint16_t deep_syncing_threshold, PbftPeriod sync_level_size, size_t sync_max_peers,
+                                   std::chrono::milliseconds sync_request_timeout)
+    : kDeepSyncingThreshold(deep_syncing_threshold),
+      sync_requests_(sync_level_size, sync_max_peers, sync_request_timeout) {}
 
 std::shared_ptr<TaraxaPeer> PbftSyncingState::syncingPeer() const {
   std::shared_lock lock(peer_mutex_);
@@ -48,8 +51,10 @@ bool PbftSyncingState::setPbftSyncing(bool syncing, PbftPeriod current_period,
       deep_pbft_syncing_ = (peer_->pbft_chain_size_ - current_period >= kDeepSyncingThreshold);
       // Reset last sync packet time when syncing is restarted/fresh syncing flag is set
       setLastSyncPacketTime();
+      sync_requests_.reset(current_period + 1);
     } else {
       deep_pbft_syncing_ = false;
+      sync_requests_.reset(0);
     }
     return true;
   }
@@ -69,6 +74,8 @@ bool PbftSyncingState::isActivelySyncing() const {
 
 bool PbftSyncingState::isDeepPbftSyncing() const { return deep_pbft_syncing_; }
 
+PbftSyncRequests& PbftSyncingState::syncRequests() { return sync_requests_; }
+
 bool PbftSyncingState::isPbftSyncing() {
   if (!isActivelySyncing()) {
     setPbftSyncing(false);
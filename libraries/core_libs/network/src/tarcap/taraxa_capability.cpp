@@ -98,6 +98,8 @@ void TaraxaCapability::onConnect(std::weak_ptr<dev::p2p::Session> session, u256
 void TaraxaCapability::onDisconnect(dev::p2p::NodeID const &_nodeID) {
   LOG(log_nf_) << "Node " << _nodeID << " disconnected";
   peers_state_->erasePeer(_nodeID);
+  // Chunks requested from the peer are requested again from other peers
+  pbft_syncing_state_->syncRequests().dropPeer(_nodeID);
 
   const auto syncing_peer = pbft_syncing_state_->syncingPeer();
   if (pbft_syncing_state_->isPbftSyncing() && syncing_peer && syncing_peer->getId() == _nodeID) {
@@ -2,6 +2,10 @@
 
 namespace taraxa::network::threadpool {
 
+PacketsQueue::~PacketsQueue() {
+  non_blocking_packets_.consume_all([](auto packet) { delete packet; });
+}
+
 bool PacketsQueue::maxWorkersCountReached() const {
   if (act_workers_count_ >= kMaxWorkersCount_) {
     return true;
@@ -12,7 +16,20 @@ bool PacketsQueue::maxWorkersCountReached() const {
 
 void PacketsQueue::pushBack(std::pair<tarcap::TarcapVersion, PacketData>&& packet) {
   packets_.push_back(std::move(packet));
+  blocking_packets_count_++;
+  act_packets_count_++;
+}
+
+void PacketsQueue::pushBackNonBlocking(std::pair<tarcap::TarcapVersion, PacketData>&& packet) {
+  auto packet_ptr = new std::pair<tarcap::TarcapVersion, PacketData>(std::move(packet));
+  // Counter is incremented before the push so that concurrent pop never decrements it below zero
   act_packets_count_++;
+  // Queue grows when its initial capacity is exceeded, push can fail only if memory allocation fails
+  if (!non_blocking_packets_.push(packet_ptr)) {
+    act_packets_count_--;
+    delete packet_ptr;
+    throw std::bad_alloc();
+  }
 }
 
 std::optional<std::pair<tarcap::TarcapVersion, PacketData>> PacketsQueue::pop(
@@ -26,7 +43,8 @@ std::optional<std::pair<tarcap::TarcapVersion, PacketData>> PacketsQueue::pop(
     std::optional<std::pair<tarcap::TarcapVersion, PacketData>> ret = std::move(*packet_it);
     packets_.erase(packet_it);
 
-    assert(act_packets_count_);
+    assert(act_packets_count_ && blocking_packets_count_);
+    blocking_packets_count_--;
     act_packets_count_--;
 
     return ret;
@@ -35,9 +53,33 @@ std::optional<std::pair<tarcap::TarcapVersion, PacketData>> PacketsQueue::pop(
   return {};
 }
 
+std::optional<std::pair<tarcap::TarcapVersion, PacketData>> PacketsQueue::popNonBlocking() {
+  std::pair<tarcap::TarcapVersion, PacketData>* packet_ptr = nullptr;
+  if (!non_blocking_packets_.pop(packet_ptr)) {
+    return {};
+  }
+
+  std::unique_ptr<std::pair<tarcap::TarcapVersion, PacketData>> packet(packet_ptr);
+  assert(act_packets_count_);
+  act_packets_count_--;
+
+  return std::move(*packet);
+}
+
+bool PacketsQueue::hasBlockingPackets() const { return blocking_packets_count_ > 0; }
+
 void PacketsQueue::setMaxWorkersCount(size_t max_workers_count) { kMaxWorkersCount_ = max_workers_count; }
 
-void PacketsQueue::incrementActWorkersCount() { act_workers_count_++; }
+bool PacketsQueue::tryIncrementActWorkersCount(bool ignore_max_workers_count) {
+  auto act_workers_count = act_workers_count_.load();
+  do {
+    if (!ignore_max_workers_count && act_workers_count >= kMaxWorkersCount_) {
+      return false;
+    }
+  } while (!act_workers_count_.compare_exchange_weak(act_workers_count, act_workers_count + 1));
+
+  return true;
+}
 
 void PacketsQueue::decrementActWorkersCount() {
   assert(act_workers_count_ > 0);
@@ -35,10 +35,14 @@ PriorityQueue::PriorityQueue(size_t tp_workers_count, const std::shared_ptr<Pbft
 
 void PriorityQueue::pushBack(std::pair<tarcap::TarcapVersion, PacketData>&& packet) {
   const auto priority = packet.second.priority_;
-  packets_queues_[priority].pushBack(std::move(packet));
+  if (isNonBlockingPacket(packet.second.type_)) {
+    packets_queues_[priority].pushBackNonBlocking(std::move(packet));
+  } else {
+    packets_queues_[priority].pushBack(std::move(packet));
+  }
 }
 
-bool PriorityQueue::canBorrowThread() {
+size_t PriorityQueue::reservedThreadsNum() const {
   size_t reserved_threads_num = 0;
 
   for (const auto& queue : packets_queues_) {
@@ -50,12 +54,52 @@ bool PriorityQueue::canBorrowThread() {
     reserved_threads_num++;
   }
 
-  return act_total_workers_count_ < (MAX_TOTAL_WORKERS_COUNT - reserved_threads_num);
+  return reserved_threads_num;
 }
 
-std::optional<std::pair<tarcap::TarcapVersion, PacketData>> PriorityQueue::pop() {
+std::optional<std::pair<tarcap::TarcapVersion, PacketData>> PriorityQueue::popFromQueue(
+    PacketsQueue& queue, std::unique_lock<std::mutex>& queue_lock, bool borrow_thread) {
+  // Workers are reserved with compare-exchange so limits hold without the queue mutex, reservation is released if
+  // there is no packet that could be processed
+  const size_t max_total_workers_count =
+      borrow_thread ? MAX_TOTAL_WORKERS_COUNT - reservedThreadsNum() : MAX_TOTAL_WORKERS_COUNT;
+  auto act_total_workers_count = act_total_workers_count_.load();
+  do {
+    if (act_total_workers_count >= max_total_workers_count) {
+      return {};
+    }
+  } while (!act_total_workers_count_.compare_exchange_weak(act_total_workers_count, act_total_workers_count + 1));
+
+  if (!queue.tryIncrementActWorkersCount(borrow_thread)) {
+    act_total_workers_count_--;
+    return {};
+  }
+
+  if (auto packet = queue.popNonBlocking(); packet.has_value()) {
+    return packet;
+  }
+
+  if (queue.hasBlockingPackets()) {
+    if (!queue_lock.owns_lock()) {
+      queue_lock.lock();
+    }
+
+    if (auto packet = queue.pop(blocked_packets_mask_); packet.has_value()) {
+      updateDependenciesStart(packet->second);
+      return packet;
+    }
+  }
+
+  // All packets in this queue are currently blocked
+  queue.decrementActWorkersCount();
+  act_total_workers_count_--;
+  return {};
+}
+
+std::optional<std::pair<tarcap::TarcapVersion, PacketData>> PriorityQueue::pop(
+    std::unique_lock<std::mutex>& queue_lock) {
   if (act_total_workers_count_ >= MAX_TOTAL_WORKERS_COUNT) {
-    LOG(log_dg_) << "MAX_TOTAL_WORKERS_COUNT(" << MAX_TOTAL_WORKERS_COUNT << ") reached, unable to pop data.";
+    LOG(log_tr_) << "MAX_TOTAL_WORKERS_COUNT(" << MAX_TOTAL_WORKERS_COUNT << ") reached, unable to pop data.";
     return {};
   }
 
@@ -81,32 +125,28 @@ std::optional<std::pair<tarcap::TarcapVersion, PacketData>> PriorityQueue::pop()
       continue;
     }
 
-    if (auto packet = queue.pop(blocked_packets_mask_); packet.has_value()) {
+    if (auto packet = popFromQueue(queue, queue_lock, false); packet.has_value()) {
       return packet;
     }
 
-    // All packets in this queue are currently blocked
+    // All packets in this queue are currently blocked or queue limit was reached meanwhile
+    try_borrow_thread = try_borrow_thread || queue.maxWorkersCountReached();
   }
 
   if (!try_borrow_thread) {
-    LOG(log_dg_) << "No non-blocked packets to be processed.";
+    LOG(log_tr_) << "No non-blocked packets to be processed.";
     return {};
   }
 
-  if (!canBorrowThread()) {
-    LOG(log_dg_) << "No non-blocked packets to be processed + limits reached -> unable to borrow thread due to "
-                    "\"Always keep at least 1 reserved thread for each priority queue \" rule";
-    return {};
-  }
-
-  // Second iteration over priority queues ignoring the max workers limits
+  // Second iteration over priority queues ignoring the max workers limits. Borrowing is possible only if
+  // "Always keep at least 1 reserved thread for each priority queue" rule holds, which is checked in popFromQueue
   for (auto& queue : packets_queues_) {
     if (queue.empty()) {
       continue;
     }
 
-    if (auto packet = queue.pop(blocked_packets_mask_); packet.has_value()) {
-      LOG(log_dg_) << "Thread for packet processing borrowed";
+    if (auto packet = popFromQueue(queue, queue_lock, true); packet.has_value()) {
+      LOG(log_tr_) << "Thread for packet processing borrowed";
       return packet;
     }
 
@@ -114,7 +154,7 @@ std::optional<std::pair<tarcap::TarcapVersion, PacketData>> PriorityQueue::pop()
   }
 
   // There was no unblocked packet to be processed in all queues
-  LOG(log_dg_) << "No non-blocked packets to be processed.";
+  LOG(log_tr_) << "No non-blocked packets to be processed.";
   return {};
 }
 
@@ -122,13 +162,7 @@ bool PriorityQueue::empty() const {
   return std::all_of(packets_queues_.cbegin(), packets_queues_.cend(), [](const auto& queue) { return queue.empty(); });
 }
 
-void PriorityQueue::updateDependenciesStart(const PacketData& packet) {
-  assert(act_total_workers_count_ < MAX_TOTAL_WORKERS_COUNT);
-  act_total_workers_count_++;
-
-  packets_queues_[packet.priority_].incrementActWorkersCount();
-  updateBlockingDependencies(packet);
-}
+void PriorityQueue::updateDependenciesStart(const PacketData& packet) { updateBlockingDependencies(packet); }
 
 void PriorityQueue::updateDependenciesFinish(const PacketData& packet, std::mutex& queue_mutex,
                                              std::condition_variable& cond_var) {
@@ -41,11 +41,27 @@ std::optional<uint64_t> PacketsThreadPool::push(std::pair<tarcap::TarcapVersion,
 
   std::string packet_type_str = packet_data.second.type_str_;
   uint64_t packet_unique_id;
-  {
+  if (queue_.isNonBlockingPacket(packet_data.second.type_)) {
+    // Create packet unique id
+    packet_unique_id = packets_count_++;
+    packet_data.second.id_ = packet_unique_id;
+
+    // Put packet into the priority queue, non-blocking packets do not need queue_mutex_
+    queue_.pushBack(std::move(packet_data));
+
+    // Pairs with the fence in processPacket - either this push sees the waiting worker or the worker sees the packet
+    // when it checks the queue before waiting. Workers check the queue under queue_mutex_ before they start waiting,
+    // so it must be locked to not miss the wake up
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (waiting_workers_count_.load(std::memory_order_seq_cst)) {
+      std::scoped_lock lock(queue_mutex_);
+      cond_var_.notify_one();
+    }
+  } else {
     // Put packet into the priority queue
     std::scoped_lock lock(queue_mutex_);
 
-    // Create packet unique id
+    // Create packet unique id - blocking dependencies rely on ids being assigned in the order packets are queued
     packet_unique_id = packets_count_++;
     packet_data.second.id_ = packet_unique_id;
 
@@ -53,7 +69,7 @@ std::optional<uint64_t> PacketsThreadPool::push(std::pair<tarcap::TarcapVersion,
     cond_var_.notify_one();
   }
 
-  LOG(log_dg_) << "New packet pushed: " << packet_type_str << ", id(" << packet_unique_id << ")";
+  LOG(log_tr_) << "New packet pushed: " << packet_type_str << ", id(" << packet_unique_id << ")";
   return {packet_unique_id};
 }
 
@@ -87,27 +103,40 @@ void PacketsThreadPool::processPacket(size_t worker_id) {
   std::optional<std::pair<tarcap::TarcapVersion, PacketData>> packet;
 
   while (stopProcessing_ == false) {
-    lock.lock();
-
-    // Wait in this loop until queue is not empty and at least 1 packet in it is ready to be processed (not blocked)
-    // It can happen that queue is not empty but all of the packets in it are currently blocked, e.g.
-    // there are only 2 syncing packets and syncing packets must be processed synchronously 1 by 1. In such case queue
-    // is not empty but it would return empty optional as the second syncing packet is blocked by the first one
-    while (!(packet = queue_.pop())) {
-      if (stopProcessing_) {
-        LOG(log_dg_) << "Worker (" << worker_id << "): finished";
-        return;
+    // Non-blocking packets are popped without locking queue_mutex_, it is locked only when needed
+    packet = queue_.pop(lock);
+
+    if (!packet.has_value()) {
+      if (!lock.owns_lock()) {
+        lock.lock();
       }
+      waiting_workers_count_.fetch_add(1, std::memory_order_seq_cst);
+      // Pairs with the fence in push of non-blocking packets, which are pushed without queue_mutex_
+      std::atomic_thread_fence(std::memory_order_seq_cst);
+
+      // Wait in this loop until queue is not empty and at least 1 packet in it is ready to be processed (not blocked)
+      // It can happen that queue is not empty but all of the packets in it are currently blocked, e.g.
+      // there are only 2 syncing packets and syncing packets must be processed synchronously 1 by 1. In such case
+      // queue is not empty but it would return empty optional as the second syncing packet is blocked by the first one
+      while (!(packet = queue_.pop(lock))) {
+        if (stopProcessing_) {
+          waiting_workers_count_--;
+          LOG(log_dg_) << "Worker (" << worker_id << "): finished";
+          return;
+        }
+
+        cond_var_.wait(lock);
+      }
+      waiting_workers_count_--;
+    }
 
-      cond_var_.wait(lock);
+    if (lock.owns_lock()) {
+      lock.unlock();
     }
 
-    LOG(log_dg_) << "Worker (" << worker_id << ") process packet: " << packet->second.type_str_
+    LOG(log_tr_) << "Worker (" << worker_id << ") process packet: " << packet->second.type_str_
                  << ", id: " << packet->second.id_ << ", tarcap version: " << packet->first;
 
-    queue_.updateDependenciesStart(packet->second);
-    lock.unlock();
-
     try {
       // Get packets handler based on tarcap version
       const auto packets_handler = packets_handlers_.find(packet->first);
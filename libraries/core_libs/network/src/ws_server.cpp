@@ -4,6 +4,7 @@
 #include <json/writer.h>
 #include <libdevcore/CommonJS.h>
 
+#include <array>
 #include <boost/beast/websocket/rfc6455.hpp>
 
 #include "network/rpc/eth/data.hpp"
@@ -123,23 +124,107 @@ void WsSession::do_write(std::string &&message) {
     return;
   }
 
-  LOG(log_tr_) << "Before async_write";
-  boost::asio::post(write_strand_, [self = shared_from_this(), message = std::move(message)]() mutable {
-    self->write(std::move(message));
-  });
-  LOG(log_tr_) << "After async_write";
+  enqueue(std::move(message));
 }
 
-void WsSession::write(std::string &&message) {
+void WsSession::send(SubscriptionMessage &&message) {
   if (is_closed()) return;
 
+  enqueue(std::move(message));
+}
+
+void WsSession::enqueue(OutgoingMessage &&message) {
+  std::unique_lock<std::mutex> lock(send_queue_mutex_);
+  // Responses to requests are never dropped, only subscription messages are limited by the queue size
+  if (std::holds_alternative<SubscriptionMessage>(message) && send_queue_.size() >= kMaxSendQueueSize) {
+    lock.unlock();
+    evict();
+    return;
+  }
+
+  send_queue_.push_back(std::move(message));
+  if (flush_scheduled_) return;
+  flush_scheduled_ = true;
+  lock.unlock();
+
+  boost::asio::post(write_strand_, [self = shared_from_this()]() { self->flush(); });
+}
+
+void WsSession::flush() {
+  while (true) {
+    OutgoingMessage message;
+    {
+      std::lock_guard<std::mutex> lock(send_queue_mutex_);
+      if (is_closed()) {
+        send_queue_.clear();
+      }
+      if (send_queue_.empty()) {
+        flush_scheduled_ = false;
+        return;
+      }
+      message = std::move(send_queue_.front());
+      send_queue_.pop_front();
+    }
+    write(message);
+  }
+}
+
+void WsSession::write(const OutgoingMessage &message) {
+  if (const auto response = std::get_if<std::string>(&message)) {
+    writeBuffers(boost::asio::buffer(*response));
+    return;
+  }
+
+  const auto &notification = std::get<SubscriptionMessage>(message);
+  const auto head = SubscriptionMessage::head();
+  const std::array<boost::asio::const_buffer, 3> buffers{boost::asio::buffer(head.data(), head.size()),
+                                                         boost::asio::buffer(*notification.result),
+                                                         boost::asio::buffer(notification.tail)};
+  if (!writeBuffers(buffers)) return;
+
+  if (auto ws_server = ws_server_.lock(); ws_server && ws_server->metrics_) {
+    const auto latency = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() -
+                                                                               notification.created_at);
+    ws_server->metrics_->setWsDeliveryLatency(latency.count(),
+                                              {{"subscription", subscriptionTypeName(notification.type)}});
+  }
+}
+
+template <typename ConstBufferSequence>
+bool WsSession::writeBuffers(const ConstBufferSequence &buffers) {
+  if (is_closed()) return false;
+
   try {
     ws_.text(true);  // as we are using text msg here
-    ws_.write(boost::asio::buffer(std::move(message)));
+    ws_.write(buffers);
   } catch (const boost::system::system_error &e) {
     // LOG(log_nf_) << "WS closed in on_write " << e.what();
-    return close(is_normal(e.code()));
+    // Evicted session has its socket shut down to abort the write and is closed on the write strand
+    if (!closed_) {
+      close(is_normal(e.code()));
+    }
+    return false;
   }
+  return true;
+}
+
+void WsSession::evict() {
+  if (closed_.exchange(true)) return;
+
+  LOG(log_nf_) << "Closing WS session " << ip_ << ", client does not keep up with " << kMaxSendQueueSize
+               << " pending messages";
+  {
+    std::lock_guard<std::mutex> lock(send_queue_mutex_);
+    send_queue_.clear();
+  }
+  // Client that does not read blocks the ongoing write on the write strand, so no close handshake can be queued behind
+  // it. Shut the socket down directly to abort the write and close it on the write strand once the write returned
+  beast::error_code ec;
+  beast::get_lowest_layer(ws_).socket().shutdown(tcp::socket::shutdown_both, ec);
+  boost::asio::post(write_strand_, [self = shared_from_this()]() {
+    beast::error_code ec;
+    beast::get_lowest_layer(self->ws_).socket().close(ec);
+  });
 }
 
 void WsSession::close(bool normal) {
@@ -164,31 +249,29 @@ bool WsSession::is_normal(const beast::error_code &ec) {
 
 bool WsSession::is_closed() const { return closed_ || !ws_.is_open(); }
 
-void WsSession::newEthBlock(const Json::Value &payload) { subscriptions_.process(SubscriptionType::HEADS, payload); }
-void WsSession::newDagBlock(const Json::Value &payload) {
+void WsSession::newEthBlock(SubscriptionPayload &payload) { subscriptions_.process(SubscriptionType::HEADS, payload); }
+
+void WsSession::newDagBlock(SubscriptionPayload &payload) {
   subscriptions_.process(SubscriptionType::DAG_BLOCKS, payload);
 }
 
-void WsSession::newDagBlockFinalized(const Json::Value &payload) {
+void WsSession::newDagBlockFinalized(SubscriptionPayload &payload) {
   subscriptions_.process(SubscriptionType::DAG_BLOCK_FINALIZED, payload);
 }
 
-void WsSession::newPbftBlockExecuted(const Json::Value &payload) {
+void WsSession::newPbftBlockExecuted(SubscriptionPayload &payload) {
   subscriptions_.process(SubscriptionType::PBFT_BLOCK_EXECUTED, payload);
 }
 
-void WsSession::newPillarBlockData(const Json::Value &payload) {
+void WsSession::newPillarBlockData(SubscriptionPayload &payload) {
   subscriptions_.process(SubscriptionType::PILLAR_BLOCK, payload);
 }
 
-void WsSession::newPendingTransaction(const Json::Value &payload) {
+void WsSession::newPendingTransaction(SubscriptionPayload &payload) {
   subscriptions_.process(SubscriptionType::TRANSACTIONS, payload);
 }
 
-void WsSession::newLogs(const final_chain::BlockHeader &header, TransactionHashes trx_hashes,
-                        const TransactionReceipts &receipts) {
-  subscriptions_.processLogs(header, trx_hashes, receipts);
-}
+void WsSession::newLogs(LogsSubscriptionPayload &payload) { subscriptions_.processLogs(payload); }
 
 WsServer::WsServer(boost::asio::io_context &ioc, tcp::endpoint endpoint, addr_t node_addr,
                    std::shared_ptr<metrics::JsonRpcMetrics> metrics)
@@ -275,14 +358,16 @@ void WsServer::newEthBlock(const ::taraxa::final_chain::BlockHeader &header, con
   boost::shared_lock<boost::shared_mutex> lock(sessions_mtx_);
   if (sessions_.empty()) return;
 
-  auto payload = rpc::eth::toJson(header);
-  payload["transactions"] = rpc::eth::toJsonArray(trx_hashes);
+  auto json = rpc::eth::toJson(header);
+  json["transactions"] = rpc::eth::toJsonArray(trx_hashes);
+  SubscriptionPayload payload(std::move(json));
 
   for (auto const &session : sessions_) {
     if (!session->is_closed()) {
       session->newEthBlock(payload);
     }
   }
+  reportFanout(SubscriptionType::HEADS, payload.createdAt());
 }
 
 void WsServer::newLogs(const ::taraxa::final_chain::BlockHeader &header, TransactionHashes trx_hashes,
@@ -290,34 +375,39 @@ void WsServer::newLogs(const ::taraxa::final_chain::BlockHeader &header, Transac
   boost::shared_lock<boost::shared_mutex> lock(sessions_mtx_);
   if (sessions_.empty()) return;
 
+  LogsSubscriptionPayload payload(header, trx_hashes, receipts);
   for (auto const &session : sessions_) {
     if (!session->is_closed()) {
-      session->newLogs(header, trx_hashes, receipts);
+      session->newLogs(payload);
     }
   }
+  reportFanout(SubscriptionType::LOGS, payload.createdAt());
 }
 
 void WsServer::newDagBlock(const std::shared_ptr<DagBlock> &blk) {
   boost::shared_lock<boost::shared_mutex> lock(sessions_mtx_);
   if (sessions_.empty()) return;
 
-  auto payload = blk->getJson();
+  SubscriptionPayload payload(blk->getJson());
   for (auto const &session : sessions_) {
     if (!session->is_closed()) session->newDagBlock(payload);
   }
+  reportFanout(SubscriptionType::DAG_BLOCKS, payload.createdAt());
 }
 
 void WsServer::newDagBlockFinalized(const blk_hash_t &hash, uint64_t period) {
   boost::shared_lock<boost::shared_mutex> lock(sessions_mtx_);
   if (sessions_.empty()) return;
 
-  Json::Value payload;
-  payload["block"] = dev::toJS(hash);
-  payload["period"] = dev::toJS(period);
+  Json::Value json;
+  json["block"] = dev::toJS(hash);
+  json["period"] = dev::toJS(period);
+  SubscriptionPayload payload(std::move(json));
 
   for (auto const &session : sessions_) {
     if (!session->is_closed()) session->newDagBlockFinalized(payload);
   }
+  reportFanout(SubscriptionType::DAG_BLOCK_FINALIZED, payload.createdAt());
 }
 
 void WsServer::newPbftBlockExecuted(const PbftBlock &pbft_blk,
@@ -325,32 +415,43 @@ void WsServer::newPbftBlockExecuted(const PbftBlock &pbft_blk,
   boost::shared_lock<boost::shared_mutex> lock(sessions_mtx_);
   if (sessions_.empty()) return;
 
-  auto payload = PbftBlock::toJson(pbft_blk, finalized_dag_blk_hashes);
+  SubscriptionPayload payload(PbftBlock::toJson(pbft_blk, finalized_dag_blk_hashes));
 
   for (auto const &session : sessions_) {
     if (!session->is_closed()) session->newPbftBlockExecuted(payload);
   }
+  reportFanout(SubscriptionType::PBFT_BLOCK_EXECUTED, payload.createdAt());
 }
 void WsServer::newPendingTransaction(const trx_hash_t &trx_hash) {
   boost::shared_lock<boost::shared_mutex> lock(sessions_mtx_);
   if (sessions_.empty()) return;
 
-  auto payload = dev::toJS(trx_hash);
+  SubscriptionPayload payload(dev::toJS(trx_hash));
 
   for (auto const &session : sessions_) {
     if (!session->is_closed()) session->newPendingTransaction(payload);
   }
+  reportFanout(SubscriptionType::TRANSACTIONS, payload.createdAt());
 }
 
 void WsServer::newPillarBlockData(const pillar_chain::PillarBlockData &pillar_block_data) {
   boost::shared_lock<boost::shared_mutex> lock(sessions_mtx_);
   if (sessions_.empty()) return;
 
-  auto payload = pillar_block_data.getJson(true);
+  SubscriptionPayload payload(pillar_block_data.getJson(true));
 
   for (auto const &session : sessions_) {
     if (!session->is_closed()) session->newPillarBlockData(payload);
   }
+  reportFanout(SubscriptionType::PILLAR_BLOCK, payload.createdAt());
+}
+
+void WsServer::reportFanout(SubscriptionType type, std::chrono::steady_clock::time_point start) const {
+  if (!metrics_) return;
+
+  const auto duration =
+      std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+  metrics_->setWsFanoutDuration(duration.count(), {{"subscription", subscriptionTypeName(type)}});
 }
 
 uint32_t WsServer::numberOfSessions() {
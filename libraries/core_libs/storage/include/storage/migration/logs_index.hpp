@@ -0,0 +1,20 @@
+#pragma once
+#include <libdevcore/Common.h>
+
+#include "storage/migration/migration_base.hpp"
+
+namespace taraxa::storage::migration {
+// Backfills address/topic logs index from receipts of all finalized periods
+class LogsIndex : public migration::Base {
+ public:
+  LogsIndex(std::shared_ptr<DbStorage> db);
+  std::string id() override;
+  uint32_t dbVersion() override;
+
+  // Removes index and marks migration as not applied, so index is backfilled again when it is re-enabled
+  void revert(logger::Logger& log);
+
+ protected:
+  void migrate(logger::Logger& log) override;
+};
+}  // namespace taraxa::storage::migration
@@ -16,6 +16,9 @@ class Manager {
 
   void applyReceiptsByPeriod();
 
+  // Builds logs index if it is enabled and removes it otherwise
+  void applyLogsIndex(bool enabled);
+
  private:
   void applyMigration(std::shared_ptr<migration::Base> m);
   std::shared_ptr<DbStorage> db_;
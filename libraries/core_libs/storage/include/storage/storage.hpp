@@ -10,6 +10,7 @@
 #include <regex>
 
 #include "common/types.hpp"
+#include "config/config.hpp"
 #include "dag/dag_block.hpp"
 #include "logger/logger.hpp"
 #include "pbft/pbft_block.hpp"
@@ -80,11 +81,20 @@ class DbStorage : public std::enable_shared_from_this<DbStorage> {
    public:
     size_t const ordinal_;
     const rocksdb::Comparator* comparator_;
+    // Default tuning profile, might be overridden in config
+    DbColumnProfile const profile_;
+    // Size of fixed key prefix used for prefix seeks, 0 - column is not read by prefix
+    size_t const prefix_size_;
 
-    Column(std::string name, size_t ordinal, const rocksdb::Comparator* comparator)
-        : name_(std::move(name)), ordinal_(ordinal), comparator_(comparator) {}
+    Column(std::string name, size_t ordinal, const rocksdb::Comparator* comparator,
+           DbColumnProfile profile = DbColumnProfile::Default, size_t prefix_size = 0)
+        : name_(std::move(name)),
+          ordinal_(ordinal),
+          comparator_(comparator),
+          profile_(profile),
+          prefix_size_(prefix_size) {}
 
-    Column(std::string name, size_t ordinal) : name_(std::move(name)), ordinal_(ordinal), comparator_(nullptr) {}
+    Column(std::string name, size_t ordinal) : Column(std::move(name), ordinal, nullptr) {}
 
     auto const& name() const { return ordinal_ ? name_ : rocksdb::kDefaultColumnFamilyName; }
   };
@@ -98,64 +108,82 @@ class DbStorage : public std::enable_shared_from_this<DbStorage> {
 #define COLUMN(__name__) static inline auto const __name__ = all_.emplace_back(#__name__, all_.size())
 #define COLUMN_W_COMP(__name__, ...) \
   static inline auto const __name__ = all_.emplace_back(#__name__, all_.size(), __VA_ARGS__)
+#define COLUMN_W_PROFILE(__name__, ...) \
+  static inline auto const __name__ = all_.emplace_back(#__name__, all_.size(), nullptr, __VA_ARGS__)
 
     // do not change/move
     COLUMN(default_column);
     // migrations
     COLUMN(migrations);
     // Contains full data for an executed PBFT block including PBFT block, cert votes, dag blocks and transactions
-    COLUMN_W_COMP(period_data, getIntComparator<PbftPeriod>());
+    COLUMN_W_COMP(period_data, getIntComparator<PbftPeriod>(), DbColumnProfile::AppendOnly);
     COLUMN(genesis);
-    COLUMN(dag_blocks);
-    COLUMN_W_COMP(dag_blocks_level, getIntComparator<uint64_t>());
-    COLUMN(transactions);
-    COLUMN(trx_period);
-    COLUMN(status);
-    COLUMN(pbft_mgr_round_step);
-    COLUMN(pbft_mgr_status);
-    COLUMN(cert_voted_block_in_round);  // Cert voted block + round -> node voted for this block
-    COLUMN(proposed_pbft_blocks);       // Proposed pbft blocks
-    COLUMN(pbft_head);
-    COLUMN(latest_round_own_votes);             // own votes of any type for the latest round
-    COLUMN(latest_round_two_t_plus_one_votes);  // 2t+1 votes bundles of any type for the latest round
-    COLUMN(extra_reward_votes);                 // extra reward votes on top of 2t+1 cert votes bundle from
-                                                // latest_round_two_t_plus_one_votes
-    COLUMN(pbft_block_period);
-    COLUMN(dag_block_period);
+    COLUMN_W_PROFILE(dag_blocks, DbColumnProfile::PointLookup);
+    COLUMN_W_COMP(dag_blocks_level, getIntComparator<uint64_t>(), DbColumnProfile::AppendOnly);
+    COLUMN_W_PROFILE(transactions, DbColumnProfile::PointLookup);
+    COLUMN_W_PROFILE(trx_period, DbColumnProfile::PointLookup);
+    COLUMN_W_PROFILE(status, DbColumnProfile::SmallHot);
+    COLUMN_W_PROFILE(pbft_mgr_round_step, DbColumnProfile::SmallHot);
+    COLUMN_W_PROFILE(pbft_mgr_status, DbColumnProfile::SmallHot);
+    // Cert voted block + round -> node voted for this block
+    COLUMN_W_PROFILE(cert_voted_block_in_round, DbColumnProfile::SmallHot);
+    COLUMN(proposed_pbft_blocks);  // Proposed pbft blocks
+    COLUMN_W_PROFILE(pbft_head, DbColumnProfile::SmallHot);
+    // own votes of any type for the latest round
+    COLUMN_W_PROFILE(latest_round_own_votes, DbColumnProfile::SmallHot);
+    // 2t+1 votes bundles of any type for the latest round
+    COLUMN_W_PROFILE(latest_round_two_t_plus_one_votes, DbColumnProfile::SmallHot);
+    COLUMN(extra_reward_votes);  // extra reward votes on top of 2t+1 cert votes bundle from
+                                 // latest_round_two_t_plus_one_votes
+    COLUMN_W_PROFILE(pbft_block_period, DbColumnProfile::PointLookup);
+    COLUMN_W_PROFILE(dag_block_period, DbColumnProfile::PointLookup);
     COLUMN_W_COMP(proposal_period_levels_map, getIntComparator<uint64_t>());
-    COLUMN(final_chain_meta);
+    COLUMN_W_PROFILE(final_chain_meta, DbColumnProfile::SmallHot);
     COLUMN(final_chain_blk_by_number);
     COLUMN(final_chain_blk_hash_by_number);
-    COLUMN(final_chain_blk_number_by_hash);
-    COLUMN(final_chain_receipt_by_trx_hash);
+    COLUMN_W_PROFILE(final_chain_blk_number_by_hash, DbColumnProfile::PointLookup);
+    COLUMN_W_PROFILE(final_chain_receipt_by_trx_hash, DbColumnProfile::PointLookup);
     COLUMN(final_chain_log_blooms_index);
     COLUMN_W_COMP(sortition_params_change, getIntComparator<PbftPeriod>());
 
     COLUMN_W_COMP(block_rewards_stats, getIntComparator<uint64_t>());
 
     // Finalized pillar blocks
-    COLUMN_W_COMP(pillar_block, getIntComparator<PbftPeriod>());
+    COLUMN_W_COMP(pillar_block, getIntComparator<PbftPeriod>(), DbColumnProfile::AppendOnly);
     // Current pillar block data - current pillar block + current vote counts
-    COLUMN(current_pillar_block_data);
+    COLUMN_W_PROFILE(current_pillar_block_data, DbColumnProfile::SmallHot);
     // Current pillar block own pillar vote
-    COLUMN(current_pillar_block_own_vote);
+    COLUMN_W_PROFILE(current_pillar_block_own_vote, DbColumnProfile::SmallHot);
     // system transactions that is not a part of the block
-    COLUMN(system_transaction);
+    COLUMN_W_PROFILE(system_transaction, DbColumnProfile::PointLookup);
     // system transactions hashes by period
     COLUMN(period_system_transactions);
     // final chain receipts by period
-    COLUMN_W_COMP(final_chain_receipt_by_period, getIntComparator<PbftPeriod>());
+    COLUMN_W_COMP(final_chain_receipt_by_period, getIntComparator<PbftPeriod>(), DbColumnProfile::AppendOnly);
     // Dynamic lambda used in specific period (only saved if it changed compared to the previous period)
     COLUMN_W_COMP(period_lambda, getIntComparator<PbftPeriod>());
     // Rounds count (per N blocks) used to determine dynamic lambda
     COLUMN(rounds_count_dynamic_lambda);
+    // Logs index, written only if enabled in config. Keys are address | period | trx position | log position and
+    // topic | topic position | period | trx position | log position with big endian numbers, values are empty
+    COLUMN_W_PROFILE(final_chain_logs_by_address, DbColumnProfile::Default, sizeof(Address));
+    COLUMN_W_PROFILE(final_chain_logs_by_topic, DbColumnProfile::Default, sizeof(h256) + 1);
+    // Offsets of pbft block, cert votes and each transaction inside of period_data value stored as [offset, size]
+    // uint32_t pairs, so that single item is sliced out of pinned period data without walking the whole rlp
+    COLUMN_W_COMP(period_data_offsets, getIntComparator<PbftPeriod>(), DbColumnProfile::AppendOnly);
 
 #undef COLUMN
 #undef COLUMN_W_COMP
+#undef COLUMN_W_PROFILE
   };
 
   auto handle(Column const& col) const { return handles_[col.ordinal_]; }
 
+  /// Batched MultiGet. Keys are passed to rocksdb sorted by the column comparator, so it skips sorting them itself
+  /// and reads blocks in order, values are returned in the order of keys, nullptr for absent keys
+  std::vector<std::shared_ptr<rocksdb::PinnableSlice>> multiGet(std::vector<Slice> const& keys, Column const& column,
+                                                                const rocksdb::Snapshot* snapshot = nullptr) const;
+
   void DeleteRange(const Column& col, uint64_t begin, uint64_t end);
   void CompactRange(const Column& col, uint64_t begin, uint64_t end);
   rocksdb::ReadOptions read_options_;
@@ -180,16 +208,67 @@ class DbStorage : public std::enable_shared_from_this<DbStorage> {
   std::set<PbftPeriod> snapshots_;
   uint64_t earliest_block_number_ = 0;
 
+  // Block cache shared by all columns, nullptr - each column uses its own default cache
+  std::shared_ptr<rocksdb::Cache> block_cache_;
+  // Overrides of default column profiles
+  const std::map<std::string, DbColumnProfile> column_profiles_;
+
+  // Group commit: max number of finalized periods that might be written without fsync while group commit is active
+  uint32_t group_commit_max_periods_ = 0;
+  std::atomic<bool> group_commit_active_ = false;
+  std::atomic<uint32_t> uncommitted_periods_ = 0;
+
   uint32_t kMajorVersion_;
   bool major_version_changed_ = false;
   bool minor_version_changed_ = false;
 
+  /**
+   * @brief Period data value pinned in rocksdb, items are sliced out of it using period_data_offsets. Periods saved
+   *        before offsets were introduced have no offsets, items are then found by walking the period data rlp
+   */
+  class PinnedPeriodData {
+   public:
+    PinnedPeriodData(std::shared_ptr<rocksdb::PinnableSlice> data, std::shared_ptr<rocksdb::PinnableSlice> offsets);
+
+    bool empty() const { return !data_ || data_->empty(); }
+    dev::RLP pbftBlock() const;
+    dev::RLP certVotes() const;
+    size_t transactionsCount() const;
+    // Position must be lower than transactionsCount()
+    dev::RLP transaction(size_t position) const;
+
+   private:
+    dev::RLP item(size_t index) const;
+
+    std::shared_ptr<rocksdb::PinnableSlice> data_;
+    std::shared_ptr<rocksdb::PinnableSlice> offsets_;
+    // Only used without offsets, rlp caches last accessed item so ascending positions do not walk from the start
+    dev::RLP transactions_rlp_;
+  };
+
+  /**
+   * @brief Column options tuned by the column profile, which can be overridden in config
+   */
+  rocksdb::ColumnFamilyOptions columnOptions(const Column& col) const;
+  rocksdb::ColumnFamilyOptions columnOptions(const std::string& name) const;
+
+  static bytes periodDataOffsets(bytes const& period_data_rlp);
+  PinnedPeriodData getPeriodDataPinned(PbftPeriod period) const;
+  std::vector<PinnedPeriodData> getPeriodsDataPinned(std::vector<PbftPeriod> const& periods,
+                                                     const rocksdb::Snapshot* snapshot) const;
+
+  std::vector<LogLocation> getLogLocations(Column const& column, std::vector<bytes> const& prefixes, PbftPeriod from,
+                                           PbftPeriod to) const;
+  uint64_t estimateLogLocations(Column const& column, std::vector<bytes> const& prefixes, PbftPeriod from,
+                                PbftPeriod to) const;
+
   LOG_OBJECTS_DEFINE
 
  public:
   explicit DbStorage(fs::path const& base_path, uint32_t db_snapshot_each_n_pbft_block = 0, uint32_t max_open_files = 0,
                      uint32_t db_max_snapshots = 0, PbftPeriod db_revert_to_period = 0, addr_t node_addr = addr_t(),
-                     bool rebuild = false);
+                     bool rebuild = false, uint32_t block_cache_size_mb = 0,
+                     std::map<std::string, DbColumnProfile> column_profiles = {});
   ~DbStorage();
 
   DbStorage(const DbStorage&) = delete;
@@ -204,6 +283,41 @@ class DbStorage : public std::enable_shared_from_this<DbStorage> {
   void commitWriteBatch(Batch& write_batch, const rocksdb::WriteOptions& opts);
   void commitWriteBatch(Batch& write_batch) { commitWriteBatch(write_batch, async_write_); }
 
+  /**
+   * @brief Commits batch of a finalized period. Batch is synced to disk unless group commit is active, in that case
+   * fsync is done only once per group_commit_max_periods periods. WAL is written sequentially, so synced write makes
+   * all previous periods durable as well. Anything that must not get ahead of the period on disk, e.g. state db
+   * commit, has to be preceded by flushGroupCommit
+   *
+   * @param write_batch
+   */
+  void commitPeriodWriteBatch(Batch& write_batch);
+
+  /**
+   * @brief Enables group commit of finalized periods batches
+   *
+   * @param max_uncommitted_periods max number of periods that might be not synced to disk, 0 disables group commit
+   */
+  void enableGroupCommit(uint32_t max_uncommitted_periods);
+
+  /**
+   * @brief Group commit is applied only while it is active, e.g. while node is syncing. Deactivation syncs all periods
+   *        committed without fsync
+   *
+   * @param active
+   */
+  void setGroupCommitActive(bool active);
+
+  /**
+   * @brief Syncs to disk all periods batches that were committed without fsync
+   */
+  void flushGroupCommit();
+
+  /**
+   * @return number of periods committed without fsync since the last synced write
+   */
+  uint32_t uncommittedPeriods() const { return uncommitted_periods_; }
+
   void rebuildColumns(const rocksdb::Options& options);
   bool createSnapshot(PbftPeriod period);
   void deleteSnapshot(PbftPeriod period);
@@ -255,6 +369,8 @@ class DbStorage : public std::enable_shared_from_this<DbStorage> {
   // DAG
   void saveDagBlock(const std::shared_ptr<DagBlock>& blk, Batch* write_batch_p = nullptr);
   std::shared_ptr<DagBlock> getDagBlock(blk_hash_t const& hash);
+  // Bulk version of getDagBlock, nullptr for blocks not found
+  std::vector<std::shared_ptr<DagBlock>> getDagBlocks(std::vector<blk_hash_t> const& hashes);
   bool dagBlockInDb(blk_hash_t const& hash);
   std::set<blk_hash_t> getBlocksByLevel(level_t level);
   level_t getLastBlocksLevel() const;
@@ -271,6 +387,8 @@ class DbStorage : public std::enable_shared_from_this<DbStorage> {
   // Transaction
   std::shared_ptr<Transaction> getTransaction(trx_hash_t const& hash) const;
   std::shared_ptr<Transaction> getTransaction(PbftPeriod period, uint32_t position) const;
+  // Bulk version of getTransaction, nullptr for transactions not found
+  SharedTransactions getTransactions(std::vector<trx_hash_t> const& hashes) const;
 
   SharedTransactions getAllNonfinalizedTransactions();
   bool transactionInDb(trx_hash_t const& hash);
@@ -283,9 +401,27 @@ class DbStorage : public std::enable_shared_from_this<DbStorage> {
   void addTransactionLocationToBatch(Batch& write_batch, trx_hash_t const& trx, PbftPeriod period, uint32_t position,
                                      bool is_system = false);
   std::optional<TransactionLocation> getTransactionLocation(trx_hash_t const& hash) const;
+  std::vector<std::optional<TransactionLocation>> getTransactionLocations(
+      std::vector<trx_hash_t> const& hashes, const rocksdb::Snapshot* snapshot = nullptr) const;
   std::unordered_map<trx_hash_t, PbftPeriod> getAllTransactionPeriod();
   uint64_t getTransactionCount(PbftPeriod period) const;
   SharedTransactionReceipts getBlockReceipts(PbftPeriod period) const;
+  std::vector<SharedTransactionReceipts> getBlocksReceipts(std::vector<PbftPeriod> const& periods) const;
+  // Lazily decoded views over values pinned in rocksdb block cache, nullptr if block has no receipts stored
+  SharedBlockReceiptsView getBlockReceiptsView(PbftPeriod period) const;
+  std::vector<SharedBlockReceiptsView> getBlocksReceiptsViews(std::vector<PbftPeriod> const& periods) const;
+
+  // Logs index
+  void addLogsIndexToBatch(Batch& write_batch, PbftPeriod period, TransactionReceipts const& receipts);
+  std::vector<LogLocation> getLogLocationsByAddresses(std::vector<Address> const& addresses, PbftPeriod from,
+                                                      PbftPeriod to) const;
+  std::vector<LogLocation> getLogLocationsByTopics(std::vector<h256> const& topics, uint8_t topic_position,
+                                                   PbftPeriod from, PbftPeriod to) const;
+  // Approximate number of index entries, it is cheap as it is based on files metadata
+  uint64_t estimateLogLocationsByAddresses(std::vector<Address> const& addresses, PbftPeriod from,
+                                           PbftPeriod to) const;
+  uint64_t estimateLogLocationsByTopics(std::vector<h256> const& topics, uint8_t topic_position, PbftPeriod from,
+                                        PbftPeriod to) const;
   std::optional<TransactionReceipt> getTransactionReceipt(EthBlockNumber blk_n, uint64_t position) const;
 
   /**
@@ -464,6 +600,43 @@ class DbStorage : public std::enable_shared_from_this<DbStorage> {
     return value;
   }
 
+  /// Looks up multiple keys of the same column with a single batched MultiGet
+  /// @param snapshot rocksdb snapshot to read from, so that lookups of several columns see the same state
+  /// @return values in the order of keys, empty string for absent keys
+  template <typename K>
+  std::vector<std::string> multiLookup(std::vector<K> const& keys, Column const& column,
+                                       const rocksdb::Snapshot* snapshot = nullptr) const {
+    auto values = multiGet(toSlices(keys), column, snapshot);
+    std::vector<std::string> ret(values.size());
+    for (size_t i = 0; i < values.size(); ++i) {
+      if (values[i]) {
+        ret[i] = values[i]->ToString();
+      }
+    }
+    return ret;
+  }
+
+  /// Same as lookup, but value is pinned instead of being copied out of rocksdb
+  /// @return nullptr if key is absent
+  template <typename K>
+  std::shared_ptr<rocksdb::PinnableSlice> lookupPinned(K const& key, Column const& column) const {
+    auto value = std::make_shared<rocksdb::PinnableSlice>();
+    auto status = db_->Get(read_options_, handle(column), toSlice(key), value.get());
+    if (status.IsNotFound()) {
+      return nullptr;
+    }
+    checkStatus(status);
+    return value;
+  }
+
+  /// Same as multiLookup, but values are pinned instead of being copied out of rocksdb
+  /// @return values in the order of keys, nullptr for absent keys
+  template <typename K>
+  std::vector<std::shared_ptr<rocksdb::PinnableSlice>> multiLookupPinned(
+      std::vector<K> const& keys, Column const& column, const rocksdb::Snapshot* snapshot = nullptr) const {
+    return multiGet(toSlices(keys), column, snapshot);
+  }
+
   template <typename Int, typename K>
   auto lookup_int(K const& key, Column const& column) -> std::enable_if_t<std::is_integral_v<Int>, std::optional<Int>> {
     auto str = lookup(key, column);
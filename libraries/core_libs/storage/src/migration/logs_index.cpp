@@ -0,0 +1,38 @@
+#include "storage/migration/logs_index.hpp"
+
+#include "storage/storage.hpp"
+
+namespace taraxa::storage::migration {
+
+LogsIndex::LogsIndex(std::shared_ptr<DbStorage> db) : migration::Base(db) {}
+
+std::string LogsIndex::id() { return "LogsIndex"; }
+
+uint32_t LogsIndex::dbVersion() { return 1; }
+
+void LogsIndex::migrate(logger::Logger& log) {
+  // Limits memory used by batch, index entries are small so it is committed by number of periods
+  constexpr uint64_t kPeriodsPerBatch = 10000;
+  auto it = db_->getColumnIterator(DbStorage::Columns::final_chain_receipt_by_period);
+  uint64_t indexed_periods = 0;
+  for (it->SeekToFirst(); it->Valid(); it->Next()) {
+    PbftPeriod period;
+    memcpy(&period, it->key().data(), sizeof(PbftPeriod));
+    const auto receipts = util::rlp_dec<TransactionReceipts>(DbStorage::sliceToRlp(it->value()));
+    db_->addLogsIndexToBatch(batch_, period, receipts);
+    if (++indexed_periods % kPeriodsPerBatch == 0) {
+      db_->commitWriteBatch(batch_);
+      LOG(log) << "Logs index migration indexed period " << period;
+    }
+  }
+  LOG(log) << "Logs index migration applied to " << indexed_periods << " periods";
+}
+
+void LogsIndex::revert(logger::Logger& log) {
+  db_->deleteColumnData(DbStorage::Columns::final_chain_logs_by_address);
+  db_->deleteColumnData(DbStorage::Columns::final_chain_logs_by_topic);
+  db_->remove(DbStorage::Columns::migrations, id());
+  LOG(log) << "Logs index removed";
+}
+
+}  // namespace taraxa::storage::migration
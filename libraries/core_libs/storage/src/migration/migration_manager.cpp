@@ -1,5 +1,6 @@
 #include "storage/migration/migration_manager.hpp"
 
+#include "storage/migration/logs_index.hpp"
 #include "storage/migration/transaction_receipts_by_period.hpp"
 
 namespace taraxa::storage::migration {
@@ -32,4 +33,13 @@ void Manager::applyAll() {
 
 void Manager::applyReceiptsByPeriod() { applyMigration(std::make_shared<TransactionReceiptsByPeriod>(db_)); }
 
+void Manager::applyLogsIndex(bool enabled) {
+  auto logs_index = std::make_shared<LogsIndex>(db_);
+  if (enabled) {
+    applyMigration(logs_index);
+  } else if (logs_index->isApplied()) {
+    logs_index->revert(log_si_);
+  }
+}
+
 }  // namespace taraxa::storage::migration
\ No newline at end of file
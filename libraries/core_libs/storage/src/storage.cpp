@@ -6,7 +6,9 @@
 #include <boost/algorithm/string/split.hpp>
 #include <cstddef>
 #include <cstdint>
+#include <limits>
 #include <memory>
+#include <numeric>
 #include <regex>
 
 #include "common/thread_pool.hpp"
@@ -15,6 +17,11 @@
 #include "dag/sortition_params_manager.hpp"
 #include "final_chain/data.hpp"
 #include "pillar_chain/pillar_block.hpp"
+#include "rocksdb/cache.h"
+#include "rocksdb/filter_policy.h"
+#include "rocksdb/slice_transform.h"
+#include "rocksdb/snapshot.h"
+#include "rocksdb/table.h"
 #include "rocksdb/utilities/checkpoint.h"
 #include "transaction/system_transaction.hpp"
 #include "vote/pbft_vote.hpp"
@@ -29,13 +36,18 @@ static constexpr uint16_t DAG_BLOCKS_POS_IN_PERIOD_DATA = 2;
 static constexpr uint16_t TRANSACTIONS_POS_IN_PERIOD_DATA = 3;
 static constexpr uint16_t PILLAR_VOTES_POS_IN_PERIOD_DATA = 4;
 static constexpr uint16_t PREV_BLOCK_HASH_POS_IN_PBFT_BLOCK = 0;
+// Period data offsets are [offset, size] pairs of pbft block, cert votes and then of each transaction
+static constexpr size_t ITEM_SIZE_IN_PERIOD_DATA_OFFSETS = 2 * sizeof(uint32_t);
+static constexpr size_t TRANSACTIONS_POS_IN_PERIOD_DATA_OFFSETS = 2;
 
 DbStorage::DbStorage(const fs::path& path, uint32_t db_snapshot_each_n_pbft_block, uint32_t max_open_files,
-                     uint32_t db_max_snapshots, PbftPeriod db_revert_to_period, addr_t node_addr, bool rebuild)
+                     uint32_t db_max_snapshots, PbftPeriod db_revert_to_period, addr_t node_addr, bool rebuild,
+                     uint32_t block_cache_size_mb, std::map<std::string, DbColumnProfile> column_profiles)
     : path_(path),
       handles_(Columns::all.size()),
       kDbSnapshotsEachNblock(db_snapshot_each_n_pbft_block),
-      kDbSnapshotsMaxCount(db_max_snapshots) {
+      kDbSnapshotsMaxCount(db_max_snapshots),
+      column_profiles_(std::move(column_profiles)) {
   db_path_ = (path / kDbDir);
   state_db_path_ = (path / kStateDbDir);
   async_write_.sync = false;
@@ -55,6 +67,18 @@ DbStorage::DbStorage(const fs::path& path, uint32_t db_snapshot_each_n_pbft_bloc
   }
   LOG_OBJECTS_CREATE("DBS");
 
+  for (const auto& column_profile : column_profiles_) {
+    const auto& name = column_profile.first;
+    if (std::none_of(Columns::all.begin(), Columns::all.end(),
+                     [&name](const Column& col) { return col.name() == name; })) {
+      throw DbException("Profile " + dbColumnProfileToString(column_profile.second) + " set for unknown column " +
+                        name);
+    }
+  }
+  if (block_cache_size_mb) {
+    block_cache_ = rocksdb::NewLRUCache(size_t(block_cache_size_mb) * 1024 * 1024);
+  }
+
   fs::create_directories(db_path_);
   removeTempFiles();
 
@@ -74,11 +98,8 @@ DbStorage::DbStorage(const fs::path& path, uint32_t db_snapshot_each_n_pbft_bloc
 
   std::vector<rocksdb::ColumnFamilyDescriptor> descriptors;
   descriptors.reserve(Columns::all.size());
-  std::transform(Columns::all.begin(), Columns::all.end(), std::back_inserter(descriptors), [](const Column& col) {
-    auto options = rocksdb::ColumnFamilyOptions();
-    if (col.comparator_) options.comparator = col.comparator_;
-    return rocksdb::ColumnFamilyDescriptor(col.name(), options);
-  });
+  std::transform(Columns::all.begin(), Columns::all.end(), std::back_inserter(descriptors),
+                 [this](const Column& col) { return rocksdb::ColumnFamilyDescriptor(col.name(), columnOptions(col)); });
 
   rebuildColumns(options);
 
@@ -106,6 +127,73 @@ DbStorage::DbStorage(const fs::path& path, uint32_t db_snapshot_each_n_pbft_bloc
   }
 }
 
+rocksdb::ColumnFamilyOptions DbStorage::columnOptions(const Column& col) const {
+  rocksdb::ColumnFamilyOptions options;
+  if (col.comparator_) {
+    options.comparator = col.comparator_;
+  }
+
+  rocksdb::BlockBasedTableOptions table_options;
+  table_options.block_cache = block_cache_;
+  const auto profile_it = column_profiles_.find(col.name());
+  switch (profile_it != column_profiles_.end() ? profile_it->second : col.profile_) {
+    case DbColumnProfile::PointLookup:
+      // Whole key bloom filters skip sst files without the key. Partitioned index and filters are cached only
+      // partially, so big columns do not push data blocks out of the cache
+      table_options.filter_policy.reset(rocksdb::NewBloomFilterPolicy(10));
+      table_options.whole_key_filtering = true;
+      table_options.index_type = rocksdb::BlockBasedTableOptions::kTwoLevelIndexSearch;
+      table_options.partition_filters = true;
+      table_options.cache_index_and_filter_blocks = true;
+      table_options.cache_index_and_filter_blocks_with_high_priority = true;
+      table_options.pin_top_level_index_and_filter = true;
+      options.memtable_whole_key_filtering = true;
+      options.memtable_prefix_bloom_size_ratio = 0.02;
+      break;
+    case DbColumnProfile::AppendOnly:
+      // Sst files of keys written in order do not overlap, so leveled compaction moves them down without rewriting.
+      // Larger blocks compress better and suit range reads
+      table_options.block_size = 64 * 1024;
+      break;
+    case DbColumnProfile::SmallHot:
+      // Values are rewritten all the time, small memtable is flushed often. Filters with index are kept in the block
+      // cache and the ones of L0 files are pinned there
+      options.write_buffer_size = 4 * 1024 * 1024;
+      table_options.filter_policy.reset(rocksdb::NewBloomFilterPolicy(10));
+      table_options.cache_index_and_filter_blocks = true;
+      table_options.pin_l0_filter_and_index_blocks_in_cache = true;
+      options.memtable_whole_key_filtering = true;
+      options.memtable_prefix_bloom_size_ratio = 0.1;
+      break;
+    default:
+      break;
+  }
+
+  // Column is read only by seeks within the prefix, prefix bloom filters skip sst files without the prefix
+  if (col.prefix_size_) {
+    options.prefix_extractor.reset(rocksdb::NewFixedPrefixTransform(col.prefix_size_));
+    if (!table_options.filter_policy) {
+      table_options.filter_policy.reset(rocksdb::NewBloomFilterPolicy(10));
+    }
+    table_options.whole_key_filtering = false;
+    options.memtable_prefix_bloom_size_ratio = 0.02;
+  }
+
+  options.table_factory.reset(rocksdb::NewBlockBasedTableFactory(table_options));
+  return options;
+}
+
+rocksdb::ColumnFamilyOptions DbStorage::columnOptions(const std::string& name) const {
+  const auto it = std::find_if(Columns::all.begin(), Columns::all.end(), [&name](const Column& col) {
+    // "-copy" is there, so we will removed unsuccessful migrations
+    return col.name() == name || col.name() + "-copy" == name;
+  });
+  if (it == Columns::all.end()) {
+    return rocksdb::ColumnFamilyOptions();
+  }
+  return columnOptions(*it);
+}
+
 void DbStorage::removeTempFiles() const {
   const std::regex filePattern("LOG\\.old\\.\\d+");
   removeFilesWithPattern(db_path_, filePattern);
@@ -178,7 +266,7 @@ std::unique_ptr<rocksdb::ColumnFamilyHandle> DbStorage::copyColumn(rocksdb::Colu
   checkStatus(status);
 
   const rocksdb::Comparator* comparator = orig_column->GetComparator();
-  auto options = rocksdb::ColumnFamilyOptions();
+  auto options = columnOptions(new_col_name);
   if (comparator != nullptr) {
     options.comparator = comparator;
   }
@@ -219,11 +307,7 @@ void DbStorage::deleteColumnData(const Column& c) {
   checkStatus(db_->DropColumnFamily(handle(c)));
   db_->DestroyColumnFamilyHandle(handle(c));
 
-  auto options = rocksdb::ColumnFamilyOptions();
-  if (c.comparator_) {
-    options.comparator = c.comparator_;
-  }
-  checkStatus(db_->CreateColumnFamily(options, c.name(), &handles_[c.ordinal_]));
+  checkStatus(db_->CreateColumnFamily(columnOptions(c), c.name(), &handles_[c.ordinal_]));
 }
 
 void DbStorage::rebuildColumns(const rocksdb::Options& options) {
@@ -239,15 +323,8 @@ void DbStorage::rebuildColumns(const rocksdb::Options& options) {
   descriptors.reserve(column_families.size());
   std::vector<rocksdb::ColumnFamilyHandle*> handles;
   handles.reserve(column_families.size());
-  std::transform(column_families.begin(), column_families.end(), std::back_inserter(descriptors), [](const auto& name) {
-    const auto it = std::find_if(Columns::all.begin(), Columns::all.end(), [&name](const Column& col) {
-      // "-copy" is there, so we will removed unsuccessful migrations
-      return col.name() == name || col.name() + "-copy" == name;
-    });
-    auto options = rocksdb::ColumnFamilyOptions();
-    if (it != Columns::all.end() && it->comparator_) options.comparator = it->comparator_;
-    return rocksdb::ColumnFamilyDescriptor(name, options);
-  });
+  std::transform(column_families.begin(), column_families.end(), std::back_inserter(descriptors),
+                 [this](const auto& name) { return rocksdb::ColumnFamilyDescriptor(name, columnOptions(name)); });
   rocksdb::DB* db_ptr = nullptr;
   checkStatus(rocksdb::DB::Open(options, db_path_.string(), descriptors, &handles, &db_ptr));
   assert(db_ptr);
@@ -260,9 +337,8 @@ void DbStorage::rebuildColumns(const rocksdb::Options& options) {
       if (handles[i]->GetName() == "dag_blocks_index") {
         rocksdb::ColumnFamilyHandle* handle_dag_blocks_level;
 
-        auto options = rocksdb::ColumnFamilyOptions();
-        options.comparator = getIntComparator<uint64_t>();
-        checkStatus(db->CreateColumnFamily(options, Columns::dag_blocks_level.name(), &handle_dag_blocks_level));
+        checkStatus(db->CreateColumnFamily(columnOptions(Columns::dag_blocks_level), Columns::dag_blocks_level.name(),
+                                           &handle_dag_blocks_level));
 
         auto it_dag_level = std::unique_ptr<rocksdb::Iterator>(db->NewIterator(read_options_, handles[i]));
         it_dag_level->SeekToFirst();
@@ -318,6 +394,9 @@ bool DbStorage::createSnapshot(PbftPeriod period) {
 
   LOG(log_nf_) << "Creating DB snapshot on period: " << period;
 
+  // Snapshot is a recovery point, all periods before it has to be durable
+  flushGroupCommit();
+
   // Create rocksdb checkpoint/snapshot
   rocksdb::Checkpoint* checkpoint;
   auto status = rocksdb::Checkpoint::Create(db_.get(), &checkpoint);
@@ -409,6 +488,11 @@ std::optional<h256> DbStorage::getGenesisHash() {
 }
 
 DbStorage::~DbStorage() {
+  try {
+    flushGroupCommit();
+  } catch (const DbException& e) {
+    LOG(log_er_) << "Failed to sync periods committed without fsync: " << e.what();
+  }
   for (auto cf : handles_) {
     if (cf->GetName() != "default") {
       checkStatus(db_->DestroyColumnFamilyHandle(cf));
@@ -444,6 +528,39 @@ void DbStorage::commitWriteBatch(Batch& write_batch, rocksdb::WriteOptions const
   write_batch.Clear();
 }
 
+void DbStorage::commitPeriodWriteBatch(Batch& write_batch) {
+  if (!group_commit_max_periods_ || !group_commit_active_ || ++uncommitted_periods_ >= group_commit_max_periods_) {
+    commitWriteBatch(write_batch, sync_write_);
+    uncommitted_periods_ = 0;
+    return;
+  }
+  // Not synced batch still goes to WAL, so it survives process crash, only OS crash or power loss could revert it
+  commitWriteBatch(write_batch, async_write_);
+}
+
+void DbStorage::enableGroupCommit(uint32_t max_uncommitted_periods) {
+  group_commit_max_periods_ = max_uncommitted_periods;
+  if (group_commit_max_periods_) {
+    LOG(log_nf_) << "Group commit enabled, max uncommitted periods: " << group_commit_max_periods_;
+  }
+}
+
+void DbStorage::setGroupCommitActive(bool active) {
+  if (group_commit_active_.exchange(active) != active) {
+    LOG(log_dg_) << "Group commit " << (active ? "activated" : "deactivated");
+  }
+  // Periods committed without fsync are made durable as soon as syncing is over
+  if (!active) {
+    flushGroupCommit();
+  }
+}
+
+void DbStorage::flushGroupCommit() {
+  if (uncommitted_periods_.exchange(0)) {
+    checkStatus(db_->SyncWAL());
+  }
+}
+
 void DbStorage::DeleteRange(const Column& col, uint64_t begin, uint64_t end) {
   checkStatus(db_->DeleteRange(async_write_, handle(col), toSlice(begin), toSlice(end)));
 }
@@ -454,6 +571,44 @@ void DbStorage::CompactRange(const Column& col, uint64_t begin, uint64_t end) {
   checkStatus(db_->CompactRange({}, handle(col), &begin_slice, &end_slice));
 }
 
+std::vector<std::shared_ptr<rocksdb::PinnableSlice>> DbStorage::multiGet(std::vector<Slice> const& keys,
+                                                                         Column const& column,
+                                                                         const rocksdb::Snapshot* snapshot) const {
+  std::vector<std::shared_ptr<rocksdb::PinnableSlice>> ret(keys.size());
+  if (keys.empty()) {
+    return ret;
+  }
+  const auto cf = handle(column);
+  std::vector<size_t> order(keys.size());
+  std::iota(order.begin(), order.end(), 0);
+  std::sort(order.begin(), order.end(),
+            [&keys, comparator = cf->GetComparator()](size_t a, size_t b) {
+              return comparator->Compare(keys[a], keys[b]) < 0;
+            });
+  std::vector<Slice> sorted_keys;
+  sorted_keys.reserve(keys.size());
+  for (auto i : order) {
+    sorted_keys.push_back(keys[i]);
+  }
+
+  auto read_options = read_options_;
+  if (snapshot) {
+    read_options.snapshot = snapshot;
+  }
+  std::vector<rocksdb::PinnableSlice> values(keys.size());
+  std::vector<rocksdb::Status> statuses(keys.size());
+  db_->MultiGet(read_options, cf, sorted_keys.size(), sorted_keys.data(), values.data(), statuses.data(),
+                /* sorted_input */ true);
+  for (size_t i = 0; i < keys.size(); ++i) {
+    if (statuses[i].IsNotFound()) {
+      continue;
+    }
+    checkStatus(statuses[i]);
+    ret[order[i]] = std::make_shared<rocksdb::PinnableSlice>(std::move(values[i]));
+  }
+  return ret;
+}
+
 std::shared_ptr<DagBlock> DbStorage::getDagBlock(blk_hash_t const& hash) {
   auto block_data = asBytes(lookup(toSlice(hash.asBytes()), Columns::dag_blocks));
   if (block_data.size() > 0) {
@@ -471,6 +626,55 @@ std::shared_ptr<DagBlock> DbStorage::getDagBlock(blk_hash_t const& hash) {
   return nullptr;
 }
 
+std::vector<std::shared_ptr<DagBlock>> DbStorage::getDagBlocks(std::vector<blk_hash_t> const& hashes) {
+  // Block could be finalized and moved to period data in between of lookups otherwise
+  const rocksdb::ManagedSnapshot snapshot(db_.get());
+  std::vector<std::shared_ptr<DagBlock>> ret(hashes.size());
+  std::vector<blk_hash_t> finalized;
+  std::vector<size_t> finalized_pos;
+  const auto values = multiLookupPinned(hashes, Columns::dag_blocks, snapshot.snapshot());
+  for (size_t i = 0; i < hashes.size(); ++i) {
+    if (values[i] && !values[i]->empty()) {
+      ret[i] = std::make_shared<DagBlock>(sliceToRlp(*values[i]));
+    } else {
+      finalized.push_back(hashes[i]);
+      finalized_pos.push_back(i);
+    }
+  }
+  if (finalized.empty()) {
+    return ret;
+  }
+
+  // Period to pairs of block position in period data and position in result
+  std::map<PbftPeriod, std::vector<std::pair<uint32_t, size_t>>> by_period;
+  const auto locations = multiLookupPinned(finalized, Columns::dag_block_period, snapshot.snapshot());
+  for (size_t i = 0; i < finalized.size(); ++i) {
+    if (!locations[i] || locations[i]->empty()) {
+      continue;
+    }
+    const auto rlp = sliceToRlp(*locations[i]);
+    by_period[rlp[0].toInt<PbftPeriod>()].emplace_back(rlp[1].toInt<uint32_t>(), finalized_pos[i]);
+  }
+  std::vector<PbftPeriod> periods;
+  periods.reserve(by_period.size());
+  for (const auto& [period, _] : by_period) {
+    periods.push_back(period);
+  }
+  const auto periods_data = multiLookupPinned(periods, Columns::period_data, snapshot.snapshot());
+  size_t period_i = 0;
+  for (auto& [_, blocks] : by_period) {
+    const auto& period_data = periods_data[period_i++];
+    if (!period_data || period_data->empty()) {
+      continue;
+    }
+    const auto dag_blocks_rlp = sliceToRlp(*period_data)[DAG_BLOCKS_POS_IN_PERIOD_DATA];
+    for (const auto& [position, i] : blocks) {
+      ret[i] = decodeDAGBlockBundleRlp(position, dag_blocks_rlp);
+    }
+  }
+  return ret;
+}
+
 bool DbStorage::dagBlockInDb(blk_hash_t const& hash) {
   if (exist(toSlice(hash.asBytes()), Columns::dag_blocks) ||
       exist(toSlice(hash.asBytes()), Columns::dag_block_period)) {
@@ -496,15 +700,24 @@ level_t DbStorage::getLastBlocksLevel() const {
 }
 
 std::vector<std::shared_ptr<DagBlock>> DbStorage::getDagBlocksAtLevel(level_t level, int number_of_levels) {
-  std::vector<std::shared_ptr<DagBlock>> res;
+  std::vector<level_t> levels;
   for (int i = 0; i < number_of_levels; i++) {
     if (level + i == 0) continue;  // Skip genesis
-    auto block_hashes = getBlocksByLevel(level + i);
-    for (auto const& hash : block_hashes) {
-      auto blk = getDagBlock(hash);
-      if (blk) {
-        res.push_back(blk);
-      }
+    levels.push_back(level + i);
+  }
+  std::vector<blk_hash_t> block_hashes;
+  for (const auto& value : multiLookupPinned(levels, Columns::dag_blocks_level)) {
+    if (!value) {
+      continue;
+    }
+    const auto level_hashes = sliceToRlp(*value).toSet<blk_hash_t>();
+    block_hashes.insert(block_hashes.end(), level_hashes.begin(), level_hashes.end());
+  }
+  std::vector<std::shared_ptr<DagBlock>> res;
+  res.reserve(block_hashes.size());
+  for (auto& blk : getDagBlocks(block_hashes)) {
+    if (blk) {
+      res.push_back(std::move(blk));
     }
   }
   return res;
@@ -635,7 +848,88 @@ void DbStorage::savePeriodData(const PeriodData& period_data, Batch& write_batch
     trx_pos++;
   }
 
-  insert(write_batch, Columns::period_data, toSlice(period), toSlice(period_data.rlp()));
+  const auto period_data_rlp = period_data.rlp();
+  insert(write_batch, Columns::period_data, toSlice(period), toSlice(period_data_rlp));
+  insert(write_batch, Columns::period_data_offsets, toSlice(period), toSlice(periodDataOffsets(period_data_rlp)));
+}
+
+bytes DbStorage::periodDataOffsets(bytes const& period_data_rlp) {
+  const dev::RLP rlp(period_data_rlp);
+  const auto transactions_rlp = rlp[TRANSACTIONS_POS_IN_PERIOD_DATA];
+  std::vector<uint32_t> offsets;
+  offsets.reserve(ITEM_SIZE_IN_PERIOD_DATA_OFFSETS / sizeof(uint32_t) *
+                  (TRANSACTIONS_POS_IN_PERIOD_DATA_OFFSETS + transactions_rlp.itemCount()));
+  const auto add = [&](const dev::RLP& item) {
+    offsets.push_back(static_cast<uint32_t>(item.data().data() - period_data_rlp.data()));
+    offsets.push_back(static_cast<uint32_t>(item.data().size()));
+  };
+  add(rlp[PBFT_BLOCK_POS_IN_PERIOD_DATA]);
+  add(rlp[CERT_VOTES_POS_IN_PERIOD_DATA]);
+  for (const auto& transaction_rlp : transactions_rlp) {
+    add(transaction_rlp);
+  }
+
+  const auto offsets_data = reinterpret_cast<const ::byte*>(offsets.data());
+  return bytes(offsets_data, offsets_data + offsets.size() * sizeof(uint32_t));
+}
+
+DbStorage::PinnedPeriodData::PinnedPeriodData(std::shared_ptr<rocksdb::PinnableSlice> data,
+                                              std::shared_ptr<rocksdb::PinnableSlice> offsets)
+    : data_(std::move(data)), offsets_(std::move(offsets)) {
+  if (offsets_ && offsets_->empty()) {
+    offsets_.reset();
+  }
+  if (!empty() && !offsets_) {
+    transactions_rlp_ = sliceToRlp(*data_)[TRANSACTIONS_POS_IN_PERIOD_DATA];
+  }
+}
+
+dev::RLP DbStorage::PinnedPeriodData::item(size_t index) const {
+  uint32_t offset_size[2];
+  static_assert(sizeof(offset_size) == ITEM_SIZE_IN_PERIOD_DATA_OFFSETS);
+  memcpy(offset_size, offsets_->data() + index * ITEM_SIZE_IN_PERIOD_DATA_OFFSETS, ITEM_SIZE_IN_PERIOD_DATA_OFFSETS);
+  return dev::RLP(reinterpret_cast<const ::byte*>(data_->data()) + offset_size[0], offset_size[1]);
+}
+
+dev::RLP DbStorage::PinnedPeriodData::pbftBlock() const {
+  return offsets_ ? item(0) : sliceToRlp(*data_)[PBFT_BLOCK_POS_IN_PERIOD_DATA];
+}
+
+dev::RLP DbStorage::PinnedPeriodData::certVotes() const {
+  return offsets_ ? item(1) : sliceToRlp(*data_)[CERT_VOTES_POS_IN_PERIOD_DATA];
+}
+
+size_t DbStorage::PinnedPeriodData::transactionsCount() const {
+  if (empty()) {
+    return 0;
+  }
+  return offsets_ ? offsets_->size() / ITEM_SIZE_IN_PERIOD_DATA_OFFSETS - TRANSACTIONS_POS_IN_PERIOD_DATA_OFFSETS
+                  : transactions_rlp_.itemCount();
+}
+
+dev::RLP DbStorage::PinnedPeriodData::transaction(size_t position) const {
+  return offsets_ ? item(TRANSACTIONS_POS_IN_PERIOD_DATA_OFFSETS + position) : transactions_rlp_[position];
+}
+
+DbStorage::PinnedPeriodData DbStorage::getPeriodDataPinned(PbftPeriod period) const {
+  // Period data and its offsets are written in the same batch and never change afterwards
+  auto data = lookupPinned(toSlice(period), Columns::period_data);
+  if (!data) {
+    return {nullptr, nullptr};
+  }
+  return {std::move(data), lookupPinned(toSlice(period), Columns::period_data_offsets)};
+}
+
+std::vector<DbStorage::PinnedPeriodData> DbStorage::getPeriodsDataPinned(std::vector<PbftPeriod> const& periods,
+                                                                         const rocksdb::Snapshot* snapshot) const {
+  auto data = multiLookupPinned(periods, Columns::period_data, snapshot);
+  auto offsets = multiLookupPinned(periods, Columns::period_data_offsets, snapshot);
+  std::vector<PinnedPeriodData> ret;
+  ret.reserve(periods.size());
+  for (size_t i = 0; i < periods.size(); ++i) {
+    ret.emplace_back(std::move(data[i]), std::move(offsets[i]));
+  }
+  return ret;
 }
 
 dev::bytes DbStorage::getPeriodDataRaw(PbftPeriod period) const {
@@ -721,12 +1015,25 @@ std::optional<TransactionLocation> DbStorage::getTransactionLocation(trx_hash_t
   return std::nullopt;
 }
 
-std::vector<bool> DbStorage::transactionsFinalized(std::vector<trx_hash_t> const& trx_hashes) {
-  std::vector<bool> result(trx_hashes.size(), false);
-  for (size_t i = 0; i < trx_hashes.size(); ++i) {
-    if (exist(toSlice(trx_hashes[i].asBytes()), Columns::trx_period)) {
-      result[i] = true;
+std::vector<std::optional<TransactionLocation>> DbStorage::getTransactionLocations(
+    std::vector<trx_hash_t> const& hashes, const rocksdb::Snapshot* snapshot) const {
+  std::vector<std::optional<TransactionLocation>> ret;
+  ret.reserve(hashes.size());
+  for (const auto& value : multiLookupPinned(hashes, Columns::trx_period, snapshot)) {
+    if (!value || value->empty()) {
+      ret.emplace_back();
+      continue;
     }
+    ret.emplace_back(TransactionLocation::fromRlp(sliceToRlp(*value)));
+  }
+  return ret;
+}
+
+std::vector<bool> DbStorage::transactionsFinalized(std::vector<trx_hash_t> const& trx_hashes) {
+  std::vector<bool> result;
+  result.reserve(trx_hashes.size());
+  for (const auto& value : multiLookupPinned(trx_hashes, Columns::trx_period)) {
+    result.push_back(value && !value->empty());
   }
   return result;
 }
@@ -762,11 +1069,10 @@ std::vector<std::shared_ptr<PbftBlock>> DbStorage::getProposedPbftBlocks() {
 }
 
 std::optional<PbftBlock> DbStorage::getPbftBlock(PbftPeriod period) const {
-  auto period_data = getPeriodDataRaw(period);
+  const auto period_data = getPeriodDataPinned(period);
   // DB is corrupted if status point to missing or incorrect transaction
-  if (period_data.size() > 0) {
-    auto period_data_rlp = dev::RLP(period_data);
-    return std::optional<PbftBlock>(period_data_rlp[PBFT_BLOCK_POS_IN_PERIOD_DATA]);
+  if (!period_data.empty()) {
+    return std::optional<PbftBlock>(period_data.pbftBlock());
   }
   return {};
 }
@@ -795,44 +1101,112 @@ std::shared_ptr<Transaction> DbStorage::getTransaction(trx_hash_t const& hash) c
 }
 
 std::shared_ptr<Transaction> DbStorage::getTransaction(PbftPeriod period, uint32_t position) const {
-  auto period_data = getPeriodDataRaw(period);
-  if (period_data.size() > 0) {
-    auto period_data_rlp = dev::RLP(period_data);
-    auto transaction_data = period_data_rlp[TRANSACTIONS_POS_IN_PERIOD_DATA];
-    return std::make_shared<Transaction>(transaction_data[position]);
+  const auto period_data = getPeriodDataPinned(period);
+  if (position < period_data.transactionsCount()) {
+    return std::make_shared<Transaction>(period_data.transaction(position));
   }
   return nullptr;
 }
 
+SharedTransactions DbStorage::getTransactions(std::vector<trx_hash_t> const& hashes) const {
+  // Transaction could be finalized and moved to period data in between of lookups otherwise
+  const rocksdb::ManagedSnapshot snapshot(db_.get());
+  SharedTransactions ret(hashes.size());
+  std::vector<trx_hash_t> finalized;
+  std::vector<size_t> finalized_pos;
+  const auto values = multiLookupPinned(hashes, Columns::transactions, snapshot.snapshot());
+  for (size_t i = 0; i < hashes.size(); ++i) {
+    if (values[i] && !values[i]->empty()) {
+      ret[i] = std::make_shared<Transaction>(sliceToRlp(*values[i]));
+    } else {
+      finalized.push_back(hashes[i]);
+      finalized_pos.push_back(i);
+    }
+  }
+  if (finalized.empty()) {
+    return ret;
+  }
+
+  // Period to pairs of transaction position in period data and position in result
+  std::map<PbftPeriod, std::vector<std::pair<uint32_t, size_t>>> by_period;
+  std::vector<trx_hash_t> system;
+  std::vector<size_t> system_pos;
+  const auto locations = getTransactionLocations(finalized, snapshot.snapshot());
+  for (size_t i = 0; i < finalized.size(); ++i) {
+    if (locations[i] && !locations[i]->is_system) {
+      by_period[locations[i]->period].emplace_back(locations[i]->position, finalized_pos[i]);
+    } else {
+      system.push_back(finalized[i]);
+      system_pos.push_back(finalized_pos[i]);
+    }
+  }
+
+  std::vector<PbftPeriod> periods;
+  periods.reserve(by_period.size());
+  for (const auto& [period, _] : by_period) {
+    periods.push_back(period);
+  }
+  const auto periods_data = getPeriodsDataPinned(periods, snapshot.snapshot());
+  size_t period_i = 0;
+  for (auto& [_, trxs] : by_period) {
+    const auto& period_data = periods_data[period_i++];
+    // Ascending positions let RLP continue from the previous item instead of walking from the list start
+    std::sort(trxs.begin(), trxs.end());
+    for (const auto& [position, i] : trxs) {
+      if (position < period_data.transactionsCount()) {
+        ret[i] = std::make_shared<Transaction>(period_data.transaction(position));
+      }
+    }
+  }
+
+  const auto system_values = multiLookupPinned(system, Columns::system_transaction, snapshot.snapshot());
+  for (size_t i = 0; i < system.size(); ++i) {
+    if (system_values[i] && !system_values[i]->empty()) {
+      // construct as system transaction to have proper sender
+      ret[system_pos[i]] = std::make_shared<SystemTransaction>(sliceToRlp(*system_values[i]));
+    }
+  }
+  return ret;
+}
+
 uint64_t DbStorage::getTransactionCount(PbftPeriod period) const {
-  auto period_data = getPeriodDataRaw(period);
-  if (period_data.size()) {
-    auto period_data_rlp = dev::RLP(period_data);
-    return period_data_rlp[TRANSACTIONS_POS_IN_PERIOD_DATA].itemCount();
+  // Offsets are enough to count transactions, period data is read only for periods saved without them
+  if (const auto offsets = lookupPinned(toSlice(period), Columns::period_data_offsets); offsets && !offsets->empty()) {
+    return offsets->size() / ITEM_SIZE_IN_PERIOD_DATA_OFFSETS - TRANSACTIONS_POS_IN_PERIOD_DATA_OFFSETS;
   }
-  return 0;
+  return getPeriodDataPinned(period).transactionsCount();
 }
 
 SharedTransactions DbStorage::getFinalizedTransactions(std::vector<trx_hash_t> const& trx_hashes) const {
-  SharedTransactions trxs;
+  const rocksdb::ManagedSnapshot snapshot(db_.get());
   // Map of period to position of transactions within a period
   std::map<PbftPeriod, std::set<uint32_t>> period_map;
-  trxs.reserve(trx_hashes.size());
-  for (auto const& tx_hash : trx_hashes) {
-    auto trx_period = getTransactionLocation(tx_hash);
-    if (trx_period.has_value()) {
-      period_map[trx_period->period].insert(trx_period->position);
+  for (const auto& location : getTransactionLocations(trx_hashes, snapshot.snapshot())) {
+    if (location.has_value()) {
+      period_map[location->period].insert(location->position);
     }
   }
-  for (auto it : period_map) {
-    const auto period_data = getPeriodDataRaw(it.first);
-    if (!period_data.size()) {
+  std::vector<PbftPeriod> periods;
+  periods.reserve(period_map.size());
+  for (const auto& [period, _] : period_map) {
+    periods.push_back(period);
+  }
+  const auto periods_data = getPeriodsDataPinned(periods, snapshot.snapshot());
+
+  SharedTransactions trxs;
+  trxs.reserve(trx_hashes.size());
+  size_t period_i = 0;
+  for (const auto& [_, positions] : period_map) {
+    const auto& period_data = periods_data[period_i++];
+    if (period_data.empty()) {
       assert(false);
+      continue;
     }
 
-    auto const transactions_rlp = dev::RLP(period_data)[TRANSACTIONS_POS_IN_PERIOD_DATA];
-    for (auto pos : it.second) {
-      trxs.emplace_back(std::make_shared<Transaction>(transactions_rlp[pos]));
+    for (auto pos : positions) {
+      if (pos < period_data.transactionsCount()) {
+        trxs.emplace_back(std::make_shared<Transaction>(period_data.transaction(pos)));
+      }
     }
   }
 
@@ -882,13 +1256,12 @@ SharedTransactions DbStorage::getPeriodSystemTransactions(PbftPeriod period) con
 }
 
 std::vector<std::shared_ptr<PbftVote>> DbStorage::getPeriodCertVotes(PbftPeriod period) const {
-  auto period_data = getPeriodDataRaw(period);
+  const auto period_data = getPeriodDataPinned(period);
   if (period_data.empty()) {
     return {};
   }
 
-  auto period_data_rlp = dev::RLP(period_data);
-  auto votes_rlp = period_data_rlp[CERT_VOTES_POS_IN_PERIOD_DATA];
+  const auto votes_rlp = period_data.certVotes();
   if (votes_rlp.itemCount() == 0) {
     return {};
   }
@@ -936,6 +1309,175 @@ SharedTransactionReceipts DbStorage::getBlockReceipts(PbftPeriod period) const {
       util::rlp_dec<std::vector<TransactionReceipt>>(dev::RLP(raw)));
 }
 
+std::vector<SharedTransactionReceipts> DbStorage::getBlocksReceipts(std::vector<PbftPeriod> const& periods) const {
+  std::vector<SharedTransactionReceipts> ret;
+  ret.reserve(periods.size());
+  for (const auto& raw : multiLookup(periods, DbStorage::Columns::final_chain_receipt_by_period)) {
+    if (raw.empty()) {
+      ret.emplace_back();
+      continue;
+    }
+    ret.emplace_back(std::make_shared<std::vector<TransactionReceipt>>(
+        util::rlp_dec<std::vector<TransactionReceipt>>(dev::RLP(raw))));
+  }
+  return ret;
+}
+
+namespace {
+
+SharedBlockReceiptsView makeBlockReceiptsView(std::shared_ptr<rocksdb::PinnableSlice> value) {
+  if (!value || value->empty()) {
+    return {};
+  }
+  const dev::bytesConstRef data(reinterpret_cast<const ::byte*>(value->data()), value->size());
+  return std::make_shared<BlockReceiptsView>(std::move(value), data);
+}
+
+}  // namespace
+
+SharedBlockReceiptsView DbStorage::getBlockReceiptsView(PbftPeriod period) const {
+  return makeBlockReceiptsView(lookupPinned(toSlice(period), DbStorage::Columns::final_chain_receipt_by_period));
+}
+
+std::vector<SharedBlockReceiptsView> DbStorage::getBlocksReceiptsViews(std::vector<PbftPeriod> const& periods) const {
+  std::vector<SharedBlockReceiptsView> ret;
+  ret.reserve(periods.size());
+  for (auto& value : multiLookupPinned(periods, DbStorage::Columns::final_chain_receipt_by_period)) {
+    ret.push_back(makeBlockReceiptsView(std::move(value)));
+  }
+  return ret;
+}
+
+namespace {
+
+constexpr size_t kLogLocationSize = sizeof(PbftPeriod) + 2 * sizeof(uint32_t);
+
+// Numbers are big endian in logs index keys, so entries of the same address/topic are ordered by location
+void appendBigEndian(bytes& key, uint64_t value, size_t size) {
+  for (size_t i = size; i-- > 0;) {
+    key.push_back(static_cast<::byte>(value >> (i * 8)));
+  }
+}
+
+uint64_t readBigEndian(const char* data, size_t size) {
+  uint64_t value = 0;
+  for (size_t i = 0; i < size; ++i) {
+    value = (value << 8) | static_cast<uint8_t>(data[i]);
+  }
+  return value;
+}
+
+bytes logsIndexKey(const bytes& prefix, PbftPeriod period, uint32_t trx_position, uint32_t log_position) {
+  bytes key;
+  key.reserve(prefix.size() + kLogLocationSize);
+  key.insert(key.end(), prefix.begin(), prefix.end());
+  appendBigEndian(key, period, sizeof(period));
+  appendBigEndian(key, trx_position, sizeof(trx_position));
+  appendBigEndian(key, log_position, sizeof(log_position));
+  return key;
+}
+
+bytes addressPrefix(const Address& address) { return address.asBytes(); }
+
+bytes topicPrefix(const h256& topic, uint8_t topic_position) {
+  auto prefix = topic.asBytes();
+  prefix.push_back(topic_position);
+  return prefix;
+}
+
+}  // namespace
+
+void DbStorage::addLogsIndexToBatch(Batch& write_batch, PbftPeriod period, TransactionReceipts const& receipts) {
+  for (uint32_t trx_position = 0; trx_position < receipts.size(); ++trx_position) {
+    const auto& logs = receipts[trx_position].logs;
+    for (uint32_t log_position = 0; log_position < logs.size(); ++log_position) {
+      const auto& log = logs[log_position];
+      insert(write_batch, Columns::final_chain_logs_by_address,
+             logsIndexKey(addressPrefix(log.address), period, trx_position, log_position), Slice());
+      for (uint8_t i = 0; i < log.topics.size(); ++i) {
+        insert(write_batch, Columns::final_chain_logs_by_topic,
+               logsIndexKey(topicPrefix(log.topics[i], i), period, trx_position, log_position), Slice());
+      }
+    }
+  }
+}
+
+std::vector<LogLocation> DbStorage::getLogLocations(Column const& column, std::vector<bytes> const& prefixes,
+                                                    PbftPeriod from, PbftPeriod to) const {
+  std::vector<LogLocation> ret;
+  std::unique_ptr<rocksdb::Iterator> it(db_->NewIterator(read_options_, handle(column)));
+  for (const auto& prefix : prefixes) {
+    const auto begin = logsIndexKey(prefix, from, 0, 0);
+    constexpr auto kMaxPosition = std::numeric_limits<uint32_t>::max();
+    const auto end = logsIndexKey(prefix, to, kMaxPosition, kMaxPosition);
+    for (it->Seek(toSlice(begin)); it->Valid() && it->key().compare(toSlice(end)) <= 0; it->Next()) {
+      const auto* location = it->key().data() + prefix.size();
+      ret.push_back({readBigEndian(location, sizeof(PbftPeriod)),
+                     static_cast<uint32_t>(readBigEndian(location + sizeof(PbftPeriod), sizeof(uint32_t))),
+                     static_cast<uint32_t>(
+                         readBigEndian(location + sizeof(PbftPeriod) + sizeof(uint32_t), sizeof(uint32_t)))});
+    }
+    checkStatus(it->status());
+  }
+  // Log is indexed only once per address and per topic position, so locations of different prefixes don't overlap
+  std::sort(ret.begin(), ret.end());
+  return ret;
+}
+
+uint64_t DbStorage::estimateLogLocations(Column const& column, std::vector<bytes> const& prefixes, PbftPeriod from,
+                                         PbftPeriod to) const {
+  std::vector<bytes> keys;
+  keys.reserve(prefixes.size() * 2);
+  std::vector<rocksdb::Range> ranges;
+  ranges.reserve(prefixes.size());
+  for (const auto& prefix : prefixes) {
+    keys.push_back(logsIndexKey(prefix, from, 0, 0));
+    keys.push_back(logsIndexKey(prefix, to + 1, 0, 0));
+  }
+  for (size_t i = 0; i < prefixes.size(); ++i) {
+    ranges.emplace_back(toSlice(keys[2 * i]), toSlice(keys[2 * i + 1]));
+  }
+  std::vector<uint64_t> sizes(ranges.size());
+  rocksdb::SizeApproximationOptions options;
+  options.include_memtables = true;
+  checkStatus(db_->GetApproximateSizes(options, handle(column), ranges.data(), ranges.size(), sizes.data()));
+  uint64_t count = 0;
+  for (size_t i = 0; i < prefixes.size(); ++i) {
+    count += sizes[i] / (prefixes[i].size() + kLogLocationSize);
+  }
+  return count;
+}
+
+std::vector<LogLocation> DbStorage::getLogLocationsByAddresses(std::vector<Address> const& addresses,
+                                                               PbftPeriod from, PbftPeriod to) const {
+  std::vector<bytes> prefixes;
+  std::transform(addresses.begin(), addresses.end(), std::back_inserter(prefixes), addressPrefix);
+  return getLogLocations(Columns::final_chain_logs_by_address, prefixes, from, to);
+}
+
+std::vector<LogLocation> DbStorage::getLogLocationsByTopics(std::vector<h256> const& topics, uint8_t topic_position,
+                                                            PbftPeriod from, PbftPeriod to) const {
+  std::vector<bytes> prefixes;
+  std::transform(topics.begin(), topics.end(), std::back_inserter(prefixes),
+                 [topic_position](const auto& topic) { return topicPrefix(topic, topic_position); });
+  return getLogLocations(Columns::final_chain_logs_by_topic, prefixes, from, to);
+}
+
+uint64_t DbStorage::estimateLogLocationsByAddresses(std::vector<Address> const& addresses, PbftPeriod from,
+                                                    PbftPeriod to) const {
+  std::vector<bytes> prefixes;
+  std::transform(addresses.begin(), addresses.end(), std::back_inserter(prefixes), addressPrefix);
+  return estimateLogLocations(Columns::final_chain_logs_by_address, prefixes, from, to);
+}
+
+uint64_t DbStorage::estimateLogLocationsByTopics(std::vector<h256> const& topics, uint8_t topic_position,
+                                                 PbftPeriod from, PbftPeriod to) const {
+  std::vector<bytes> prefixes;
+  std::transform(topics.begin(), topics.end(), std::back_inserter(prefixes),
+                 [topic_position](const auto& topic) { return topicPrefix(topic, topic_position); });
+  return estimateLogLocations(Columns::final_chain_logs_by_topic, prefixes, from, to);
+}
+
 std::vector<std::shared_ptr<PillarVote>> DbStorage::getPeriodPillarVotes(PbftPeriod period) const {
   const auto period_data = getPeriodDataRaw(period);
   if (!period_data.size()) {
@@ -968,13 +1510,23 @@ bool DbStorage::transactionFinalized(trx_hash_t const& hash) {
 }
 
 std::vector<bool> DbStorage::transactionsInDb(std::vector<trx_hash_t> const& trx_hashes) {
+  const rocksdb::ManagedSnapshot snapshot(db_.get());
   std::vector<bool> result(trx_hashes.size(), false);
+  std::vector<trx_hash_t> not_found;
+  std::vector<size_t> not_found_pos;
+  const auto values = multiLookupPinned(trx_hashes, Columns::transactions, snapshot.snapshot());
   for (size_t i = 0; i < trx_hashes.size(); ++i) {
-    const auto key = trx_hashes[i].asBytes();
-    if (exist(toSlice(key), Columns::transactions) || exist(toSlice(key), Columns::trx_period)) {
+    if (values[i] && !values[i]->empty()) {
       result[i] = true;
+    } else {
+      not_found.push_back(trx_hashes[i]);
+      not_found_pos.push_back(i);
     }
   }
+  const auto locations = multiLookupPinned(not_found, Columns::trx_period, snapshot.snapshot());
+  for (size_t i = 0; i < not_found.size(); ++i) {
+    result[not_found_pos[i]] = locations[i] && !locations[i]->empty();
+  }
   return result;
 }
 
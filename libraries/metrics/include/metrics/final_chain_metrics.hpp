@@ -0,0 +1,25 @@
+#pragma once
+
+#include "metrics/metrics_group.hpp"
+
+namespace taraxa::metrics {
+class FinalChainMetrics : public MetricsGroup {
+ public:
+  inline static const std::string group_name = "final_chain";
+  FinalChainMetrics(std::shared_ptr<prometheus::Registry> registry) : MetricsGroup(std::move(registry)) {}
+  ADD_GAUGE_METRIC_WITH_UPDATER(setPrepareDuration, "prepare_duration_us",
+                                "Duration of transactions preparation stage of the last finalized period")
+  ADD_GAUGE_METRIC_WITH_UPDATER(setExecuteDuration, "execute_duration_us",
+                                "Duration of EVM execution stage of the last finalized period")
+  ADD_GAUGE_METRIC_WITH_UPDATER(setSealDuration, "seal_duration_us",
+                                "Duration of receipts and tries construction stage of the last finalized period")
+  ADD_GAUGE_METRIC_WITH_UPDATER(setRewardsDuration, "rewards_duration_us",
+                                "Duration of rewards distribution stage of the last finalized period")
+  ADD_GAUGE_METRIC_WITH_UPDATER(setCommitDuration, "commit_duration_us",
+                                "Duration of DB and state commit stage of the last finalized period")
+  ADD_GAUGE_METRIC_WITH_UPDATER(setCacheHits, "cache_hits", "Number of block caches lookups served from memory")
+  ADD_GAUGE_METRIC_WITH_UPDATER(setCacheMisses, "cache_misses", "Number of block caches lookups read from database")
+  ADD_GAUGE_METRIC_WITH_UPDATER(setCacheEvictions, "cache_evictions",
+                                "Number of entries evicted from block caches of older blocks")
+};
+}  // namespace taraxa::metrics
@@ -10,6 +10,10 @@ class JsonRpcMetrics : public MetricsGroup {
   const std::vector<double> buckets = {1000, 10000, 100000, 1000000, 10000000};
 
   ADD_HISTOGRAM_METRIC(setJsonRpcRequestDuration, "request_duration", "RPC request duration", buckets)
+  ADD_HISTOGRAM_METRIC(setWsFanoutDuration, "ws_fanout_duration",
+                       "Duration of WebSocket subscription event fan-out to all sessions", buckets)
+  ADD_HISTOGRAM_METRIC(setWsDeliveryLatency, "ws_delivery_latency",
+                       "Latency from WebSocket subscription event to its write to the session socket", buckets)
 
   // Extracting methods using string manipulation instead of JSON parsing for speed
   void report(const std::string &request, const std::string &ip, const std::string &connection,
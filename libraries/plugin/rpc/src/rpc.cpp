@@ -56,6 +56,9 @@ void Rpc::start() {
     eth_rpc_params.chain_id = conf.genesis.chain_id;
     eth_rpc_params.gas_limit = conf.genesis.dag.gas_limit;
     eth_rpc_params.final_chain = app()->getFinalChain();
+    eth_rpc_params.logs_query_threads = conf.network.rpc->logs_query_threads;
+    eth_rpc_params.logs_query_max_blocks = conf.network.rpc->logs_query_max_blocks;
+    eth_rpc_params.logs_query_max_results = conf.network.rpc->logs_query_max_results;
     eth_rpc_params.gas_pricer = [gas_pricer = app()->getGasPricer()]() { return gas_pricer->bid(); };
     eth_rpc_params.get_earliest_block = [db = app()->getDB()]() { return db->getEarliestBlockNumber(); };
     eth_rpc_params.get_trx = [db = app()->getDB()](auto const &trx_hash) { return db->getTransaction(trx_hash); };
@@ -103,7 +106,48 @@ void Rpc::start() {
         eth_json_rpc, test_json_rpc, debug_json_rpc);
 
     if (conf.network.rpc->http_port) {
-      auto json_rpc_processor = std::make_shared<net::JsonRpcHttpProcessor>();
+      auto json_rpc_processor = std::make_shared<net::JsonRpcHttpProcessor>(
+          rpc_thread_pool_,
+          net::JsonRpcHttpProcessor::BatchLimits{conf.network.rpc->batch_max_size,
+                                                 std::chrono::milliseconds(conf.network.rpc->batch_timeout_ms)},
+          conf.network.rpc->stream_buffer_size);
+      // Streamed methods keep params validation of the procedures registered in the handler
+      const auto get_procedure = [](const auto &api, std::string_view name) {
+        for (const auto &method : api.methods()) {
+          if (std::get<0>(method).GetProcedureName() == name) {
+            return std::get<0>(method);
+          }
+        }
+        throw std::runtime_error("Unknown RPC method " + std::string(name));
+      };
+      // Potentially huge responses are streamed instead of being built in memory
+      json_rpc_processor->addStreamingMethod(
+          get_procedure(*eth_json_rpc, "eth_getLogs"),
+          [eth = as_weak(eth_json_rpc)](const Json::Value &params, net::JsonStreamWriter &writer) {
+            auto eth_json_rpc = eth.lock();
+            if (!eth_json_rpc) {
+              throw std::runtime_error("Eth API is not available");
+            }
+            writer.beginArray();
+            eth_json_rpc->getLogs(params[0], [&writer](const net::rpc::eth::LocalisedLogEntry &lle) {
+              writer.writeArrayItem(net::rpc::eth::toJson(lle));
+            });
+            writer.endArray();
+          });
+      if (debug_json_rpc) {
+        for (const auto method : net::Debug::kTraceMethods) {
+          json_rpc_processor->addStreamingMethod(
+              get_procedure(*debug_json_rpc, method),
+              [debug = as_weak(debug_json_rpc), method = std::string(method)](const Json::Value &params,
+                                                                              net::JsonStreamWriter &writer) {
+                auto debug_json_rpc = debug.lock();
+                if (!debug_json_rpc) {
+                  throw std::runtime_error("Debug API is not available");
+                }
+                writer.write(debug_json_rpc->trace(method, params));
+              });
+        }
+      }
       jsonrpc_http_ = std::make_shared<net::HttpServer>(
           rpc_thread_pool_->unsafe_get_io_context(),
           boost::asio::ip::tcp::endpoint{conf.network.rpc->address, *conf.network.rpc->http_port}, app()->getAddress(),
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <compare>
+
 #include "common/encoding_rlp.hpp"
 #include "common/types.hpp"
 
@@ -53,4 +55,87 @@ struct TransactionLocation {
 
 using SharedTransactionReceipts = std::shared_ptr<std::vector<TransactionReceipt>>;
 
+/**
+ * @brief Non-owning view of RLP encoded LogEntry, fields are decoded on access
+ */
+class LogEntryView {
+ public:
+  explicit LogEntryView(dev::RLP rlp) : rlp_(rlp) {}
+
+  Address address() const { return rlp_[0].toHash<Address>(); }
+  size_t topicsCount() const { return rlp_[1].itemCount(); }
+  h256 topic(size_t i) const { return rlp_[1][i].toHash<h256>(); }
+  dev::bytesConstRef data() const { return rlp_[2].toBytesConstRef(); }
+
+  LogBloom bloom() const;
+  LogEntry decode() const { return util::rlp_dec<LogEntry>(rlp_); }
+
+ private:
+  dev::RLP rlp_;
+};
+
+/**
+ * @brief View of RLP encoded TransactionReceipt, fields are decoded on access. Keeps alive the buffer it points to,
+ * so it could outlive the block view it was taken from
+ * @note Not thread safe, dev::RLP caches last accessed item. Copy is cheap and could be used from another thread
+ */
+class TransactionReceiptView {
+ public:
+  TransactionReceiptView(std::shared_ptr<const void> owner, dev::bytesConstRef data)
+      : owner_(std::move(owner)), rlp_(data) {}
+
+  uint8_t statusCode() const { return rlp_[0].toInt<uint8_t>(); }
+  uint64_t gasUsed() const { return rlp_[1].toInt<uint64_t>(); }
+  uint64_t cumulativeGasUsed() const { return rlp_[2].toInt<uint64_t>(); }
+  size_t logsCount() const { return rlp_[3].itemCount(); }
+  LogEntryView log(size_t i) const { return LogEntryView(rlp_[3][i]); }
+  std::optional<Address> newContractAddress() const;
+
+  /// Calls cb with view of every log entry in order, cheaper than log(i) in a loop
+  template <typename Callback>
+  void forEachLog(Callback&& cb) const {
+    size_t i = 0;
+    for (const auto& log_rlp : rlp_[3]) {
+      cb(i++, LogEntryView(log_rlp));
+    }
+  }
+
+  LogBloom bloom() const;
+  TransactionReceipt decode() const { return util::rlp_dec<TransactionReceipt>(rlp_); }
+
+ private:
+  std::shared_ptr<const void> owner_;
+  dev::RLP rlp_;
+};
+
+/**
+ * @brief View of RLP encoded receipts of the whole block. Buffer is split into receipts once, so that random access
+ * is constant time and doesn't touch shared state
+ */
+class BlockReceiptsView {
+ public:
+  BlockReceiptsView(std::shared_ptr<const void> owner, dev::bytesConstRef data);
+
+  size_t size() const { return receipts_.size(); }
+  bool empty() const { return receipts_.empty(); }
+  TransactionReceiptView at(size_t i) const { return {owner_, receipts_.at(i)}; }
+  TransactionReceiptView operator[](size_t i) const { return {owner_, receipts_[i]}; }
+  TransactionReceipts decode() const;
+
+ private:
+  std::shared_ptr<const void> owner_;
+  std::vector<dev::bytesConstRef> receipts_;
+};
+
+using SharedBlockReceiptsView = std::shared_ptr<const BlockReceiptsView>;
+
+// Position of log entry in the chain
+struct LogLocation {
+  EthBlockNumber period = 0;
+  uint32_t trx_position = 0;
+  uint32_t log_position = 0;
+
+  auto operator<=>(const LogLocation&) const = default;
+};
+
 }  // namespace taraxa
\ No newline at end of file
@@ -72,6 +72,12 @@ struct Transaction {
 
   virtual const addr_t &getSender() const;
 
+  /**
+   * @brief Recovers and caches sender, unlike getSender it does not throw on invalid signature
+   * @return true if signature is valid
+   */
+  bool recoverSender() const;
+
   bool operator==(Transaction const &other) const { return getHash() == other.getHash(); }
 
   const bytes &rlp() const;
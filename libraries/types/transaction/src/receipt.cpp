@@ -25,4 +25,45 @@ LogBloom TransactionReceipt::bloom() const {
   return ret;
 }
 
+LogBloom LogEntryView::bloom() const {
+  LogBloom ret;
+  ret.shiftBloom<3>(dev::sha3(rlp_[0].payload()));
+  for (const auto& t : rlp_[1]) {
+    ret.shiftBloom<3>(dev::sha3(t.payload()));
+  }
+  return ret;
+}
+
+std::optional<Address> TransactionReceiptView::newContractAddress() const {
+  const auto address = rlp_[4];
+  if (address.isNull() || address.isEmpty()) {
+    return {};
+  }
+  return address.toHash<Address>();
+}
+
+LogBloom TransactionReceiptView::bloom() const {
+  LogBloom ret;
+  forEachLog([&ret](size_t, const LogEntryView& log) { ret |= log.bloom(); });
+  return ret;
+}
+
+BlockReceiptsView::BlockReceiptsView(std::shared_ptr<const void> owner, dev::bytesConstRef data)
+    : owner_(std::move(owner)) {
+  const dev::RLP rlp(data);
+  receipts_.reserve(rlp.itemCount());
+  for (const auto& receipt : rlp) {
+    receipts_.push_back(receipt.data());
+  }
+}
+
+TransactionReceipts BlockReceiptsView::decode() const {
+  TransactionReceipts ret;
+  ret.reserve(receipts_.size());
+  for (const auto& receipt : receipts_) {
+    ret.push_back(util::rlp_dec<TransactionReceipt>(dev::RLP(receipt)));
+  }
+  return ret;
+}
+
 }  // namespace taraxa
@@ -119,6 +119,11 @@ const addr_t &Transaction::getSender() const {
                          "\nOriginal RLP: " + (cached_rlp_set_ ? dev::toJS(cached_rlp_) : "wasn't created from rlp"));
 }
 
+bool Transaction::recoverSender() const {
+  get_sender_();
+  return sender_valid_;
+}
+
 void Transaction::streamRLP(dev::RLPStream &s, bool for_signature) const {
   s.appendList(!for_signature || chain_id_ ? 9 : 6);
   s << nonce_ << gas_price_ << gas_;
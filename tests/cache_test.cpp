@@ -122,6 +122,84 @@ TEST_F(CacheTest, map_overwrite) {
   EXPECT_EQ(cache.blocksSize(), 3);
 }
 
+TEST_F(CacheTest, tiny_lfu_admission) {
+  // Single shard with space for 10 entries of 100 bytes
+  const size_t entry_size = 100;
+  using Cache = TinyLfuCache<uint64_t, uint64_t>;
+  Cache cache(10 * (entry_size + sizeof(uint64_t) * 3 + 64), [entry_size](const uint64_t &) { return entry_size; }, 1);
+
+  // Make some keys hot
+  for (uint64_t key = 0; key < 5; ++key) {
+    for (uint32_t i = 0; i < 10; ++i) {
+      if (!cache.get(key)) {
+        cache.put(key, key);
+      }
+    }
+  }
+
+  // One-off scan over many keys must not flush hot keys
+  for (uint64_t key = 100; key < 1000; ++key) {
+    if (!cache.get(key)) {
+      cache.put(key, key);
+    }
+  }
+  for (uint64_t key = 0; key < 5; ++key) {
+    EXPECT_EQ(cache.get(key), key);
+  }
+  EXPECT_EQ(cache.evictions(), 0);
+
+  // Key accessed more often than the least recently used one replaces it
+  for (uint32_t i = 0; i < 3; ++i) {
+    EXPECT_FALSE(cache.get(2000));
+  }
+  cache.put(2000, 2000);
+  EXPECT_EQ(cache.evictions(), 1);
+  EXPECT_EQ(cache.get(2000), 2000);
+  for (uint64_t key = 0; key < 5; ++key) {
+    EXPECT_EQ(cache.get(key), key);
+  }
+}
+
+TEST_F(CacheTest, historical_values) {
+  uint64_t getter_calls = 0;
+  ValueByBlockCache<uint64_t> cache(
+      2,
+      [&getter_calls](uint64_t a) {
+        getter_calls++;
+        return a;
+      },
+      1024 * 1024);
+
+  EXPECT_EQ(cache.get(10), 10);
+  EXPECT_EQ(cache.get(11), 11);
+  EXPECT_EQ(getter_calls, 2);
+
+  // Block 1 is older than recent blocks window, it is kept in historical cache
+  EXPECT_EQ(cache.get(1), 1);
+  EXPECT_EQ(getter_calls, 3);
+  EXPECT_EQ(cache.get(1), 1);
+  EXPECT_EQ(cache.getFromCache(1), 1);
+  EXPECT_EQ(getter_calls, 3);
+
+  const auto stats = cache.stats();
+  EXPECT_EQ(stats.misses, 3);
+  EXPECT_EQ(stats.hits, 2);
+
+  MapByBlockCache<uint64_t, uint64_t> map_cache(
+      2,
+      [&getter_calls](uint64_t a, uint64_t b) {
+        getter_calls++;
+        return a + b;
+      },
+      1024 * 1024);
+  getter_calls = 0;
+  EXPECT_EQ(map_cache.get(10, 1), 11);
+  EXPECT_EQ(map_cache.get(1, 1), 2);
+  EXPECT_EQ(map_cache.get(1, 1), 2);
+  EXPECT_EQ(map_cache.get(1, 2), 3);
+  EXPECT_EQ(getter_calls, 3);
+}
+
 }  // namespace taraxa::final_chain
 
 TARAXA_TEST_MAIN({})
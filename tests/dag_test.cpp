@@ -1,5 +1,12 @@
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <boost/graph/adjacency_list.hpp>
+#include <boost/graph/labeled_graph.hpp>
+#include <chrono>
+#include <random>
+#include <stack>
+
 #include "common/init.hpp"
 #include "common/types.hpp"
 #include "dag/dag_manager.hpp"
@@ -491,6 +498,171 @@ TEST_F(DagTest, initial_pivot) {
   EXPECT_TRUE(pt->second.empty());
   EXPECT_EQ(pt->first, node_cfgs[0].genesis.dag_genesis_block.getHash());
 }
+// Reference GHOST path on boost labeled graph which was used for the pivot tree before the compact graph
+std::vector<blk_hash_t> boostGhostPath(
+    const boost::labeled_graph<boost::adjacency_list<boost::setS, boost::hash_setS, boost::directedS, blk_hash_t>,
+                               blk_hash_t, boost::hash_mapS>& graph,
+    const blk_hash_t& root_hash) {
+  auto root = graph.vertex(root_hash);
+  std::vector<decltype(root)> post_order;
+  std::stack<decltype(root)> st;
+  st.emplace(root);
+  while (!st.empty()) {
+    auto cur = st.top();
+    st.pop();
+    post_order.emplace_back(cur);
+    for (auto [s, e] = boost::adjacent_vertices(cur, graph); s != e; s++) {
+      st.emplace(*s);
+    }
+  }
+  std::reverse(post_order.begin(), post_order.end());
+  std::unordered_map<decltype(root), size_t> weight_map;
+  for (auto const& n : post_order) {
+    size_t total_w = 0;
+    for (auto [s, e] = boost::adjacent_vertices(n, graph); s != e; s++) {
+      total_w += weight_map[*s];
+    }
+    weight_map[n] = total_w + 1;
+  }
+  std::vector<blk_hash_t> pivot_chain;
+  while (true) {
+    pivot_chain.emplace_back(graph.graph()[root]);
+    size_t heaviest = 0;
+    auto next = root;
+    for (auto [s, e] = boost::adjacent_vertices(root, graph); s != e; s++) {
+      const auto w = weight_map[*s];
+      if (w > heaviest || (w == heaviest && graph.graph()[*s] < graph.graph()[next])) {
+        heaviest = w;
+        next = *s;
+      }
+    }
+    if (heaviest == 0) break;
+    root = next;
+  }
+  return pivot_chain;
+}
+
+TEST_F(DagTest, compact_dag_benchmark) {
+  const blk_hash_t GENESIS(1);
+  const uint32_t blocks_count = 20000;
+  const uint32_t parents_window = 20;
+  std::mt19937 rng(1);
+
+  std::vector<blk_hash_t> blocks{GENESIS};
+  std::vector<std::pair<blk_hash_t, std::vector<blk_hash_t>>> edges;
+  for (uint32_t i = 0; i < blocks_count; ++i) {
+    const auto window = std::min<uint32_t>(blocks.size(), parents_window);
+    const auto pivot = blocks[blocks.size() - 1 - rng() % window];
+    std::vector<blk_hash_t> tips;
+    for (uint32_t t = rng() % 3; t > 0; --t) {
+      const auto tip = blocks[blocks.size() - 1 - rng() % window];
+      if (tip != pivot && std::find(tips.begin(), tips.end(), tip) == tips.end()) {
+        tips.push_back(tip);
+      }
+    }
+    blocks.emplace_back(blk_hash_t::random());
+    edges.push_back({pivot, std::move(tips)});
+  }
+
+  const auto elapsed_us = [](auto start) {
+    return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+  };
+
+  // Compact graph
+  auto now = std::chrono::steady_clock::now();
+  taraxa::Dag total_dag(GENESIS, addr_t());
+  taraxa::PivotTree pivot_tree(GENESIS, addr_t());
+  for (uint32_t i = 0; i < blocks_count; ++i) {
+    total_dag.addVEEs(blocks[i + 1], edges[i].first, edges[i].second);
+    pivot_tree.addVEEs(blocks[i + 1], edges[i].first, {});
+  }
+  const auto insert_us = elapsed_us(now);
+
+  now = std::chrono::steady_clock::now();
+  const auto ghost_path = pivot_tree.getGhostPath(GENESIS);
+  const auto ghost_us = elapsed_us(now);
+
+  std::map<uint64_t, std::unordered_set<blk_hash_t>> non_finalized_blks;
+  for (uint32_t i = 1; i < blocks.size(); ++i) {
+    non_finalized_blks[i / parents_window].insert(blocks[i]);
+  }
+  std::vector<blk_hash_t> order;
+  now = std::chrono::steady_clock::now();
+  EXPECT_TRUE(total_dag.computeOrder(ghost_path.back(), order, non_finalized_blks));
+  const auto order_us = elapsed_us(now);
+  EXPECT_FALSE(order.empty());
+  EXPECT_EQ(order.back(), ghost_path.back());
+
+  // Boost labeled graph which was used before
+  using boost_graph_t =
+      boost::labeled_graph<boost::adjacency_list<boost::setS, boost::hash_setS, boost::directedS, blk_hash_t>,
+                           blk_hash_t, boost::hash_mapS>;
+  now = std::chrono::steady_clock::now();
+  boost_graph_t boost_total_dag;
+  boost_graph_t boost_pivot_tree;
+  boost::add_vertex(GENESIS, boost_total_dag);
+  boost_total_dag[GENESIS] = GENESIS;
+  boost::add_vertex(GENESIS, boost_pivot_tree);
+  boost_pivot_tree[GENESIS] = GENESIS;
+  for (uint32_t i = 0; i < blocks_count; ++i) {
+    const auto& hash = blocks[i + 1];
+    boost::add_vertex(hash, boost_total_dag);
+    boost_total_dag[hash] = hash;
+    boost::add_vertex(hash, boost_pivot_tree);
+    boost_pivot_tree[hash] = hash;
+    boost::add_edge_by_label(edges[i].first, hash, boost_total_dag);
+    boost::add_edge_by_label(edges[i].first, hash, boost_pivot_tree);
+    for (const auto& tip : edges[i].second) {
+      boost::add_edge_by_label(tip, hash, boost_total_dag);
+    }
+  }
+  const auto boost_insert_us = elapsed_us(now);
+
+  now = std::chrono::steady_clock::now();
+  const auto boost_ghost_path = boostGhostPath(boost_pivot_tree, GENESIS);
+  const auto boost_ghost_us = elapsed_us(now);
+
+  EXPECT_EQ(ghost_path, boost_ghost_path);
+  EXPECT_EQ(total_dag.getNumEdges(), boost::num_edges(boost_total_dag));
+
+  std::cout << "Blocks: " << blocks_count << std::endl
+            << "Insert: compact " << insert_us << "us, boost " << boost_insert_us << "us" << std::endl
+            << "Ghost path: compact " << ghost_us << "us, boost " << boost_ghost_us << "us" << std::endl
+            << "Compute order: compact " << order_us << "us" << std::endl;
+}
+
+TEST_F(DagTest, pivot_tree_incremental_ghost_path) {
+  const blk_hash_t GENESIS(1);
+  std::mt19937 rng(2);
+  taraxa::PivotTree pivot_tree(GENESIS, addr_t());
+  boost::labeled_graph<boost::adjacency_list<boost::setS, boost::hash_setS, boost::directedS, blk_hash_t>, blk_hash_t,
+                       boost::hash_mapS>
+      reference;
+  boost::add_vertex(GENESIS, reference);
+  reference[GENESIS] = GENESIS;
+
+  std::vector<blk_hash_t> blocks{GENESIS};
+  for (uint32_t i = 0; i < 300; ++i) {
+    const auto pivot = blocks[rng() % blocks.size()];
+    const auto hash = blk_hash_t::random();
+    pivot_tree.addVEEs(hash, pivot, {});
+    boost::add_vertex(hash, reference);
+    reference[hash] = hash;
+    boost::add_edge_by_label(pivot, hash, reference);
+    blocks.push_back(hash);
+
+    // Path from any vertex must match full recomputation of subtree weights
+    EXPECT_EQ(pivot_tree.getGhostPath(GENESIS), boostGhostPath(reference, GENESIS));
+    const auto from = blocks[rng() % blocks.size()];
+    EXPECT_EQ(pivot_tree.getGhostPath(from), boostGhostPath(reference, from));
+  }
+
+  // Weights are reset together with the tree on period finalization
+  pivot_tree.clear();
+  pivot_tree.addVEEs(blocks.back(), kNullBlockHash, {});
+  EXPECT_EQ(pivot_tree.getGhostPath(blocks.back()), std::vector<blk_hash_t>{blocks.back()});
+}
+
 }  // namespace taraxa::core_tests
 
 using namespace taraxa;
@@ -2,6 +2,7 @@
 
 #include <libdevcore/CommonData.h>
 
+#include <future>
 #include <optional>
 #include <vector>
 
@@ -13,6 +14,11 @@
 #include "final_chain/trie_common.hpp"
 #include "libdevcore/CommonJS.h"
 #include "network/rpc/eth/Eth.h"
+#include "network/rpc/eth/LogFilter.hpp"
+#include "network/rpc/eth/LogFilterIndex.hpp"
+#include "network/rpc/eth/watches.hpp"
+#include "storage/migration/logs_index.hpp"
+#include "storage/migration/migration_manager.hpp"
 #include "test_util/gtest.hpp"
 #include "test_util/samples.hpp"
 #include "test_util/test_util.hpp"
@@ -676,6 +682,7 @@ TEST_F(FinalChainTest, get_logs_multiple_topics) {
   const auto& sk = sender_keys.secret();
   cfg.genesis.state.initial_balances = {};
   cfg.genesis.state.initial_balances[from] = u256("10000000000000000000000");
+  cfg.db_config.logs_index = true;
   init();
 
   net::rpc::eth::EthParams eth_rpc_params;
@@ -735,9 +742,165 @@ TEST_F(FinalChainTest, get_logs_multiple_topics) {
     logs_obj["topics"].append(topics);
     auto res = eth_json_rpc->eth_getLogs(logs_obj);
     ASSERT_EQ(res.size(), 3);
+
+    // Range scanned by a worker pool streams the same logs in the same order
+    net::rpc::eth::EthParams parallel_rpc_params;
+    parallel_rpc_params.final_chain = SUT;
+    parallel_rpc_params.logs_query_threads = 2;
+    EXPECT_EQ(net::rpc::eth::NewEth(std::move(parallel_rpc_params))->eth_getLogs(logs_obj), res);
+
+    net::rpc::eth::EthParams limited_rpc_params;
+    limited_rpc_params.final_chain = SUT;
+    limited_rpc_params.logs_query_threads = 2;
+    limited_rpc_params.logs_query_max_results = 2;
+    EXPECT_THROW(net::rpc::eth::NewEth(std::move(limited_rpc_params))->eth_getLogs(logs_obj),
+                 jsonrpc::JsonRpcException);
+
+    // Logs index lookup and bloom scan return the same logs
+    cfg.db_config.logs_index = false;
+    EXPECT_EQ(eth_json_rpc->eth_getLogs(logs_obj), res);
   }
 }
 
+TEST_F(FinalChainTest, logs_index) {
+  const auto contract = addr_t::random();
+  const auto other_contract = addr_t::random();
+  const auto topic = h256::random();
+
+  // Receipts saved before index was enabled
+  const TransactionReceipts receipts_5{
+      {1, 0, 0, {LogEntry{contract, {topic}, {}}, LogEntry{other_contract, {h256::random(), topic}, {}}}, {}}};
+  const TransactionReceipts receipts_7{{1, 0, 0, {}, {}},
+                                       {1, 0, 0, {LogEntry{contract, {h256::random(), topic}, {}}}, {}}};
+  auto batch = db->createWriteBatch();
+  db->insert(batch, DbStorage::Columns::final_chain_receipt_by_period, PbftPeriod(5), util::rlp_enc(receipts_5));
+  db->insert(batch, DbStorage::Columns::final_chain_receipt_by_period, PbftPeriod(7), util::rlp_enc(receipts_7));
+  db->commitWriteBatch(batch);
+
+  db->updateDbVersions();
+  storage::migration::Manager migration_manager(db);
+  migration_manager.applyLogsIndex(true);
+
+  using Locations = std::vector<LogLocation>;
+  EXPECT_EQ(db->getLogLocationsByAddresses({contract}, 0, 10), (Locations{{5, 0, 0}, {7, 1, 0}}));
+  EXPECT_EQ(db->getLogLocationsByAddresses({contract, other_contract}, 6, 10), (Locations{{7, 1, 0}}));
+  EXPECT_EQ(db->getLogLocationsByAddresses({contract, other_contract}, 5, 5), (Locations{{5, 0, 0}, {5, 0, 1}}));
+  // Topic is indexed with its position
+  EXPECT_EQ(db->getLogLocationsByTopics({topic}, 0, 0, 10), (Locations{{5, 0, 0}}));
+  EXPECT_EQ(db->getLogLocationsByTopics({topic}, 1, 0, 10), (Locations{{5, 0, 1}, {7, 1, 0}}));
+
+  // New periods are indexed on write
+  db->addLogsIndexToBatch(batch, 8, {{1, 0, 0, {LogEntry{contract, {}, {}}}, {}}});
+  db->commitWriteBatch(batch);
+  EXPECT_EQ(db->getLogLocationsByAddresses({contract}, 8, 8), (Locations{{8, 0, 0}}));
+
+  // Index is removed when disabled, so it is backfilled again if re-enabled
+  migration_manager.applyLogsIndex(false);
+  EXPECT_TRUE(db->getLogLocationsByAddresses({contract}, 0, 10).empty());
+  EXPECT_FALSE(storage::migration::LogsIndex(db).isApplied());
+}
+
+TEST_F(FinalChainTest, log_filter_index) {
+  using net::rpc::eth::LogFilter;
+  const auto contract = addr_t::random();
+  const auto other_contract = addr_t::random();
+  const auto topic = h256::random();
+  const auto other_topic = h256::random();
+
+  const LogFilter by_address(0, std::nullopt, {contract}, {});
+  const LogFilter by_topic(0, std::nullopt, {}, {{{topic}, {}, {}, {}}});
+  const LogFilter by_second_topic(0, std::nullopt, {}, {{{}, {topic}, {}, {}}});
+  const LogFilter other(0, std::nullopt, {other_contract}, {{{other_topic}, {}, {}, {}}});
+
+  net::rpc::eth::LogFilterIndex<uint64_t> index;
+  index.add(1, by_address);
+  index.add(2, by_topic);
+  index.add(3, by_second_topic);
+  index.add(4, other);
+  EXPECT_EQ(index.size(), 4);
+
+  const auto candidates = [&index](const TransactionReceipt& receipt) {
+    std::vector<uint64_t> ret;
+    index.forEachCandidate(receipt, [&ret](uint64_t key) { ret.push_back(key); });
+    std::sort(ret.begin(), ret.end());
+    return ret;
+  };
+  const TransactionReceipt receipt{
+      1, 0, 0, {LogEntry{contract, {topic}, {}}, LogEntry{contract, {other_topic, topic}, {}}}, {}};
+  // Filter with addresses is not a candidate for other addresses even with matching topic
+  EXPECT_EQ(candidates(receipt), (std::vector<uint64_t>{1, 2, 3}));
+  EXPECT_TRUE(candidates(TransactionReceipt{1, 0, 0, {}, {}}).empty());
+
+  index.remove(1, by_address);
+  index.remove(3, by_second_topic);
+  EXPECT_EQ(candidates(receipt), (std::vector<uint64_t>{2}));
+
+  // Watches are updated only with logs matching their filters
+  net::rpc::eth::Watches watches(net::rpc::eth::WatchesConfig{});
+  const auto address_watch = watches.logs_.install_watch(LogFilter(by_address));
+  const auto topic_watch = watches.logs_.install_watch(LogFilter(by_second_topic));
+  const auto other_watch = watches.logs_.install_watch(LogFilter(other));
+  const net::rpc::eth::ExtendedTransactionLocation trx_loc{{{1, 0}, h256::random()}, h256::random()};
+  using LogsInput = typename decltype(watches.logs_)::InputType;
+  watches.logs_.process_update(LogsInput(trx_loc, receipt));
+  EXPECT_EQ(watches.logs_.poll(address_watch).size(), 2);
+  EXPECT_EQ(watches.logs_.poll(topic_watch).size(), 1);
+  EXPECT_TRUE(watches.logs_.poll(other_watch).empty());
+
+  EXPECT_TRUE(watches.logs_.uninstall_watch(address_watch));
+  watches.logs_.process_update(LogsInput(trx_loc, receipt));
+  EXPECT_TRUE(watches.logs_.poll(address_watch).empty());
+  EXPECT_EQ(watches.logs_.poll(topic_watch).size(), 1);
+}
+
+TEST_F(FinalChainTest, receipt_views) {
+  using net::rpc::eth::LogFilter;
+  const auto contract = addr_t::random();
+  const auto topic = h256::random();
+  const TransactionReceipts receipts{
+      {1, 21000, 21000, {}, addr_t::random()},
+      {0, 30000, 51000, {LogEntry{contract, {topic}, {1, 2, 3}}, LogEntry{addr_t::random(), {}, {}}}, {}},
+      {1, 40000, 91000, {LogEntry{contract, {h256::random(), topic}, {}}}, {}},
+  };
+  const auto raw = std::make_shared<const bytes>(util::rlp_enc(receipts));
+  const BlockReceiptsView view(raw, dev::bytesConstRef(raw.get()));
+  ASSERT_EQ(view.size(), receipts.size());
+  EXPECT_EQ(util::rlp_enc(view.decode()), *raw);
+
+  for (size_t i = 0; i < receipts.size(); ++i) {
+    const auto& r = receipts[i];
+    const auto r_view = view[i];
+    EXPECT_EQ(r_view.statusCode(), r.status_code);
+    EXPECT_EQ(r_view.gasUsed(), r.gas_used);
+    EXPECT_EQ(r_view.cumulativeGasUsed(), r.cumulative_gas_used);
+    EXPECT_EQ(r_view.newContractAddress(), r.new_contract_address);
+    EXPECT_EQ(r_view.bloom(), r.bloom());
+    ASSERT_EQ(r_view.logsCount(), r.logs.size());
+    r_view.forEachLog([&](size_t log_i, const LogEntryView& log) {
+      const auto& expected = r.logs[log_i];
+      EXPECT_EQ(log.address(), expected.address);
+      ASSERT_EQ(log.topicsCount(), expected.topics.size());
+      for (size_t t = 0; t < expected.topics.size(); ++t) {
+        EXPECT_EQ(log.topic(t), expected.topics[t]);
+      }
+      EXPECT_EQ(log.data().toBytes(), expected.data);
+      EXPECT_EQ(log.bloom(), expected.bloom());
+    });
+  }
+
+  // Matching against views gives the same logs as matching against decoded receipts
+  const LogFilter filter(0, std::nullopt, {contract}, {{{}, {topic}, {}, {}}});
+  const net::rpc::eth::ExtendedTransactionLocation trx_loc{{{1, 2}, h256::random()}, h256::random()};
+  std::vector<uint64_t> expected, actual;
+  filter.match_one(trx_loc, receipts[2], [&](const auto& lle) { expected.push_back(lle.position_in_receipt); });
+  filter.match_one(trx_loc, view[2], [&](const auto& lle) {
+    EXPECT_EQ(util::rlp_enc(lle.le), util::rlp_enc(receipts[2].logs[lle.position_in_receipt]));
+    actual.push_back(lle.position_in_receipt);
+  });
+  EXPECT_EQ(actual, expected);
+  EXPECT_EQ(actual.size(), 1);
+}
+
 TEST_F(FinalChainTest, topics_size_limit) {
   init();
 
@@ -877,6 +1040,94 @@ TEST_F(FinalChainTest, remove_jailed_validator_votes_from_total) {
   EXPECT_EQ(total_votes_before - votes_per_address, total_votes);
 }
 
+TEST_F(FinalChainTest, logs_range_scan_benchmark) {
+  init();
+  constexpr EthBlockNumber kBlocks = 100000;
+  constexpr EthBlockNumber kLogsEvery = 64;
+  constexpr size_t kThreads = 4;
+
+  // Synthetic receipts and bloom index of 100k blocks, every kLogsEvery-th block has a log of queried contract
+  const auto contract = addr_t::random();
+  const h256s topics{h256::random(), h256::random()};
+  TransactionReceipt matching{1, 21000, 21000, {LogEntry{contract, {topics[0]}, {}}}, {}};
+  TransactionReceipt other{1, 21000, 21000, {LogEntry{addr_t::random(), {h256::random()}, {}}}, {}};
+  std::map<h256, BlocksBlooms> chunks;
+  auto batch = db->createWriteBatch();
+  for (EthBlockNumber blk_n = 1; blk_n <= kBlocks; ++blk_n) {
+    const TransactionReceipts receipts{blk_n % kLogsEvery ? other : matching};
+    db->insert(batch, DbStorage::Columns::final_chain_receipt_by_period, blk_n, util::rlp_enc(receipts));
+    for (uint64_t level = 0, index = blk_n; level < c_bloomIndexLevels; ++level, index /= c_bloomIndexSize) {
+      chunks[FinalChain::blockBloomsChunkId(level, index / c_bloomIndexSize)][index % c_bloomIndexSize] |=
+          receipts[0].bloom();
+    }
+  }
+  for (const auto& [chunk_id, chunk] : chunks) {
+    db->insert(batch, DbStorage::Columns::final_chain_log_blooms_index, chunk_id, util::rlp_enc(chunk));
+  }
+  db->commitWriteBatch(batch);
+
+  // Filter with contract address and two topic options
+  std::vector<LogBloom> blooms;
+  for (const auto& topic : topics) {
+    LogBloom bloom;
+    bloom.shiftBloom<3>(sha3(contract)).shiftBloom<3>(sha3(topic));
+    blooms.push_back(bloom);
+  }
+  const auto count_logs = [&](const SharedTransactionReceipts& receipts) {
+    size_t count = 0;
+    for (const auto& r : *receipts) {
+      count += std::count_if(r.logs.cbegin(), r.logs.cend(), [&](const auto& l) { return l.address == contract; });
+    }
+    return count;
+  };
+  const auto elapsed_us = [](auto start) {
+    return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+  };
+
+  // Segments scanned by worker pool with a single index walk and batched receipts read per segment
+  util::ThreadPool pool(kThreads);
+  auto now = std::chrono::steady_clock::now();
+  std::vector<std::future<size_t>> segments;
+  for (EthBlockNumber from = 1; from <= kBlocks; from += net::rpc::eth::LogFilter::kSegmentSize) {
+    const auto to = std::min(kBlocks, from + net::rpc::eth::LogFilter::kSegmentSize - 1);
+    auto task = std::make_shared<std::packaged_task<size_t()>>([&, from, to] {
+      size_t count = 0;
+      for (const auto& receipts : SUT->blocksReceipts(SUT->withBlockBlooms(blooms, from, to))) {
+        count += count_logs(receipts);
+      }
+      return count;
+    });
+    segments.push_back(task->get_future());
+    pool.post([task] { (*task)(); });
+  }
+  size_t parallel_logs = 0;
+  for (auto& segment : segments) {
+    parallel_logs += segment.get();
+  }
+  const auto parallel_us = elapsed_us(now);
+
+  // Bloom index walk per bloom and receipts read block by block on a single thread, it runs last as it fills
+  // receipts cache
+  now = std::chrono::steady_clock::now();
+  std::set<EthBlockNumber> sequential_blocks;
+  for (const auto& bloom : blooms) {
+    for (auto blk_n : SUT->withBlockBloom(bloom, 1, kBlocks)) {
+      sequential_blocks.insert(blk_n);
+    }
+  }
+  size_t sequential_logs = 0;
+  for (auto blk_n : sequential_blocks) {
+    sequential_logs += count_logs(SUT->blockReceipts(blk_n));
+  }
+  const auto sequential_us = elapsed_us(now);
+
+  EXPECT_EQ(sequential_logs, kBlocks / kLogsEvery);
+  EXPECT_EQ(parallel_logs, sequential_logs);
+  std::cout << "Blocks: " << kBlocks << ", matching logs: " << parallel_logs << std::endl
+            << "Sequential scan: " << sequential_us << "us" << std::endl
+            << "Parallel scan (" << kThreads << " threads): " << parallel_us << "us" << std::endl;
+}
+
 // This test should be last as state_api isn't destructed correctly because of exception
 TEST_F(FinalChainTest, initial_validator_exceed_maximum_stake) {
   const dev::KeyPair key = dev::KeyPair::create();
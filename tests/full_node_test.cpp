@@ -6,9 +6,11 @@
 #include <chrono>
 #include <iostream>
 #include <mutex>
+#include <random>
 #include <shared_mutex>
 #include <vector>
 
+#include "common/config_exception.hpp"
 #include "common/constants.hpp"
 #include "common/init.hpp"
 #include "common/types.hpp"
@@ -121,6 +123,13 @@ TEST_F(FullNodeTest, db_test) {
   s2.emplace(blk3->getHash());
   EXPECT_EQ(db.getBlocksByLevel(1), s1);
   EXPECT_EQ(db.getBlocksByLevel(2), s2);
+  // Bulk reads keep order of keys and return nullptr for missing blocks
+  const auto blocks = db.getDagBlocks({blk3->getHash(), blk_hash_t(0xFF), blk1->getHash()});
+  ASSERT_EQ(blocks.size(), 3);
+  EXPECT_EQ(*blocks[0], *blk3);
+  EXPECT_EQ(blocks[1], nullptr);
+  EXPECT_EQ(*blocks[2], *blk1);
+  EXPECT_EQ(db.getDagBlocksAtLevel(1, 2).size(), 3);
 
   // Transaction
   auto batch = db.createWriteBatch();
@@ -138,6 +147,14 @@ TEST_F(FullNodeTest, db_test) {
   ASSERT_EQ(*g_trx_signed_samples[1], *db.getTransaction(g_trx_signed_samples[1]->getHash()));
   ASSERT_EQ(*g_trx_signed_samples[2], *db.getTransaction(g_trx_signed_samples[2]->getHash()));
   ASSERT_EQ(*g_trx_signed_samples[3], *db.getTransaction(g_trx_signed_samples[3]->getHash()));
+  const auto trxs = db.getTransactions({g_trx_signed_samples[3]->getHash(), g_trx_signed_samples[4]->getHash(),
+                                        g_trx_signed_samples[0]->getHash()});
+  ASSERT_EQ(trxs.size(), 3);
+  EXPECT_EQ(*trxs[0], *g_trx_signed_samples[3]);
+  EXPECT_EQ(trxs[1], nullptr);
+  EXPECT_EQ(*trxs[2], *g_trx_signed_samples[0]);
+  EXPECT_EQ(db.transactionsInDb({g_trx_signed_samples[4]->getHash(), g_trx_signed_samples[1]->getHash()}),
+            (std::vector<bool>{false, true}));
 
   // PBFT manager round and step
   EXPECT_EQ(db.getPbftMgrField(PbftMgrField::Round), 1);
@@ -286,6 +303,30 @@ TEST_F(FullNodeTest, db_test) {
     EXPECT_EQ(pillar_votes[idx]->getHash(), period_data1_from_db.pillar_votes_.operator*()[idx]->getHash());
   }
 
+  // Period data items are sliced using offsets, periods saved without offsets are still readable
+  PeriodData period_data5(make_simple_pbft_block(blk_hash_t(5), 6), votes);
+  period_data5.transactions = {g_trx_signed_samples[5], g_trx_signed_samples[6], g_trx_signed_samples[7]};
+  batch = db.createWriteBatch();
+  db.savePeriodData(period_data5, batch);
+  db.commitWriteBatch(batch);
+  const auto check_period_data5 = [&]() {
+    EXPECT_EQ(db.getTransactionCount(6), 3);
+    EXPECT_EQ(*db.getTransaction(6, 0), *g_trx_signed_samples[5]);
+    EXPECT_EQ(*db.getTransaction(6, 2), *g_trx_signed_samples[7]);
+    EXPECT_EQ(db.getTransaction(6, 3), nullptr);
+    EXPECT_EQ(*db.getTransaction(g_trx_signed_samples[6]->getHash()), *g_trx_signed_samples[6]);
+    EXPECT_EQ(db.getPbftBlock(6)->getBlockHash(), period_data5.pbft_blk->getBlockHash());
+    EXPECT_EQ(db.getPeriodCertVotes(6).size(), votes.size());
+    const auto trxs =
+        db.getFinalizedTransactions({g_trx_signed_samples[7]->getHash(), g_trx_signed_samples[5]->getHash()});
+    ASSERT_EQ(trxs.size(), 2);
+    EXPECT_EQ(*trxs[0], *g_trx_signed_samples[5]);
+    EXPECT_EQ(*trxs[1], *g_trx_signed_samples[7]);
+  };
+  check_period_data5();
+  db.remove(DbStorage::Columns::period_data_offsets, PbftPeriod{6});
+  check_period_data5();
+
   // pbft_blocks (head)
   PbftChain pbft_chain(addr_t(), db_ptr);
   db.savePbftHead(pbft_chain.getHeadHash(), pbft_chain.getJsonStr());
@@ -875,6 +916,196 @@ TEST_F(FullNodeTest, destroy_db) {
   }
 }
 
+TEST_F(FullNodeTest, db_group_commit) {
+  {
+    auto db = std::make_shared<DbStorage>(data_dir);
+    const auto commit_period = [&db](size_t i) {
+      auto batch = db->createWriteBatch();
+      db->addTransactionToBatch(*g_trx_signed_samples[i], batch);
+      db->commitPeriodWriteBatch(batch);
+      EXPECT_TRUE(db->getTransaction(g_trx_signed_samples[i]->getHash()));
+    };
+
+    // Group commit not enabled - every period is synced
+    commit_period(0);
+    EXPECT_EQ(db->uncommittedPeriods(), 0);
+
+    db->enableGroupCommit(3);
+    // Enabled, but not active
+    commit_period(1);
+    EXPECT_EQ(db->uncommittedPeriods(), 0);
+
+    db->setGroupCommitActive(true);
+    commit_period(2);
+    commit_period(3);
+    EXPECT_EQ(db->uncommittedPeriods(), 2);
+    // Every 3rd period is synced together with the previous ones
+    commit_period(4);
+    EXPECT_EQ(db->uncommittedPeriods(), 0);
+    commit_period(5);
+    EXPECT_EQ(db->uncommittedPeriods(), 1);
+
+    // Not synced periods are flushed after deactivation
+    db->setGroupCommitActive(false);
+    EXPECT_EQ(db->uncommittedPeriods(), 0);
+    commit_period(6);
+    EXPECT_EQ(db->uncommittedPeriods(), 0);
+
+    db->setGroupCommitActive(true);
+    commit_period(7);
+    EXPECT_EQ(db->uncommittedPeriods(), 1);
+    db->flushGroupCommit();
+    EXPECT_EQ(db->uncommittedPeriods(), 0);
+  }
+  auto db = std::make_shared<DbStorage>(data_dir);
+  for (size_t i = 0; i < 8; ++i) {
+    EXPECT_TRUE(db->getTransaction(g_trx_signed_samples[i]->getHash()));
+  }
+}
+
+TEST_F(FullNodeTest, db_column_profiles) {
+  Json::Value json;
+  json["column_profiles"]["transactions"] = "small_hot";
+  json["column_profiles"]["period_data"] = "default";
+  DBConfig db_config;
+  dec_json(json, db_config);
+  ASSERT_EQ(db_config.column_profiles.size(), 2);
+  EXPECT_EQ(db_config.column_profiles["transactions"], DbColumnProfile::SmallHot);
+  EXPECT_EQ(db_config.column_profiles["period_data"], DbColumnProfile::Default);
+
+  // Unknown profile fails config parsing
+  Json::Value unknown_profile_json;
+  unknown_profile_json["column_profiles"]["transactions"] = "unknown";
+  DBConfig unknown_profile_config;
+  EXPECT_THROW(dec_json(unknown_profile_json, unknown_profile_config), ConfigException);
+
+  // Unknown column fails db open
+  const std::map<std::string, DbColumnProfile> unknown_column{{"unknown", DbColumnProfile::SmallHot}};
+  EXPECT_THROW(DbStorage(data_dir / "unknown", 0, 0, 0, 0, addr_t(), false, 0, unknown_column), DbException);
+
+  // Overridden profiles are used with the shared block cache
+  {
+    DbStorage db(data_dir, 0, 0, 0, 0, addr_t(), false, 8, db_config.column_profiles);
+    auto batch = db.createWriteBatch();
+    db.addTransactionToBatch(*g_trx_signed_samples[0], batch);
+    db.commitWriteBatch(batch);
+  }
+  DbStorage db(data_dir, 0, 0, 0, 0, addr_t(), false, 8, db_config.column_profiles);
+  EXPECT_TRUE(db.getTransaction(g_trx_signed_samples[0]->getHash()));
+}
+
+// Prints write and read times of the previous default options and the tuned profiles, run explicitly with
+// --gtest_also_run_disabled_tests
+TEST_F(FullNodeTest, DISABLED_db_column_profiles_replay_benchmark) {
+  // Synthetic mix of operations generated by seeded mt19937_64: periods are appended together with their transactions
+  // and receipts, then transactions and receipts are read randomly by hash, recent periods are read back and pbft
+  // manager status is rewritten and read
+  enum class Op : uint8_t { WritePeriod, ReadTransaction, ReadReceipt, ReadPeriod, HotWrite, HotRead };
+  struct Record {
+    Op op;
+    uint64_t arg;
+  };
+  const uint64_t periods_count = 3000;
+  const uint64_t trxs_per_period = 20;
+  const uint64_t reads_count = 200000;
+  std::mt19937_64 rng(1);
+  std::vector<Record> trace;
+  for (uint64_t period = 1; period <= periods_count; ++period) {
+    trace.push_back({Op::WritePeriod, period});
+  }
+  for (uint64_t i = 0; i < reads_count; ++i) {
+    const auto r = rng() % 100;
+    if (r < 40) {
+      // Some of transactions are not known
+      trace.push_back({Op::ReadTransaction, rng() % (periods_count * trxs_per_period * 11 / 10)});
+    } else if (r < 70) {
+      trace.push_back({Op::ReadReceipt, rng() % (periods_count * trxs_per_period)});
+    } else if (r < 80) {
+      trace.push_back({Op::ReadPeriod, periods_count - rng() % 100});
+    } else if (r < 90) {
+      trace.push_back({Op::HotWrite, i});
+    } else {
+      trace.push_back({Op::HotRead, i});
+    }
+  }
+
+  const auto trx_hash = [](uint64_t i) { return dev::sha3(dev::toBigEndian(dev::u256(i))); };
+  const auto value = [](uint64_t i, size_t size) {
+    bytes value(size);
+    for (size_t j = 0; j < size; ++j) {
+      value[j] = static_cast<byte>((i + j) * 31 + i / 251);
+    }
+    return value;
+  };
+
+  const auto replay = [&](const fs::path &path, uint32_t block_cache_size_mb,
+                          std::map<std::string, DbColumnProfile> column_profiles) {
+    DbStorage db(path, 0, 0, 0, 0, addr_t(), false, block_cache_size_mb, std::move(column_profiles));
+    uint64_t read_bytes = 0;
+    std::chrono::microseconds write_time{0}, read_time{0};
+    bool compacted = false;
+    for (const auto &record : trace) {
+      const bool write = record.op == Op::WritePeriod || record.op == Op::HotWrite;
+      if (!write && !compacted) {
+        // Reads go to sst files, not only to memtables
+        for (const auto &col : {DbStorage::Columns::period_data, DbStorage::Columns::transactions,
+                                DbStorage::Columns::final_chain_receipt_by_trx_hash}) {
+          db.compactColumn(col);
+        }
+        compacted = true;
+      }
+      const auto begin = std::chrono::steady_clock::now();
+      switch (record.op) {
+        case Op::WritePeriod: {
+          auto batch = db.createWriteBatch();
+          for (uint64_t i = (record.arg - 1) * trxs_per_period; i < record.arg * trxs_per_period; ++i) {
+            db.insert(batch, DbStorage::Columns::transactions, trx_hash(i), value(i, 200));
+            db.insert(batch, DbStorage::Columns::final_chain_receipt_by_trx_hash, trx_hash(i), value(i, 300));
+          }
+          db.insert(batch, DbStorage::Columns::period_data, record.arg, value(record.arg, 500 * trxs_per_period));
+          db.commitWriteBatch(batch);
+          break;
+        }
+        case Op::ReadTransaction:
+          read_bytes += db.lookup(trx_hash(record.arg), DbStorage::Columns::transactions).size();
+          break;
+        case Op::ReadReceipt:
+          read_bytes += db.lookup(trx_hash(record.arg), DbStorage::Columns::final_chain_receipt_by_trx_hash).size();
+          break;
+        case Op::ReadPeriod:
+          read_bytes += db.lookup(record.arg, DbStorage::Columns::period_data).size();
+          break;
+        case Op::HotWrite:
+          db.insert(DbStorage::Columns::pbft_mgr_status, static_cast<uint8_t>(record.arg % 4), record.arg);
+          break;
+        case Op::HotRead:
+          read_bytes += db.lookup(static_cast<uint8_t>(record.arg % 4), DbStorage::Columns::pbft_mgr_status).size();
+          break;
+      }
+      const auto duration =
+          std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - begin);
+      (write ? write_time : read_time) += duration;
+    }
+    return std::make_tuple(read_bytes, write_time, read_time);
+  };
+
+  // Every column with default options and its own cache as before the profiles
+  std::map<std::string, DbColumnProfile> default_profiles;
+  for (const auto &col : DbStorage::Columns::all) {
+    default_profiles[col.name()] = DbColumnProfile::Default;
+  }
+  const auto [default_read_bytes, default_write_time, default_read_time] =
+      replay(data_dir / "default", 0, std::move(default_profiles));
+  const auto [tuned_read_bytes, tuned_write_time, tuned_read_time] = replay(data_dir / "tuned", 512, {});
+
+  EXPECT_EQ(default_read_bytes, tuned_read_bytes);
+  std::cout << "Operations: " << trace.size() << std::endl
+            << "Writes: default " << default_write_time.count() << "us, tuned " << tuned_write_time.count() << "us"
+            << std::endl
+            << "Reads: default " << default_read_time.count() << "us, tuned " << tuned_read_time.count() << "us"
+            << std::endl;
+}
+
 TEST_F(FullNodeTest, reconstruct_anchors) {
   auto node_cfgs = make_node_cfgs(1, 1, 5);
   std::pair<blk_hash_t, blk_hash_t> anchors;
@@ -3,7 +3,10 @@
 #include <gtest/gtest.h>
 
 #include <atomic>
+#include <chrono>
 #include <iostream>
+#include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 #include "app/app.hpp"
@@ -21,6 +24,7 @@
 #include "network/tarcap/packets_handlers/latest/transaction_packet_handler.hpp"
 #include "network/tarcap/packets_handlers/latest/vote_packet_handler.hpp"
 #include "network/tarcap/packets_handlers/latest/votes_bundle_packet_handler.hpp"
+#include "network/tarcap/shared_states/pbft_sync_requests.hpp"
 #include "pbft/pbft_manager.hpp"
 #include "test_util/samples.hpp"
 #include "test_util/test_util.hpp"
@@ -1600,6 +1604,290 @@ TEST_F(NetworkTest, transaction_gossip_selection) {
   }
 }
 
+class DeltaTransactionPacketHandler : public network::tarcap::TransactionPacketHandler {
+ public:
+  DeltaTransactionPacketHandler(std::shared_ptr<network::tarcap::PeersState> peers_state)
+      : TransactionPacketHandler({}, peers_state, {}, {}, {}) {}
+
+  static void markAsKnown(
+      const std::vector<std::pair<std::shared_ptr<network::tarcap::TaraxaPeer>,
+                                  std::pair<SharedTransactions, std::vector<trx_hash_t>>>>& res) {
+    for (const auto& peer : res) {
+      for (const auto& t : peer.second.first) {
+        peer.first->markTransactionAsKnown(t->getHash());
+      }
+    }
+  }
+
+  std::vector<
+      std::pair<std::shared_ptr<network::tarcap::TaraxaPeer>, std::pair<SharedTransactions, std::vector<trx_hash_t>>>>
+  public_transactionsToSendToPeers(std::vector<SharedTransactions> transactions) {
+    auto res = transactionsToSendToPeers(std::move(transactions));
+    markAsKnown(res);
+    return res;
+  }
+
+  std::vector<
+      std::pair<std::shared_ptr<network::tarcap::TaraxaPeer>, std::pair<SharedTransactions, std::vector<trx_hash_t>>>>
+  public_newTransactionsToSendToPeers(const TransactionAnnouncementLog& announcements,
+                                      const std::vector<SharedTransactions>& pool,
+                                      const std::unordered_map<trx_hash_t, SharedTransaction>& pooled) {
+    auto res = newTransactionsToSendToPeers(
+        announcements, [&pool]() { return pool; },
+        [&pooled](const trx_hash_t& hash) -> SharedTransaction {
+          const auto it = pooled.find(hash);
+          return it != pooled.end() ? it->second : nullptr;
+        });
+    markAsKnown(res);
+    return res;
+  }
+};
+
+TEST_F(NetworkTest, transaction_gossip_delta) {
+  dev::KeyPair node_key1 = dev::KeyPair::create();
+  dev::KeyPair node_key2 = dev::KeyPair::create();
+  dev::p2p::NodeID node_id1(node_key1.pub());
+  dev::p2p::NodeID node_id2(node_key2.pub());
+
+  auto peers_state = std::make_shared<network::tarcap::PeersState>(std::weak_ptr<dev::p2p::Host>(), FullNodeConfig());
+  peers_state->addPendingPeer(node_id1, {});
+  auto peer1 = peers_state->getPendingPeer(node_id1);
+  peers_state->setPeerAsReadyToSendMessages(node_id1, peer1);
+
+  DeltaTransactionPacketHandler tph(peers_state);
+  TransactionAnnouncementLog announcements(2 * kMaxTransactionsInPacket);
+  std::vector<SharedTransactions> pool;
+  std::unordered_map<trx_hash_t, SharedTransaction> pooled;
+  auto announce = [&](const SharedTransactions& trxs) {
+    pool.push_back(trxs);
+    for (const auto& trx : trxs) {
+      pooled.emplace(trx->getHash(), trx);
+      announcements.announce(trx->getHash());
+    }
+  };
+
+  // Peer without cursor gets the pool snapshot and switches to the announcement log
+  announce(samples::createSignedTrxSamples(1, 10, node_key1.secret(), {}));
+  {
+    auto trx_peers = tph.public_newTransactionsToSendToPeers(announcements, pool, pooled);
+    EXPECT_EQ(trx_peers.size(), 1);
+    EXPECT_EQ(trx_peers[0].second.first.size(), 10);
+    EXPECT_EQ(peer1->transactions_announcement_cursor_, announcements.head());
+    EXPECT_TRUE(tph.public_newTransactionsToSendToPeers(announcements, pool, pooled).empty());
+  }
+
+  // Only new transactions are selected, transactions which already left the pool are skipped
+  {
+    auto trxs = samples::createSignedTrxSamples(11, 5, node_key1.secret(), {});
+    announce(trxs);
+    pooled.erase(trxs[0]->getHash());
+    auto trx_peers = tph.public_newTransactionsToSendToPeers(announcements, pool, pooled);
+    EXPECT_EQ(trx_peers.size(), 1);
+    EXPECT_EQ(trx_peers[0].second.first.size(), 4);
+    EXPECT_EQ(trx_peers[0].second.first[0]->getHash(), trxs[1]->getHash());
+    EXPECT_EQ(trx_peers[0].second.second.size(), 0);
+  }
+
+  // Over the transactions limit the rest is sent as hashes and as transactions in the next round
+  {
+    announce(samples::createSignedTrxSamples(16, kMaxTransactionsInPacket + 10, node_key1.secret(), {}));
+    auto trx_peers = tph.public_newTransactionsToSendToPeers(announcements, pool, pooled);
+    EXPECT_EQ(trx_peers.size(), 1);
+    EXPECT_EQ(trx_peers[0].second.first.size(), kMaxTransactionsInPacket);
+    EXPECT_EQ(trx_peers[0].second.second.size(), 10);
+    trx_peers = tph.public_newTransactionsToSendToPeers(announcements, pool, pooled);
+    EXPECT_EQ(trx_peers.size(), 1);
+    EXPECT_EQ(trx_peers[0].second.first.size(), 10);
+    EXPECT_EQ(trx_peers[0].second.second.size(), 0);
+  }
+
+  // Syncing peer is skipped, once its cursor is overwritten in the log it falls back to the snapshot
+  {
+    peer1->syncing_ = true;
+    announce(samples::createSignedTrxSamples(1, 2 * kMaxTransactionsInPacket + 1, node_key2.secret(), {}));
+    EXPECT_TRUE(tph.public_newTransactionsToSendToPeers(announcements, pool, pooled).empty());
+    peer1->syncing_ = false;
+    auto trx_peers = tph.public_newTransactionsToSendToPeers(announcements, pool, pooled);
+    EXPECT_EQ(trx_peers.size(), 1);
+    EXPECT_EQ(trx_peers[0].second.first.size(), kMaxTransactionsInPacket);
+    // Snapshot was full so the peer stays on snapshots until it gets the rest of the pool
+    EXPECT_LT(peer1->transactions_announcement_cursor_, announcements.head());
+    trx_peers = tph.public_newTransactionsToSendToPeers(announcements, pool, pooled);
+    EXPECT_EQ(trx_peers.size(), 1);
+    EXPECT_EQ(trx_peers[0].second.first.size(), kMaxTransactionsInPacket);
+    trx_peers = tph.public_newTransactionsToSendToPeers(announcements, pool, pooled);
+    EXPECT_EQ(trx_peers.size(), 1);
+    EXPECT_EQ(trx_peers[0].second.first.size(), 1);
+    EXPECT_EQ(peer1->transactions_announcement_cursor_, announcements.head());
+    EXPECT_TRUE(tph.public_newTransactionsToSendToPeers(announcements, pool, pooled).empty());
+  }
+
+  // Newly connected peer gets the pool snapshot while the other one keeps following the log
+  {
+    peers_state->addPendingPeer(node_id2, {});
+    auto peer2 = peers_state->getPendingPeer(node_id2);
+    peers_state->setPeerAsReadyToSendMessages(node_id2, peer2);
+    auto trx_peers = tph.public_newTransactionsToSendToPeers(announcements, pool, pooled);
+    EXPECT_EQ(trx_peers.size(), 1);
+    EXPECT_EQ(trx_peers[0].first, peer2);
+    EXPECT_EQ(trx_peers[0].second.first.size(), kMaxTransactionsInPacket);
+  }
+}
+
+TEST_F(NetworkTest, transaction_gossip_delta_nonce_order) {
+  dev::KeyPair node_key = dev::KeyPair::create();
+  dev::KeyPair sender_key1 = dev::KeyPair::create();
+  dev::KeyPair sender_key2 = dev::KeyPair::create();
+  dev::p2p::NodeID node_id(node_key.pub());
+
+  auto peers_state = std::make_shared<network::tarcap::PeersState>(std::weak_ptr<dev::p2p::Host>(), FullNodeConfig());
+  peers_state->addPendingPeer(node_id, {});
+  auto peer = peers_state->getPendingPeer(node_id);
+  peers_state->setPeerAsReadyToSendMessages(node_id, peer);
+
+  DeltaTransactionPacketHandler tph(peers_state);
+  TransactionAnnouncementLog announcements(kMaxTransactionsInPacket);
+  std::vector<SharedTransactions> pool;
+  std::unordered_map<trx_hash_t, SharedTransaction> pooled;
+  auto announce = [&](const SharedTransactions& trxs) {
+    for (const auto& trx : trxs) {
+      pooled.emplace(trx->getHash(), trx);
+      announcements.announce(trx->getHash());
+    }
+  };
+  peer->transactions_announcement_cursor_ = announcements.head();
+
+  // Transactions of an account announced out of nonce order are sent in nonce order
+  auto trxs = samples::createSignedTrxSamples(1, 6, sender_key1.secret(), {});
+  auto other_trxs = samples::createSignedTrxSamples(1, 2, sender_key2.secret(), {});
+  announce({trxs[3], trxs[4], trxs[5]});
+  announce({other_trxs[0]});
+  announce({trxs[0], trxs[1], trxs[2]});
+  announce({other_trxs[1]});
+  auto trx_peers = tph.public_newTransactionsToSendToPeers(announcements, pool, pooled);
+  ASSERT_EQ(trx_peers.size(), 1);
+  const auto& sent = trx_peers[0].second.first;
+  ASSERT_EQ(sent.size(), 8);
+  // Transactions of the other account keep their positions
+  EXPECT_EQ(sent[3]->getHash(), other_trxs[0]->getHash());
+  EXPECT_EQ(sent[7]->getHash(), other_trxs[1]->getHash());
+  size_t next = 0;
+  for (const auto& trx : sent) {
+    if (trx->getSender() == sender_key1.address()) {
+      EXPECT_EQ(trx->getHash(), trxs[next++]->getHash());
+    }
+  }
+  EXPECT_EQ(next, trxs.size());
+}
+
+// Compares gossip selection cost of periodic full pool snapshots with the announcement log deltas for a big pool
+// and many peers that already know most of the pool
+TEST_F(NetworkTest, transaction_gossip_delta_benchmark) {
+  constexpr size_t kAccounts = 20;
+  constexpr size_t kPoolTrxsPerAccount = 1000;
+  constexpr size_t kPeers = 32;
+  constexpr size_t kRounds = 20;
+  constexpr size_t kNewTrxsPerAccountPerRound = 5;
+
+  std::vector<dev::KeyPair> keys;
+  std::vector<SharedTransactions> pool(kAccounts);
+  std::vector<std::vector<SharedTransactions>> new_trxs(kRounds, std::vector<SharedTransactions>(kAccounts));
+  for (size_t i = 0; i < kAccounts; i++) {
+    keys.push_back(dev::KeyPair::create());
+    pool[i] = samples::createSignedTrxSamples(1, kPoolTrxsPerAccount, keys[i].secret(), {});
+    for (size_t r = 0; r < kRounds; r++) {
+      new_trxs[r][i] = samples::createSignedTrxSamples(1 + kPoolTrxsPerAccount + r * kNewTrxsPerAccountPerRound,
+                                                       kNewTrxsPerAccountPerRound, keys[i].secret(), {});
+    }
+  }
+
+  auto make_peers = [&]() {
+    auto peers_state =
+        std::make_shared<network::tarcap::PeersState>(std::weak_ptr<dev::p2p::Host>(), FullNodeConfig());
+    for (size_t i = 0; i < kPeers; i++) {
+      dev::p2p::NodeID node_id(dev::KeyPair::create().pub());
+      peers_state->addPendingPeer(node_id, {});
+      auto peer = peers_state->getPendingPeer(node_id);
+      peers_state->setPeerAsReadyToSendMessages(node_id, peer);
+      for (const auto& account_trxs : pool) {
+        for (const auto& trx : account_trxs) {
+          peer->markTransactionAsKnown(trx->getHash());
+        }
+      }
+    }
+    return peers_state;
+  };
+
+  struct Measurement {
+    std::chrono::microseconds latency{0};
+    double cpu_ms = 0;
+    size_t sent = 0;
+  };
+  auto measure = [](Measurement& m, const auto& select) {
+    const auto cpu_start = std::clock();
+    const auto start = std::chrono::steady_clock::now();
+    const auto trx_peers = select();
+    m.latency += std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+    m.cpu_ms += 1000.0 * (std::clock() - cpu_start) / CLOCKS_PER_SEC;
+    for (const auto& peer : trx_peers) {
+      m.sent += peer.second.first.size();
+    }
+  };
+
+  // Full pool snapshot every round
+  Measurement snapshot;
+  {
+    DeltaTransactionPacketHandler tph(make_peers());
+    auto snapshot_pool = pool;
+    for (size_t r = 0; r < kRounds; r++) {
+      for (size_t i = 0; i < kAccounts; i++) {
+        snapshot_pool[i].insert(snapshot_pool[i].end(), new_trxs[r][i].begin(), new_trxs[r][i].end());
+      }
+      measure(snapshot, [&]() { return tph.public_transactionsToSendToPeers(snapshot_pool); });
+    }
+  }
+
+  // Only transactions announced since the previous round
+  Measurement delta;
+  {
+    auto peers_state = make_peers();
+    DeltaTransactionPacketHandler tph(peers_state);
+    TransactionAnnouncementLog announcements(kAccounts * (kPoolTrxsPerAccount + kRounds * kNewTrxsPerAccountPerRound));
+    auto delta_pool = pool;
+    std::unordered_map<trx_hash_t, SharedTransaction> delta_pooled;
+    for (const auto& account_trxs : pool) {
+      for (const auto& trx : account_trxs) {
+        delta_pooled.emplace(trx->getHash(), trx);
+        announcements.announce(trx->getHash());
+      }
+    }
+    for (const auto& peer : peers_state->getAllPeers()) {
+      peer.second->transactions_announcement_cursor_ = announcements.head();
+    }
+    for (size_t r = 0; r < kRounds; r++) {
+      for (size_t i = 0; i < kAccounts; i++) {
+        delta_pool[i].insert(delta_pool[i].end(), new_trxs[r][i].begin(), new_trxs[r][i].end());
+        for (const auto& trx : new_trxs[r][i]) {
+          delta_pooled.emplace(trx->getHash(), trx);
+          announcements.announce(trx->getHash());
+        }
+      }
+      measure(delta,
+              [&]() { return tph.public_newTransactionsToSendToPeers(announcements, delta_pool, delta_pooled); });
+    }
+  }
+
+  // Both approaches deliver every new transaction to every peer
+  EXPECT_EQ(snapshot.sent, kRounds * kAccounts * kNewTrxsPerAccountPerRound * kPeers);
+  EXPECT_EQ(delta.sent, snapshot.sent);
+  std::cout << "Gossip selection of " << kRounds << " rounds for " << kPeers << " peers and "
+            << kAccounts * kPoolTrxsPerAccount << " pool transactions" << std::endl;
+  std::cout << "  snapshot: " << snapshot.latency.count() / kRounds << " us per round, " << snapshot.cpu_ms
+            << " ms cpu" << std::endl;
+  std::cout << "  delta:    " << delta.latency.count() / kRounds << " us per round, " << delta.cpu_ms << " ms cpu"
+            << std::endl;
+}
+
 // Test creates multiple nodes and creates new transactions in random time
 // intervals on randomly selected nodes It verifies that the blocks created from
 // these transactions which get created on random nodes are synced and the
@@ -1871,6 +2159,103 @@ TEST_F(NetworkTest, pbft_sync_packet_rlp_encoding) {
   }
 }
 
+TEST_F(NetworkTest, pbft_sync_requests) {
+  using network::tarcap::PbftSyncPacket;
+  using network::tarcap::TaraxaPeer;
+
+  const auto make_peer = [](PbftPeriod chain_size) {
+    auto peer = std::make_shared<TaraxaPeer>(dev::p2p::NodeID::random(), 10, "");
+    peer->pbft_chain_size_ = chain_size;
+    return peer;
+  };
+  const auto make_packet = [](PbftPeriod period) {
+    PbftSyncPacket packet;
+    packet.period_data.pbft_blk = make_simple_pbft_block(blk_hash_t(period), period);
+    return packet;
+  };
+
+  auto main_peer = make_peer(20);
+  auto peer2 = make_peer(20);
+  auto short_peer = make_peer(8);
+  const std::vector<std::shared_ptr<TaraxaPeer>> peers{main_peer, peer2, short_peer};
+
+  network::tarcap::PbftSyncRequests sync_requests(5, 3, std::chrono::milliseconds(10000));
+  sync_requests.reset(1);
+
+  // Short peer does not have the third chunk
+  auto assigned = sync_requests.assignRequests(peers, main_peer, 0, 100);
+  ASSERT_EQ(assigned.size(), 2);
+  EXPECT_EQ(assigned[0].first, main_peer);
+  EXPECT_EQ(assigned[0].second, 1);
+  EXPECT_EQ(assigned[1].first, peer2);
+  EXPECT_EQ(assigned[1].second, 6);
+  EXPECT_TRUE(sync_requests.assignRequests(peers, main_peer, 0, 100).empty());
+
+  // Only requested periods are accepted, packets ahead are buffered
+  EXPECT_FALSE(sync_requests.onPacket(short_peer->getId(), 6, false));
+  EXPECT_FALSE(sync_requests.onPacket(peer2->getId(), 1, false));
+  for (PbftPeriod period = 6; period <= 10; period++) {
+    EXPECT_TRUE(sync_requests.onPacket(peer2->getId(), period, false));
+    EXPECT_TRUE(sync_requests.bufferPacket(make_packet(period), peer2));
+  }
+  EXPECT_EQ(sync_requests.pendingRequestsCount(), 1);
+  EXPECT_EQ(sync_requests.bufferedPacketsCount(), 5);
+  EXPECT_EQ(sync_requests.peerScore(peer2->getId()), 1);
+
+  // Chunks of invalid or disconnected peer are requested again
+  sync_requests.dropPeer(peer2->getId());
+  EXPECT_EQ(sync_requests.bufferedPacketsCount(), 0);
+  assigned = sync_requests.assignRequests(peers, main_peer, 0, 100);
+  ASSERT_EQ(assigned.size(), 1);
+  EXPECT_EQ(assigned[0].first, peer2);
+  EXPECT_EQ(assigned[0].second, 6);
+  for (PbftPeriod period = 6; period <= 10; period++) {
+    EXPECT_TRUE(sync_requests.onPacket(peer2->getId(), period, false));
+    EXPECT_TRUE(sync_requests.bufferPacket(make_packet(period), peer2));
+  }
+  for (PbftPeriod period = 1; period <= 5; period++) {
+    EXPECT_TRUE(sync_requests.onPacket(main_peer->getId(), period, false));
+  }
+  EXPECT_FALSE(sync_requests.popBufferedPacket(5).has_value());
+  auto buffered = sync_requests.popBufferedPacket(6);
+  ASSERT_TRUE(buffered.has_value());
+  EXPECT_EQ(buffered->first.period_data.pbft_blk->getPeriod(), 6);
+  EXPECT_EQ(buffered->second, peer2);
+
+  // The last chunk is requested only from the main peer
+  assigned = sync_requests.assignRequests(peers, main_peer, 10, 100);
+  ASSERT_EQ(assigned.size(), 2);
+  EXPECT_EQ(assigned[0].first, peer2);
+  EXPECT_EQ(assigned[0].second, 11);
+  EXPECT_EQ(assigned[1].first, main_peer);
+  EXPECT_EQ(assigned[1].second, 16);
+  EXPECT_TRUE(sync_requests.onPacket(main_peer->getId(), 16, false));
+  EXPECT_TRUE(sync_requests.onPacket(main_peer->getId(), 17, true));
+  EXPECT_TRUE(sync_requests.onPacket(peer2->getId(), 15, false));
+  EXPECT_FALSE(sync_requests.finished(20));
+  EXPECT_FALSE(sync_requests.popBufferedPacket(17).has_value());
+  EXPECT_TRUE(sync_requests.finished(20));
+
+  // Timed out request is requested again and its peer is penalized
+  network::tarcap::PbftSyncRequests timeout_requests(5, 3, std::chrono::milliseconds(0));
+  timeout_requests.reset(1);
+  assigned = timeout_requests.assignRequests(peers, main_peer, 0, 100);
+  ASSERT_EQ(assigned.size(), 2);
+  EXPECT_TRUE(timeout_requests.onPacket(peer2->getId(), 6, false));
+  EXPECT_EQ(timeout_requests.checkTimeouts(), 2);
+  EXPECT_EQ(timeout_requests.peerScore(main_peer->getId()), -2);
+  EXPECT_EQ(timeout_requests.peerScore(peer2->getId()), -2);
+  // Penalized peers are requested last
+  assigned = timeout_requests.assignRequests(peers, main_peer, 0, 100);
+  ASSERT_EQ(assigned.size(), 3);
+  EXPECT_EQ(assigned[0].first, short_peer);
+  EXPECT_EQ(assigned[0].second, 1);
+  EXPECT_EQ(assigned[1].first, main_peer);
+  EXPECT_EQ(assigned[1].second, 7);
+  EXPECT_EQ(assigned[2].first, peer2);
+  EXPECT_EQ(assigned[2].second, 11);
+}
+
 }  // namespace taraxa::core_tests
 
 using namespace taraxa;
@@ -4,7 +4,9 @@
 #include <libp2p/Common.h>
 #include <libp2p/Host.h>
 #include <libp2p/Network.h>
+#include <libp2p/RLPXFrameCoder.h>
 #include <libp2p/Session.h>
+#include <libp2p/SharedPacket.h>
 
 #include "common/init.hpp"
 #include "common/thread_pool.hpp"
@@ -42,6 +44,30 @@ class TestTaraxaCapability final : public dev::p2p::CapabilityFace {
   taraxa::network::tarcap::TarcapVersion version_{1};
 };
 
+// Records payloads of received capability packets
+class RecordingCapability final : public dev::p2p::CapabilityFace {
+ public:
+  std::string name() const override { return "recording"; }
+  taraxa::network::tarcap::TarcapVersion version() const override { return 1; }
+  unsigned messageCount() const override { return 1; }
+  void onConnect(std::weak_ptr<dev::p2p::Session>, u256 const &) override {}
+  void onDisconnect(dev::p2p::NodeID const &) override {}
+  void interpretCapabilityPacket(std::weak_ptr<dev::p2p::Session>, unsigned, dev::RLP const &r) override {
+    std::scoped_lock lock(mutex_);
+    received_.push_back(r.data().toBytes());
+  }
+  std::string packetTypeToString(unsigned) const override { return ""; }
+
+  std::vector<bytes> received() const {
+    std::scoped_lock lock(mutex_);
+    return received_;
+  }
+
+ private:
+  std::vector<bytes> received_;
+  mutable std::mutex mutex_;
+};
+
 std::shared_ptr<dev::p2p::Host> makeTestNode(unsigned short listenPort,
                                              std::vector<taraxa::network::tarcap::TarcapVersion> tarcap_versions,
                                              std::filesystem::path state_file_path) {
@@ -151,6 +177,87 @@ TEST_F(P2PTest, multiple_capabilities) {
   }
 }
 
+TEST_F(P2PTest, shared_packet) {
+  RLPStream small_rlp;
+  small_rlp << bytes(10, 1);
+  SharedPacket small_packet(small_rlp.out());
+
+  // Message is built only once per packet type header
+  const auto small_msg = small_packet.message(0x11);
+  EXPECT_EQ(small_msg, small_packet.message(0x11));
+  EXPECT_NE(small_msg, small_packet.message(0x12));
+  EXPECT_EQ(small_msg->msg.size(), small_packet.payloadSize() + 1);
+  EXPECT_EQ(small_msg->msg[0], 0x11);
+  EXPECT_EQ(bytes(small_msg->msg.begin() + 1, small_msg->msg.end()), small_rlp.out());
+  // Small packets are not compressed
+  EXPECT_TRUE(small_msg->compressed.empty());
+
+  RLPStream big_rlp;
+  big_rlp << bytes(10000, 1);
+  SharedPacket big_packet(big_rlp.out());
+  const auto big_msg = big_packet.message(0x11);
+  EXPECT_EQ(big_msg->msg[0], 0x11);
+  EXPECT_FALSE(big_msg->compressed.empty());
+  EXPECT_LT(big_msg->compressed.size(), big_msg->msg.size());
+}
+
+TEST_F(P2PTest, shared_packet_broadcast) {
+  // Create boot node
+  dev::p2p::NetworkConfig net_conf("127.0.0.1", 20011, false, true);
+  TaraxaNetworkConfig taraxa_net_conf;
+  taraxa_net_conf.is_boot_node = true;
+  auto boot_node = Host::make(
+      "TaraxaNode", [](auto /*host*/) { return Host::CapabilityList{}; }, dev::KeyPair::create(), net_conf,
+      taraxa_net_conf);
+  util::ThreadPool tp;
+  tp.post_loop({}, [=] { boot_node->do_work(); });
+
+  // Sender and two receivers find each other through the boot node
+  constexpr size_t kNodesCount = 3;
+  std::vector<std::shared_ptr<RecordingCapability>> capabilities;
+  std::vector<std::shared_ptr<dev::p2p::Host>> nodes;
+  for (size_t i = 0; i < kNodesCount; i++) {
+    const auto state_file_path = "/tmp/nw_broadcast" + std::to_string(i);
+    std::filesystem::remove_all(state_file_path);
+    auto capability = capabilities.emplace_back(std::make_shared<RecordingCapability>());
+    auto node = nodes.emplace_back(Host::make(
+        "TaraxaNode", [capability](auto /*host*/) { return Host::CapabilityList{capability}; },
+        dev::KeyPair::create(), dev::p2p::NetworkConfig("127.0.0.1", 20012 + i, false, true), TaraxaNetworkConfig{},
+        state_file_path));
+    node->addNode(Node(boot_node->id(), dev::p2p::NodeIPEndpoint(bi::make_address("127.0.0.1"), 20011, 20011)));
+    tp.post_loop({}, [=] { node->do_work(); });
+  }
+  wait({60s, 500ms}, [&](auto &ctx) {
+    for (const auto &node : nodes) {
+      WAIT_EXPECT_EQ(ctx, node->peer_count(), kNodesCount - 1);
+    }
+  });
+
+  // Payload big enough to be sent as a compressed frame
+  RLPStream payload_rlp;
+  bytes data(4 * RLPXFrameCoder::MIN_COMPRESSION_SIZE);
+  for (size_t i = 0; i < data.size(); i++) {
+    data[i] = static_cast<byte>(i % 7);
+  }
+  payload_rlp << data;
+  const auto payload = payload_rlp.out();
+  ASSERT_GE(payload.size(), RLPXFrameCoder::MIN_COMPRESSION_SIZE);
+
+  std::atomic<size_t> sent_count = 0;
+  nodes[0]->broadcast({nodes[1]->id(), nodes[2]->id()}, "recording", 0, payload,
+                      [&sent_count](NodeID const &) { sent_count++; });
+  wait({10s, 100ms}, [&](auto &ctx) {
+    WAIT_EXPECT_EQ(ctx, sent_count.load(), kNodesCount - 1);
+    WAIT_EXPECT_EQ(ctx, capabilities[1]->received().size(), 1);
+    WAIT_EXPECT_EQ(ctx, capabilities[2]->received().size(), 1);
+  });
+
+  // Every peer decrypts and decompresses identical bytes
+  EXPECT_EQ(capabilities[1]->received().front(), payload);
+  EXPECT_EQ(capabilities[2]->received().front(), payload);
+  EXPECT_TRUE(capabilities[0]->received().empty());
+}
+
 }  // namespace taraxa::core_tests
 
 using namespace taraxa;
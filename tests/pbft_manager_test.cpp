@@ -365,6 +365,84 @@ TEST_F(PbftManagerTest, pbft_manager_run_single_node) {
   EXPECT_EQ(node->getFinalChain()->getBalance(receiver).first, old_balance + coins_value);
 }
 
+TEST_F(PbftManagerTest, push_synced_period_data) {
+  auto node_cfgs = make_node_cfgs(2, 1, 20);
+
+  // Produce period data on the validator node, which is stopped before the syncing node is started
+  std::vector<bytes> periods_data_raw{bytes()};
+  SharedTransaction trx;
+  std::optional<TransactionLocation> trx_location;
+  {
+    auto node = create_node(node_cfgs[0], true);
+    trx = std::make_shared<Transaction>(1, 100, gas_price, TEST_TX_GAS_LIMIT, bytes(), node->getSecretKey(),
+                                        node_cfgs[1].getFirstWallet().node_addr);
+    node->getTransactionManager()->insertTransaction(trx);
+    EXPECT_HAPPENS({10s, 100ms}, [&](auto &ctx) {
+      trx_location = node->getDB()->getTransactionLocation(trx->getHash());
+      WAIT_EXPECT_TRUE(ctx, trx_location.has_value())
+    });
+    ASSERT_TRUE(trx_location.has_value());
+    EXPECT_HAPPENS({10s, 100ms}, [&](auto &ctx) {
+      WAIT_EXPECT_GE(ctx, node->getPbftChain()->getPbftChainSize(), trx_location->period + 3)
+    });
+    node->getPbftManager()->stop();
+    for (PbftPeriod period = 1; period <= node->getPbftChain()->getPbftChainSize(); period++) {
+      periods_data_raw.emplace_back(node->getDB()->getPeriodDataRaw(period));
+    }
+  }
+
+  // Cert votes of the last pushed period are part of the next period data
+  const PbftPeriod last_period = periods_data_raw.size() - 2;
+  const PbftPeriod trx_period = trx_location->period;
+  const auto peer_id = dev::p2p::NodeID::random();
+
+  auto node = create_node(node_cfgs[1], true);
+  auto pbft_mgr = node->getPbftManager();
+  pbft_mgr->stop();
+
+  // Every push decodes new period data objects, as a refill of the queue from the network does
+  auto push_periods = [&](PbftPeriod from_period, bool invalid_trx_signature) {
+    for (auto period = from_period; period <= last_period; period++) {
+      PeriodData period_data(periods_data_raw[period]);
+      for (auto &t : period_data.transactions) {
+        if (!invalid_trx_signature || t->getHash() != trx->getHash()) {
+          continue;
+        }
+        // Signature s value equal to the curve order, so the sender can't be recovered
+        dev::RLPStream invalid_rlp(9);
+        size_t field = 0;
+        for (const auto el : dev::RLP(t->rlp())) {
+          if (++field < 9) {
+            invalid_rlp.append(el);
+          } else {
+            invalid_rlp << u256("0xfffffffffffffffffffffffffffffffebaaedce6af48a03bbfd25e8cd0364141");
+          }
+        }
+        t = std::make_shared<Transaction>(invalid_rlp.out());
+      }
+      auto cert_votes = PeriodData(periods_data_raw[period + 1]).previous_block_cert_votes;
+      pbft_mgr->periodDataQueuePush(std::move(period_data), peer_id, std::move(cert_votes));
+    }
+  };
+
+  // Periods are prevalidated ahead of processing, syncing stops at the invalid transaction signature and the queue of
+  // the malicious peer is cleared
+  push_periods(1, true);
+  EXPECT_EQ(pbft_mgr->periodDataQueueSize(), last_period);
+  pbft_mgr->pushSyncedPbftBlocksIntoChain();
+  EXPECT_EQ(node->getPbftChain()->getPbftChainSize(), trx_period - 1);
+  EXPECT_EQ(pbft_mgr->periodDataQueueSize(), 0);
+
+  // Refilled queue brings the same pbft blocks with valid period data, stale prevalidation results must be dropped
+  push_periods(trx_period, false);
+  pbft_mgr->pushSyncedPbftBlocksIntoChain();
+  EXPECT_EQ(node->getPbftChain()->getPbftChainSize(), last_period);
+  EXPECT_EQ(pbft_mgr->periodDataQueueSize(), 0);
+  EXPECT_HAPPENS({10s, 100ms}, [&](auto &ctx) {
+    WAIT_EXPECT_TRUE(ctx, node->getDB()->getTransactionLocation(trx->getHash()).has_value())
+  });
+}
+
 TEST_F(PbftManagerTest, pbft_manager_run_multi_nodes) {
   const auto node_cfgs = make_node_cfgs(3, 1, 20);
   const auto node1_genesis_bal = own_effective_genesis_bal(node_cfgs[0]);
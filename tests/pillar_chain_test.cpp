@@ -444,6 +444,36 @@ TEST_F(PillarChainTest, pillar_vote_solidity_rlp_encoding) {
   validateDecodedPillarVote(PillarVote(pillar_vote.rlp()));
 }
 
+TEST_F(PillarChainTest, pillar_votes_above_threshold) {
+  PbftPeriod period{12};
+  blk_hash_t block_hash{34};
+  pillar_chain::PillarVotes pillar_votes;
+  pillar_votes.initializePeriodData(period, 10);
+
+  std::vector<std::pair<std::shared_ptr<PillarVote>, uint64_t>> votes;
+  for (uint64_t weight : {1, 5, 2, 4, 3}) {
+    auto pk = dev::Secret(dev::sha3(dev::jsToBytes("0x" + std::to_string(weight))));
+    votes.emplace_back(std::make_shared<PillarVote>(pk, period, block_hash), weight);
+  }
+  // Duplicate vote is not added
+  votes.push_back(votes.front());
+
+  const auto added = pillar_votes.addVerifiedVotes(votes);
+  ASSERT_EQ(added, std::vector<bool>({true, true, true, true, true, false}));
+  EXPECT_EQ(pillar_votes.getVerifiedVotes(period, block_hash).size(), 5);
+
+  // Minimum amount of votes with the highest weights: 5 + 4 + 3 >= 10
+  const auto above_threshold_votes = pillar_votes.getVerifiedVotes(period, block_hash, true);
+  ASSERT_EQ(above_threshold_votes.size(), 3);
+  EXPECT_EQ(above_threshold_votes[0]->getHash(), votes[1].first->getHash());
+  EXPECT_EQ(above_threshold_votes[1]->getHash(), votes[3].first->getHash());
+  EXPECT_EQ(above_threshold_votes[2]->getHash(), votes[4].first->getHash());
+
+  // Not enough weight for different pillar block
+  pillar_votes.addVerifiedVote(std::make_shared<PillarVote>(dev::Secret::random(), period, blk_hash_t{35}), 9);
+  EXPECT_TRUE(pillar_votes.getVerifiedVotes(period, blk_hash_t{35}, true).empty());
+}
+
 // contract BridgeMock {
 //   address public lightClient;
 
@@ -3,7 +3,11 @@
 #include <libdevcore/Common.h>
 #include <libdevcore/CommonJS.h>
 
+#include "common/jsoncpp.hpp"
 #include "network/rpc/eth/Eth.h"
+#include "network/rpc/jsonrpc_http_processor.hpp"
+#include "network/rpc/jsonrpc_ws_server.hpp"
+#include "network/subscriptions.hpp"
 #include "test_util/samples.hpp"
 
 namespace taraxa::core_tests {
@@ -289,6 +293,337 @@ TEST_F(RPCTest, u256_h256_serialization) {
   EXPECT_EQ(dev::toJS(dev::u256(val)).size(), str.size() - 1);
 }
 
+TEST_F(RPCTest, ws_subscription_payload_shared) {
+  std::vector<net::SubscriptionMessage> messages;
+  net::Subscriptions first_session([&](net::SubscriptionMessage&& msg) { messages.push_back(std::move(msg)); });
+  net::Subscriptions second_session([&](net::SubscriptionMessage&& msg) { messages.push_back(std::move(msg)); });
+  first_session.addSubscription(std::make_shared<net::DagBlocksSubscription>(1, false));
+  first_session.addSubscription(std::make_shared<net::DagBlocksSubscription>(2, true));
+  second_session.addSubscription(std::make_shared<net::DagBlocksSubscription>(1, false));
+  second_session.addSubscription(std::make_shared<net::HeadsSubscription>(2));
+
+  Json::Value block;
+  block["hash"] = dev::toJS(blk_hash_t(1));
+  block["level"] = dev::toJS(7);
+  net::SubscriptionPayload payload(block);
+  first_session.process(SubscriptionType::DAG_BLOCKS, payload);
+  second_session.process(SubscriptionType::DAG_BLOCKS, payload);
+  ASSERT_EQ(messages.size(), 3u);
+
+  // Every payload variant is serialized once and shared by all subscriptions
+  EXPECT_EQ(messages[0].result, messages[2].result);
+  EXPECT_NE(messages[0].result, messages[1].result);
+
+  const auto to_json = [](const net::SubscriptionMessage& msg) {
+    return util::parse_json(std::string(net::SubscriptionMessage::head()) + *msg.result + msg.tail);
+  };
+  const auto make_expected = [](int id, const Json::Value& result) {
+    Json::Value params;
+    params["result"] = result;
+    params["subscription"] = dev::toJS(id);
+    Json::Value res;
+    res["jsonrpc"] = "2.0";
+    res["method"] = "eth_subscription";
+    res["params"] = params;
+    return res;
+  };
+  EXPECT_EQ(to_json(messages[0]), make_expected(1, block["hash"]));
+  EXPECT_EQ(to_json(messages[1]), make_expected(2, block));
+  EXPECT_EQ(to_json(messages[2]), make_expected(1, block["hash"]));
+}
+
+TEST_F(RPCTest, ws_subscription_payload_variants) {
+  namespace websocket = boost::beast::websocket;
+  using tcp = boost::asio::ip::tcp;
+  const tcp::endpoint endpoint(boost::asio::ip::make_address("127.0.0.1"), 29778);
+
+  util::ThreadPool server_pool(2);
+  auto ws_server = std::make_shared<net::JsonRpcWsServer>(server_pool.unsafe_get_io_context(), endpoint, addr_t(),
+                                                          nullptr);
+  ws_server->run();
+
+  boost::asio::io_context client_ioc;
+  websocket::stream<tcp::socket> ws(client_ioc);
+  ws.next_layer().connect(endpoint);
+  ws.handshake("127.0.0.1", "/");
+  boost::beast::flat_buffer buffer;
+  const auto read_json = [&]() {
+    buffer.clear();
+    ws.read(buffer);
+    return util::parse_json(boost::beast::buffers_to_string(buffer.data()));
+  };
+  const auto subscribe = [&](const std::string& params) {
+    ws.write(boost::asio::buffer(R"({"jsonrpc":"2.0","id":1,"method":"eth_subscribe","params":)" + params + "}"));
+    return read_json()["result"];
+  };
+  const auto dag_subscription = subscribe(R"(["newDagBlocks",false])");
+  const auto pbft_subscription = subscribe(R"(["newPbftBlocks",true])");
+  const auto pillar_subscription = subscribe(R"(["newPillarBlockData",true])");
+
+  // Hash only DAG block
+  const auto dag_blk = std::make_shared<DagBlock>(blk_hash_t(1), 1, vec_blk_t{}, vec_trx_t{trx_hash_t(2)},
+                                                  dev::KeyPair::create().secret());
+  ws_server->newDagBlock(dag_blk);
+  auto msg = read_json();
+  EXPECT_EQ(msg["params"]["subscription"], dag_subscription);
+  EXPECT_EQ(msg["params"]["result"], dag_blk->getJson()["hash"]);
+
+  // Full PBFT block
+  const PbftBlock pbft_blk(kNullBlockHash, blk_hash_t(1), kNullBlockHash, kNullBlockHash, 1, addr_t(),
+                           dev::KeyPair::create().secret(), {});
+  const std::vector<blk_hash_t> finalized_dag_blks{blk_hash_t(1)};
+  ws_server->newPbftBlockExecuted(pbft_blk, finalized_dag_blks);
+  msg = read_json();
+  EXPECT_EQ(msg["params"]["subscription"], pbft_subscription);
+  // Compared serialized as numbers are parsed back as signed
+  EXPECT_EQ(util::to_string(msg["params"]["result"]), util::to_string(PbftBlock::toJson(pbft_blk, finalized_dag_blks)));
+
+  // Pillar block with signatures
+  const auto pillar_blk =
+      std::make_shared<pillar_chain::PillarBlock>(1, h256{}, blk_hash_t{}, h256{}, 0,
+                                                  std::vector<pillar_chain::PillarBlock::ValidatorVoteCountChange>{});
+  const pillar_chain::PillarBlockData pillar_data(
+      pillar_blk, {std::make_shared<PillarVote>(secret_t::random(), pillar_blk->getPeriod(), pillar_blk->getHash())});
+  ws_server->newPillarBlockData(pillar_data);
+  msg = read_json();
+  EXPECT_EQ(msg["params"]["subscription"], pillar_subscription);
+  EXPECT_EQ(util::to_string(msg["params"]["result"]), util::to_string(pillar_data.getJson(true)));
+  EXPECT_EQ(msg["params"]["result"]["signatures"].size(), 1u);
+}
+
+TEST_F(RPCTest, ws_slow_subscriber_evicted) {
+  namespace websocket = boost::beast::websocket;
+  using tcp = boost::asio::ip::tcp;
+  const tcp::endpoint endpoint(boost::asio::ip::make_address("127.0.0.1"), 29777);
+
+  // Write to the slow subscriber blocks one thread while the other serves the fast one
+  util::ThreadPool server_pool(2);
+  auto ws_server = std::make_shared<net::JsonRpcWsServer>(server_pool.unsafe_get_io_context(), endpoint, addr_t(),
+                                                          nullptr);
+  ws_server->run();
+
+  boost::asio::io_context client_ioc;
+  const auto connect = [&](bool slow) {
+    auto ws = std::make_unique<websocket::stream<tcp::socket>>(client_ioc);
+    ws->next_layer().open(tcp::v4());
+    if (slow) {
+      // Small receive buffer so the server cannot write much ahead into the socket
+      ws->next_layer().set_option(boost::asio::socket_base::receive_buffer_size(4096));
+    }
+    ws->next_layer().connect(endpoint);
+    ws->handshake("127.0.0.1", "/");
+    ws->write(boost::asio::buffer(
+        std::string(R"({"jsonrpc":"2.0","id":1,"method":"eth_subscribe","params":["newDagBlocks",true]})")));
+    boost::beast::flat_buffer buffer;
+    ws->read(buffer);
+    return ws;
+  };
+  auto fast_client = connect(false);
+  auto slow_client = connect(true);
+
+  constexpr size_t kRoundSize = 256;
+  constexpr size_t kMessagesCount = 4 * net::WsSession::kMaxSendQueueSize;
+  std::atomic<size_t> fast_received = 0;
+  std::thread fast_reader([&] {
+    boost::beast::flat_buffer buffer;
+    while (fast_received < kMessagesCount) {
+      fast_client->read(buffer);
+      buffer.clear();
+      fast_received++;
+    }
+  });
+
+  // Block with enough transactions to make every message ~16kB
+  vec_trx_t trxs;
+  for (size_t i = 0; i < 250; ++i) {
+    trxs.push_back(trx_hash_t::random());
+  }
+  const auto blk = std::make_shared<DagBlock>(blk_hash_t(1), 1, vec_blk_t{}, trxs, dev::KeyPair::create().secret());
+
+  // Publish in rounds the fast subscriber keeps up with, slow subscriber never reads
+  for (size_t sent = kRoundSize; sent <= kMessagesCount; sent += kRoundSize) {
+    for (size_t i = 0; i < kRoundSize; ++i) {
+      ws_server->newDagBlock(blk);
+    }
+    ASSERT_HAPPENS({10s, 10ms}, [&](auto& ctx) { WAIT_EXPECT_EQ(ctx, fast_received.load(), sent) });
+  }
+  fast_reader.join();
+  EXPECT_EQ(fast_received, kMessagesCount);
+
+  // Slow subscriber never reads again, its blocked write is aborted and both server threads are free again
+  auto running_tasks = std::make_shared<std::atomic<size_t>>(0);
+  const auto rendezvous = [running_tasks]() {
+    (*running_tasks)++;
+    const auto deadline = std::chrono::steady_clock::now() + 10s;
+    while (*running_tasks < 2 && std::chrono::steady_clock::now() < deadline) {
+      std::this_thread::yield();
+    }
+  };
+  boost::asio::post(server_pool.unsafe_get_io_context(), rendezvous);
+  boost::asio::post(server_pool.unsafe_get_io_context(), rendezvous);
+  EXPECT_HAPPENS({10s, 10ms}, [&](auto& ctx) { WAIT_EXPECT_EQ(ctx, running_tasks->load(), 2) });
+
+  // Slow subscriber session is closed, closed sessions are removed when a new connection is accepted
+  auto probe_client = connect(false);
+  EXPECT_EQ(ws_server->numberOfSessions(), 2);
+
+  // Fast subscriber still receives new messages
+  ws_server->newDagBlock(blk);
+  boost::beast::flat_buffer buffer;
+  fast_client->read(buffer);
+  EXPECT_EQ(util::parse_json(boost::beast::buffers_to_string(buffer.data()))["params"]["result"]["hash"],
+            blk->getJson()["hash"]);
+}
+
+// Echoes call id after a delay, tracks the max number of calls handled at the same time
+struct DelayedEchoHandler : jsonrpc::IClientConnectionHandler {
+  void HandleRequest(const std::string& request, std::string& response) override {
+    const auto running = ++running_calls;
+    auto max_running = max_running_calls.load();
+    while (running > max_running && !max_running_calls.compare_exchange_weak(max_running, running)) {
+    }
+    // Until two calls overlapped, wait for another call to start so overlap does not depend on thread scheduling
+    for (size_t i = 0; i < 5000 && max_running_calls < 2; ++i) {
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    --running_calls;
+
+    const auto call = util::parse_json(request);
+    if (!call.isMember("id")) return;
+    Json::Value res;
+    res["jsonrpc"] = "2.0";
+    res["id"] = call["id"];
+    res["result"] = call["id"];
+    response = util::to_string(res) + "\n";
+  }
+
+  std::atomic<size_t> running_calls = 0;
+  std::atomic<size_t> max_running_calls = 0;
+};
+
+TEST_F(RPCTest, http_batch_parallel) {
+  constexpr size_t kCalls = 8;
+  Json::Value batch(Json::arrayValue);
+  for (size_t i = 0; i < kCalls; ++i) {
+    Json::Value call;
+    call["jsonrpc"] = "2.0";
+    call["method"] = "eth_blockNumber";
+    call["id"] = Json::UInt64(i);
+    batch.append(call);
+  }
+  // Notification gets no response
+  Json::Value notification;
+  notification["jsonrpc"] = "2.0";
+  notification["method"] = "eth_blockNumber";
+  batch.append(notification);
+
+  net::HttpProcessor::Request request;
+  request.method(boost::beast::http::verb::post);
+  request.body() = util::to_string(batch);
+
+  DelayedEchoHandler handler;
+  const auto process = [&](net::JsonRpcHttpProcessor& processor) {
+    processor.SetHandler(&handler);
+    return util::parse_json(processor.process(request).body());
+  };
+
+  auto pool = std::make_shared<util::ThreadPool>(3);
+  net::JsonRpcHttpProcessor parallel_processor(pool);
+  const auto parallel_res = process(parallel_processor);
+  ASSERT_EQ(parallel_res.size(), kCalls);
+  for (size_t i = 0; i < kCalls; ++i) {
+    EXPECT_EQ(parallel_res[Json::ArrayIndex(i)]["id"].asUInt64(), i);
+  }
+  // Calls overlapped, at most caller thread and 3 pool threads handle calls at the same time
+  EXPECT_GT(handler.max_running_calls, 1u);
+  EXPECT_LE(handler.max_running_calls, 4u);
+
+  // Calls not started in time fail
+  net::JsonRpcHttpProcessor timeout_processor(pool, {0, std::chrono::milliseconds(10)});
+  const auto timeout_res = process(timeout_processor);
+  ASSERT_EQ(timeout_res.size(), kCalls);
+  EXPECT_TRUE(timeout_res[0].isMember("result"));
+  EXPECT_TRUE(timeout_res[Json::ArrayIndex(kCalls - 1)].isMember("error"));
+
+  net::JsonRpcHttpProcessor limited_processor(pool, {kCalls, {}});
+  const auto limited_res = process(limited_processor);
+  EXPECT_EQ(limited_res["error"]["code"].asInt(), jsonrpc::Errors::ERROR_RPC_INVALID_REQUEST);
+}
+
+TEST_F(RPCTest, http_streamed_response) {
+  constexpr size_t kBufferSize = 256;
+  constexpr size_t kItems = 1000;
+  net::JsonRpcHttpProcessor processor({}, {}, kBufferSize);
+  const jsonrpc::Procedure procedure("test_stream", jsonrpc::PARAMS_BY_POSITION, jsonrpc::JSON_ARRAY, "param1",
+                                     jsonrpc::JSON_INTEGER, "param2", jsonrpc::JSON_BOOLEAN, NULL);
+  processor.addStreamingMethod(procedure, [](const Json::Value& params, net::JsonStreamWriter& writer) {
+    writer.beginArray();
+    for (size_t i = 0; i < params[0].asUInt64(); ++i) {
+      writer.writeArrayItem(Json::UInt64(i));
+    }
+    writer.endArray();
+    if (params[1].asBool()) {
+      throw std::runtime_error("failed");
+    }
+  });
+
+  const auto make_request = [](const std::string& method, size_t items, bool fail) {
+    Json::Value call;
+    call["jsonrpc"] = "2.0";
+    call["id"] = "call";
+    call["method"] = method;
+    call["params"].append(Json::UInt64(items));
+    call["params"].append(fail);
+    net::HttpProcessor::Request request;
+    request.method(boost::beast::http::verb::post);
+    request.body() = util::to_string(call);
+    return request;
+  };
+  std::vector<std::string> chunks;
+  const net::HttpProcessor::ChunkWriter write_chunk = [&chunks](std::string_view chunk) {
+    chunks.emplace_back(chunk);
+    return true;
+  };
+
+  net::HttpProcessor::Response header;
+  EXPECT_FALSE(processor.stream(make_request("test_other", kItems, false), header));
+
+  // Response is sent in chunks not exceeding buffer size
+  auto streamer = processor.stream(make_request("test_stream", kItems, false), header);
+  ASSERT_TRUE(streamer);
+  streamer(write_chunk);
+  EXPECT_GT(chunks.size(), 1);
+  std::string body;
+  for (const auto& chunk : chunks) {
+    EXPECT_LE(chunk.size(), kBufferSize);
+    body += chunk;
+  }
+  const auto response = util::parse_json(body);
+  EXPECT_EQ(response["id"], "call");
+  ASSERT_EQ(response["result"].size(), kItems);
+  EXPECT_EQ(response["result"][Json::ArrayIndex(kItems - 1)].asUInt64(), kItems - 1);
+
+  // Error is reported as a regular response if nothing was sent yet
+  chunks.clear();
+  processor.stream(make_request("test_stream", 1, true), header)(write_chunk);
+  ASSERT_EQ(chunks.size(), 1);
+  EXPECT_TRUE(util::parse_json(chunks[0]).isMember("error"));
+
+  // Otherwise streamed response is interrupted
+  EXPECT_THROW(processor.stream(make_request("test_stream", kItems, true), header)(write_chunk), std::runtime_error);
+
+  // Params are validated before the method is called
+  auto invalid_request = make_request("test_stream", kItems, false);
+  auto invalid_call = util::parse_json(invalid_request.body());
+  invalid_call["params"].resize(1);
+  invalid_request.body() = util::to_string(invalid_call);
+  chunks.clear();
+  processor.stream(invalid_request, header)(write_chunk);
+  ASSERT_EQ(chunks.size(), 1);
+  EXPECT_EQ(util::parse_json(chunks[0])["error"]["code"].asInt(), jsonrpc::Errors::ERROR_RPC_INVALID_PARAMS);
+}
+
 }  // namespace taraxa::core_tests
 
 using namespace taraxa;
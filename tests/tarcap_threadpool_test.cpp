@@ -1038,6 +1038,110 @@ TEST_F(TarcapTpTest, low_priotity_queue_starvation) {
   EXPECT_EQ(low_priority_queue_size, 0);
 }
 
+// Packet handler that only counts processed packets, used to measure packets scheduling overhead
+template <SubprotocolPacketType PacketType>
+class CountingPacketHandler : public network::tarcap::BasePacketHandler {
+ public:
+  CountingPacketHandler(std::shared_ptr<std::atomic<size_t>> processed_count)
+      : processed_count_(std::move(processed_count)) {}
+
+  void processPacket(const threadpool::PacketData&) override { (*processed_count_)++; }
+
+  // Packet type that is processed by this handler
+  static constexpr SubprotocolPacketType kPacketType_ = PacketType;
+
+ private:
+  std::shared_ptr<std::atomic<size_t>> processed_count_;
+};
+
+/**
+ * @brief Pushes packets of provided types from multiple producer threads into running threadpool and measures how
+ *        long it takes until all of them are processed
+ *
+ * @param packets_types types of packets, each producer pushes them round-robin
+ * @param packets_per_producer
+ * @param producers_num
+ * @return processed packets per second
+ */
+double measurePacketsThroughput(const std::vector<SubprotocolPacketType>& packets_types, size_t packets_per_producer,
+                                size_t producers_num) {
+  auto processed_count = std::make_shared<std::atomic<size_t>>(0);
+  auto packets_handler = std::make_shared<tarcap::PacketsHandler>();
+  packets_handler->registerHandler<CountingPacketHandler<SubprotocolPacketType::kVotePacket>>(processed_count);
+  packets_handler->registerHandler<CountingPacketHandler<SubprotocolPacketType::kVotesBundlePacket>>(processed_count);
+  packets_handler->registerHandler<CountingPacketHandler<SubprotocolPacketType::kTransactionPacket>>(processed_count);
+  packets_handler->registerHandler<CountingPacketHandler<SubprotocolPacketType::kStatusPacket>>(processed_count);
+
+  threadpool::PacketsThreadPool tp(10);
+  tp.setPacketsHandlers(TARAXA_NET_VERSION, packets_handler);
+  tp.startProcessing();
+
+  const auto total_packets = packets_per_producer * producers_num;
+  const auto start = std::chrono::steady_clock::now();
+  std::vector<std::thread> producers;
+  for (size_t p = 0; p < producers_num; p++) {
+    producers.emplace_back([&, p]() {
+      // Each producer simulates different peer
+      const dev::p2p::NodeID sender(static_cast<unsigned>(p + 1));
+      for (size_t i = 0; i < packets_per_producer; i++) {
+        tp.push(createPacket(sender, packets_types[i % packets_types.size()], {}));
+      }
+    });
+  }
+  for (auto& producer : producers) {
+    producer.join();
+  }
+
+  EXPECT_HAPPENS({60s, 1ms}, [&](auto& ctx) { WAIT_EXPECT_EQ(ctx, processed_count->load(), total_packets) });
+  const auto duration = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  tp.stopProcessing();
+
+  return total_packets / duration;
+}
+
+// Vote storm - many non-blocking high priority packets pushed concurrently from multiple peers
+TEST_F(TarcapTpTest, vote_packets_throughput) {
+  const auto throughput = measurePacketsThroughput({SubprotocolPacketType::kVotePacket}, 50000, 8);
+  std::cout << "Vote packets throughput: " << static_cast<uint64_t>(throughput) << " packets/s" << std::endl;
+}
+
+// Non-blocking packets mixed with transaction packets that have blocking dependencies and go through queue mutex
+TEST_F(TarcapTpTest, mixed_packets_throughput) {
+  const auto throughput = measurePacketsThroughput(
+      {SubprotocolPacketType::kVotePacket, SubprotocolPacketType::kVotePacket,
+       SubprotocolPacketType::kVotesBundlePacket, SubprotocolPacketType::kTransactionPacket,
+       SubprotocolPacketType::kStatusPacket},
+      50000, 8);
+  std::cout << "Mixed packets throughput: " << static_cast<uint64_t>(throughput) << " packets/s" << std::endl;
+}
+
+// Ping-pong of single non-blocking packets so that every push races with idle workers going to wait, a lost wake up
+// leaves the packet in the queue and stalls the producer
+TEST_F(TarcapTpTest, non_blocking_packets_wake_up_stress) {
+  auto processed_count = std::make_shared<std::atomic<size_t>>(0);
+  auto packets_handler = std::make_shared<tarcap::PacketsHandler>();
+  packets_handler->registerHandler<CountingPacketHandler<SubprotocolPacketType::kVotePacket>>(processed_count);
+
+  threadpool::PacketsThreadPool tp(4);
+  tp.setPacketsHandlers(TARAXA_NET_VERSION, packets_handler);
+  tp.startProcessing();
+
+  constexpr size_t kPacketsNum = 50000;
+  const dev::p2p::NodeID sender(1);
+  for (size_t i = 1; i <= kPacketsNum; i++) {
+    tp.push(createPacket(sender, SubprotocolPacketType::kVotePacket, {}));
+
+    // Nothing else is pushed in the meantime, so only the woken up worker can process the packet
+    const auto deadline = std::chrono::steady_clock::now() + 1s;
+    while (processed_count->load() < i && std::chrono::steady_clock::now() < deadline) {
+      std::this_thread::yield();
+    }
+    ASSERT_EQ(processed_count->load(), i) << "Worker was not woken up for packet " << i;
+  }
+
+  tp.stopProcessing();
+}
+
 }  // namespace taraxa::core_tests
 
 int main(int argc, char** argv) {
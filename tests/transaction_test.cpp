@@ -3,6 +3,8 @@
 #include <gtest/gtest.h>
 #include <libdevcore/CommonJS.h>
 
+#include <atomic>
+#include <map>
 #include <thread>
 #include <utility>
 #include <vector>
@@ -132,6 +134,20 @@ TEST_F(TransactionTest, verifiers) {
   t.join();
   thisThreadSleepForMilliSeconds(100);
   EXPECT_EQ(trx_mgr.getTransactionPoolSize(), g_signed_trx_samples->size());
+
+  // Bulk read finds transactions in pool and in db in requested order
+  const auto db_trx = std::make_shared<Transaction>(1000, 0, 1, 100000, bytes(), dev::KeyPair::create().secret());
+  auto batch = db->createWriteBatch();
+  db->addTransactionToBatch(*db_trx, batch);
+  db->commitWriteBatch(batch);
+  const auto pool_trx = g_signed_trx_samples->front();
+  const auto trxs = trx_mgr.getTransactionsByHashes({db_trx->getHash(), trx_hash_t(1), pool_trx->getHash()});
+  ASSERT_EQ(trxs.size(), 3);
+  ASSERT_TRUE(trxs[0]);
+  EXPECT_EQ(*trxs[0], *db_trx);
+  EXPECT_FALSE(trxs[1]);
+  ASSERT_TRUE(trxs[2]);
+  EXPECT_EQ(*trxs[2], *pool_trx);
 }
 
 TEST_F(TransactionTest, transaction_limit) {
@@ -361,10 +377,19 @@ TEST_F(TransactionTest, priority_queue) {
     auto trx2 = std::make_shared<Transaction>(nonce, 1, 1, 100, dev::fromHex("00FEDCBA9876543210000000"), g_secret,
                                               addr_t::random());
     auto trx_hash = trx->getHash();
+    auto trx2_hash = trx2->getHash();
     priority_queue.insert(std::move(trx2), true, 1);
     priority_queue.insert(std::move(trx), true, 1);
     EXPECT_EQ(priority_queue.getOrderedTransactions(1)[0]->getHash(), trx_hash);
     EXPECT_EQ(priority_queue.size(), 1);
+
+    // Replaced transaction is moved to non proposable transactions and still found by hash
+    EXPECT_TRUE(priority_queue.contains(trx2_hash));
+    EXPECT_EQ(priority_queue.get(trx2_hash)->getHash(), trx2_hash);
+    EXPECT_TRUE(priority_queue.erase(priority_queue.get(trx_hash)));
+    EXPECT_FALSE(priority_queue.contains(trx_hash));
+    EXPECT_EQ(priority_queue.get(trx_hash), nullptr);
+    EXPECT_TRUE(priority_queue.contains(trx2_hash));
   }
 
   /*
@@ -712,6 +737,187 @@ TEST_F(TransactionTest, signature_performance) {
             << "ms" << std::endl;
 }
 
+TEST_F(TransactionTest, parallel_senders_recovery) {
+  auto db = std::make_shared<DbStorage>(data_dir);
+  auto cfg = node_cfgs.front();
+  TransactionManager trx_mgr(cfg, db, std::make_shared<final_chain::FinalChain>(db, cfg, addr_t{}), addr_t());
+  auto trxs = samples::createSignedTrxSamples(1, 1000, g_secret);
+  SharedTransactions trxs_from_rlp;
+  for (const auto& t : trxs) {
+    trxs_from_rlp.push_back(std::make_shared<Transaction>(t->rlp()));
+  }
+
+  auto now = std::chrono::steady_clock::now();
+  trx_mgr.recoverSenders(trxs_from_rlp);
+  std::cout << "Time to recover 1000 transactions senders in parallel: "
+            << std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - now).count()
+            << "ms" << std::endl;
+
+  for (size_t i = 0; i < trxs.size(); ++i) {
+    EXPECT_EQ(trxs_from_rlp[i]->getSender(), trxs[i]->getSender());
+  }
+}
+
+TEST_F(TransactionTest, priority_queue_concurrent_throughput) {
+  const uint32_t accounts_count = 64;
+  const uint32_t trxs_per_account = 50;
+  const uint32_t total_trxs = accounts_count * trxs_per_account;
+  const uint32_t pack_count = 1000;
+  const uint32_t pack_iterations = 20;
+
+  std::vector<SharedTransactions> account_trxs(accounts_count);
+  for (auto& trxs : account_trxs) {
+    const auto secret = dev::KeyPair::create().secret();
+    for (uint32_t nonce = 0; nonce < trxs_per_account; ++nonce) {
+      trxs.emplace_back(std::make_shared<Transaction>(nonce, 100, 1 + nonce % 10, 100000, dev::bytes(), secret,
+                                                      addr_t::random()));
+      // Sender recovery is not part of the measured insertion
+      trxs.back()->getSender();
+    }
+  }
+
+  for (uint32_t threads_count = 1; threads_count <= 8; threads_count *= 2) {
+    TransactionQueue priority_queue(nullptr, total_trxs * 2);
+    std::atomic<uint32_t> inserted = 0;
+
+    auto now = std::chrono::steady_clock::now();
+    std::vector<std::thread> threads;
+    for (uint32_t t = 0; t < threads_count; ++t) {
+      threads.emplace_back([&, t]() {
+        for (uint32_t account = t; account < accounts_count; account += threads_count) {
+          for (auto trx : account_trxs[account]) {
+            if (priority_queue.insert(std::move(trx), true, 1) == TransactionStatus::Inserted) {
+              inserted++;
+            }
+          }
+        }
+      });
+    }
+    for (auto& thread : threads) {
+      thread.join();
+    }
+    const auto insert_us =
+        std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - now).count();
+    EXPECT_EQ(inserted, total_trxs);
+    EXPECT_EQ(priority_queue.size(), total_trxs);
+
+    std::atomic<uint32_t> packed = 0;
+    now = std::chrono::steady_clock::now();
+    threads.clear();
+    for (uint32_t t = 0; t < threads_count; ++t) {
+      threads.emplace_back([&]() {
+        for (uint32_t i = 0; i < pack_iterations; ++i) {
+          packed += priority_queue.getOrderedTransactions(pack_count).size();
+        }
+      });
+    }
+    for (auto& thread : threads) {
+      thread.join();
+    }
+    const auto pack_us =
+        std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - now).count();
+    EXPECT_EQ(packed, threads_count * pack_iterations * pack_count);
+
+    std::cout << "Threads: " << threads_count << ", insert throughput: " << total_trxs * 1000000 / (insert_us + 1)
+              << " trx/s, pack throughput: " << threads_count * pack_iterations * 1000000 / (pack_us + 1)
+              << " packs/s" << std::endl;
+  }
+}
+
+TEST_F(TransactionTest, priority_queue_proposal_latency) {
+  const uint32_t trxs_per_account = 20;
+  const uint64_t trx_gas = 100000;
+  const auto gas_limit = node_cfgs.front().propose_dag_gas_limit;
+  const std::vector<uint32_t> pool_sizes = {1000, 10000, 40000};
+
+  SharedTransactions trxs;
+  trxs.reserve(pool_sizes.back());
+  while (trxs.size() < pool_sizes.back()) {
+    const auto secret = dev::KeyPair::create().secret();
+    for (uint32_t nonce = 0; nonce < trxs_per_account; ++nonce) {
+      trxs.emplace_back(std::make_shared<Transaction>(nonce, 100, 1 + trxs.size() % 100, trx_gas, dev::bytes(), secret,
+                                                      addr_t::random()));
+      trxs.back()->getSender();
+    }
+  }
+
+  for (const auto pool_size : pool_sizes) {
+    TransactionQueue priority_queue(nullptr, pool_size);
+    for (uint32_t i = 0; i < pool_size; ++i) {
+      auto trx = trxs[i];
+      EXPECT_EQ(priority_queue.insert(std::move(trx), true, 1), TransactionStatus::Inserted);
+    }
+
+    // Copy of the full ordering of the pool that was done before each proposal, before the queue was iterated
+    // incrementally. Accounts transactions are copied out of the queue before the timer is started
+    const auto accounts_trxs = priority_queue.getAllTransactions();
+    const auto max_count = gas_limit / kMinTxGas;
+    auto now = std::chrono::steady_clock::now();
+    SharedTransactions ordered;
+    {
+      using AccountIterators = std::pair<SharedTransactions::const_iterator, SharedTransactions::const_iterator>;
+      std::multimap<val_t, AccountIterators, std::greater<val_t>> head_transactions;
+      for (const auto& account_trxs : accounts_trxs) {
+        head_transactions.insert({account_trxs.front()->getGasPrice(), {account_trxs.begin(), account_trxs.end()}});
+      }
+      while (!head_transactions.empty() && ordered.size() < max_count) {
+        auto head = head_transactions.begin();
+        auto [it, end] = head->second;
+        head_transactions.erase(head);
+        ordered.push_back(*it);
+        if (++it != end) {
+          head_transactions.insert({(*it)->getGasPrice(), {it, end}});
+        }
+      }
+    }
+    const auto full_us =
+        std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - now).count();
+
+    // Iteration which stops once gas limit is reached
+    SharedTransactions packed;
+    uint64_t packed_gas = 0;
+    now = std::chrono::steady_clock::now();
+    priority_queue.forEachOrderedTransaction([&](const SharedTransaction& trx) {
+      if (packed_gas + trx->getGas() > gas_limit) {
+        return false;
+      }
+      packed_gas += trx->getGas();
+      packed.push_back(trx);
+      return true;
+    });
+    const auto incremental_us =
+        std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - now).count();
+
+    EXPECT_EQ(packed.size(), std::min<uint64_t>(gas_limit / trx_gas, pool_size));
+    for (size_t i = 0; i < packed.size(); ++i) {
+      EXPECT_EQ(packed[i]->getGasPrice(), ordered[i]->getGasPrice());
+    }
+
+    // Iteration resumed from the position of the previous one continues with the next transactions in order
+    TransactionQueue::OrderedIterationPosition position;
+    SharedTransactions resumed;
+    for (const auto half : {packed.size() / 2, packed.size() - packed.size() / 2}) {
+      size_t count = 0;
+      priority_queue.forEachOrderedTransaction(
+          [&](const SharedTransaction& trx) {
+            if (count++ == half) {
+              return false;
+            }
+            resumed.push_back(trx);
+            return true;
+          },
+          &position);
+    }
+    ASSERT_EQ(resumed.size(), packed.size());
+    for (size_t i = 0; i < resumed.size(); ++i) {
+      EXPECT_EQ(resumed[i]->getGasPrice(), packed[i]->getGasPrice());
+    }
+
+    std::cout << "Pool size: " << pool_size << ", full ordering: " << full_us
+              << "us, incremental packing: " << incremental_us << "us" << std::endl;
+  }
+}
+
 TEST_F(TransactionTest, intrinsic_gas) {
   EXPECT_EQ(IntrinsicGas(dev::bytes(), false), kTxGas);
   EXPECT_EQ(IntrinsicGas(dev::bytes(), true), kTxGasContractCreation);
@@ -55,6 +55,80 @@ TEST_F(VoteTest, verified_votes) {
   EXPECT_EQ(vote_mgr->getVerifiedVotes().size(), 0);
 }
 
+TEST_F(VoteTest, validate_votes_batch) {
+  auto node = create_nodes(1, true /*start*/).front();
+
+  // stop PBFT manager, that will place vote
+  node->getPbftManager()->stop();
+
+  auto [period, round] = clearAllVotes({node});
+  auto vote_mgr = node->getVoteManager();
+  const auto& wallet = node->getConfig().getFirstWallet();
+
+  // Enough votes to be verified in parallel, votes are decoded from rlp as received from peers so voters are not known
+  // and must be recovered from signatures
+  std::vector<std::shared_ptr<PbftVote>> votes;
+  for (PbftStep step = 4; step < 68; step++) {
+    const auto vote = vote_mgr->generateVote(blk_hash_t(step), PbftVoteTypes::next_vote, period, round, step, wallet);
+    votes.push_back(std::make_shared<PbftVote>(vote->rlp()));
+  }
+  // Duplicated vote
+  votes.push_back(votes.front());
+  // Vote from author without stake
+  VrfPbftSortition vrf_sortition(wallet.vrf_secret, {PbftVoteTypes::next_vote, period, round, 4});
+  const auto no_stake_vote =
+      std::make_shared<PbftVote>(dev::KeyPair::create().secret(), std::move(vrf_sortition), blk_hash_t(1));
+  votes.push_back(std::make_shared<PbftVote>(no_stake_vote->rlp()));
+
+  const auto results = vote_mgr->validateVotes(votes);
+  ASSERT_EQ(results.size(), votes.size());
+  EXPECT_FALSE(results[votes.size() - 2].has_value());
+  ASSERT_TRUE(results.back().has_value());
+  EXPECT_FALSE(results.back()->first);
+
+  EXPECT_EQ(votes.back()->getVoterAddr(), no_stake_vote->getVoterAddr());
+
+  // Batch validation gives the same results as validating votes one by one
+  for (size_t i = 0; i < votes.size() - 2; i++) {
+    ASSERT_TRUE(results[i].has_value());
+    EXPECT_EQ(votes[i]->getVoterAddr(), wallet.node_addr);
+    const auto weight = votes[i]->getWeight();
+    EXPECT_EQ(results[i]->first, vote_mgr->validateVote(votes[i]).first);
+    EXPECT_EQ(weight, votes[i]->getWeight());
+    EXPECT_TRUE(vote_mgr->voteAlreadyValidated(votes[i]->getHash()));
+  }
+
+  // Already validated votes are skipped
+  for (const auto& result : vote_mgr->validateVotes(votes)) {
+    EXPECT_FALSE(result.has_value());
+  }
+}
+
+TEST_F(VoteTest, preverify_vote) {
+  auto node = create_nodes(1, true /*start*/).front();
+
+  // stop PBFT manager, that will place vote
+  node->getPbftManager()->stop();
+
+  auto [period, round] = clearAllVotes({node});
+  auto vote_mgr = node->getVoteManager();
+  const auto& wallet = node->getConfig().getFirstWallet();
+
+  // Vrf proof verified ahead is not verified again, vote still gets its weight
+  auto vote = vote_mgr->generateVote(blk_hash_t(1), PbftVoteTypes::next_vote, period, round, 4, wallet);
+  EXPECT_TRUE(vote_mgr->preverifyVote(vote));
+  EXPECT_FALSE(vote->getWeight().has_value());
+  EXPECT_TRUE(vote_mgr->validateVote(vote, true, true).first);
+  EXPECT_TRUE(vote->getWeight().has_value());
+
+  // Vrf key of author without stake is not known
+  VrfPbftSortition vrf_sortition(wallet.vrf_secret, {PbftVoteTypes::next_vote, period, round, 4});
+  auto no_stake_vote =
+      std::make_shared<PbftVote>(dev::KeyPair::create().secret(), std::move(vrf_sortition), blk_hash_t(1));
+  EXPECT_FALSE(vote_mgr->preverifyVote(no_stake_vote));
+  EXPECT_FALSE(vote_mgr->validateVote(no_stake_vote).first);
+}
+
 TEST_F(VoteTest, round_determine_from_next_votes) {
   auto node = create_nodes(1, true /*start*/).front();
 